@@ -30,8 +30,15 @@ class AtomicOps {
   static int Decrement(volatile int* i) {
     return ::InterlockedDecrement(reinterpret_cast<volatile LONG*>(i));
   }
-  static int AcquireLoad(volatile const int* i) { return *i; }
-  static void ReleaseStore(volatile int* i, int value) { *i = value; }
+  // Plain volatile accesses are only ordered under /volatile:ms, which is
+  // not the default on ARM64; use interlocked operations instead.
+  static int AcquireLoad(volatile const int* i) {
+    return ::InterlockedCompareExchange(
+        reinterpret_cast<volatile LONG*>(const_cast<volatile int*>(i)), 0, 0);
+  }
+  static void ReleaseStore(volatile int* i, int value) {
+    ::InterlockedExchange(reinterpret_cast<volatile LONG*>(i), value);
+  }
   static int CompareAndSwap(volatile int* i, int old_value, int new_value) {
     return ::InterlockedCompareExchange(reinterpret_cast<volatile LONG*>(i),
                                         new_value, old_value);
@@ -39,7 +46,8 @@ class AtomicOps {
   // Pointer variants.
   template <typename T>
   static T* AcquireLoadPtr(T* volatile* ptr) {
-    return *ptr;
+    return static_cast<T*>(::InterlockedCompareExchangePointer(
+        reinterpret_cast<PVOID volatile*>(ptr), nullptr, nullptr));
   }
   template <typename T>
   static T* CompareAndSwapPtr(T* volatile* ptr, T* old_value, T* new_value) {
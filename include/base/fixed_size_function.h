@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 enum class construct_type {
   none,
@@ -54,6 +55,17 @@ struct fixed_function_vtable<construct_type::copy_and_move, Ret, Args...>
   void (*move)(void*, void*) = nullptr;
 };
 
+// Instantiated only to fail: the sizes show up in the diagnostic.
+template <size_t FunctorSize, size_t Capacity,
+          bool Fits = FunctorSize <= Capacity>
+struct functor_fits {
+  static_assert(Fits,
+                "Functor does not fit in fixed_size_function: capture less or "
+                "raise MaxSize (the storage is MaxSize minus the v-table); "
+                "see the FunctorSize and Capacity arguments above");
+  static const bool value = Fits;
+};
+
 }  // namespace details
 
 template <typename Function, size_t MaxSize = 128,
@@ -216,8 +228,11 @@ class fixed_size_function<Ret(Args...), MaxSize, ConstructStrategy> {
   template <typename Functor>
   void create(Functor&& f) {
     using functor_type = typename std::decay<Functor>::type;
-    static_assert(sizeof(functor_type) <= StorageSize,
-                  "Functor must be smaller than storage buffer");
+    static_assert(
+        details::functor_fits<sizeof(functor_type), StorageSize>::value,
+        "Functor must be smaller than storage buffer");
+    static_assert(alignof(functor_type) <= alignof(storage),
+                  "Functor is over-aligned for the storage buffer");
 
     new (&storage_) functor_type(std::forward<Functor>(f));
 
@@ -286,11 +301,53 @@ class fixed_size_function<Ret(Args...), MaxSize, ConstructStrategy> {
  private:
   using vtable =
       details::fixed_function_vtable<ConstructStrategy, Ret, Args...>;
+  static_assert(MaxSize > sizeof(vtable),
+                "MaxSize leaves no room for the functor after the v-table");
   static const size_t StorageSize = MaxSize - sizeof(vtable);
   using storage = typename std::aligned_storage<StorageSize>::type;
 
   vtable vtable_;
   storage storage_;
+
+ public:
+  // Largest functor, in bytes, that can be stored.
+  static const size_t capacity = StorageSize;
+};
+
+// A plain C callback: a function pointer whose first parameter is an opaque
+// context, and that context. Calling it is one indirect call; nothing is
+// copied into a buffer or dispatched through a v-table. |Pointer| is the
+// delegate type itself, so its calling convention is kept.
+template <typename Pointer>
+class context_function {
+ public:
+  context_function() {}
+
+  context_function(std::nullptr_t) {}
+
+  context_function(Pointer function, void* context)
+      : function_(function), context_(context) {}
+
+  context_function& operator=(std::nullptr_t) {
+    function_ = nullptr;
+    context_ = nullptr;
+    return *this;
+  }
+
+  explicit operator bool() const { return function_ != nullptr; }
+
+  template <typename... Args>
+  auto operator()(Args&&... args) const
+      -> decltype(std::declval<Pointer>()(nullptr,
+                                          std::forward<Args>(args)...)) {
+    return function_(context_, std::forward<Args>(args)...);
+  }
+
+  void* context() const { return context_; }
+
+ private:
+  Pointer function_ = nullptr;
+  void* context_ = nullptr;
 };
 
 #endif  // FIXED_SIZE_FUNCTION_HPP_INCLUDED
\ No newline at end of file
@@ -11,10 +11,15 @@
 #define LIB_PORTABLE_API
 #endif
 
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <map>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <sstream>
 
@@ -23,8 +28,7 @@
  * boundary.
  *
  * Besides memory layout, the class must be destroyed in the same library as
- * created. None of these classes is thread-safe. The classes are not optimized
- * for performance.
+ * created. None of these classes is thread-safe.
  */
 
 namespace portable {
@@ -66,8 +70,37 @@ class string {
   }
 
   inline string& operator=(const string& o) {
-    destroy();
-    init(o.m_dynamic == 0 ? o.m_buf : o.m_dynamic, o.m_length);
+    if (this != &o) {
+      destroy();
+      init(o.m_dynamic == 0 ? o.m_buf : o.m_dynamic, o.m_length);
+    }
+    return *this;
+  }
+
+  // Long strings hand over their buffer; short ones only copy the inline
+  // buffer. The moved-from string is left empty.
+  inline string(string&& o) noexcept
+      : m_dynamic(o.m_dynamic), m_length(o.m_length) {
+    if (m_dynamic == 0) {
+      memcpy(m_buf, o.m_buf, m_length + 1);
+    }
+    o.m_dynamic = 0;
+    o.m_length = 0;
+    o.m_buf[0] = 0;
+  }
+
+  inline string& operator=(string&& o) noexcept {
+    if (this != &o) {
+      destroy();
+      m_dynamic = o.m_dynamic;
+      m_length = o.m_length;
+      if (m_dynamic == 0) {
+        memcpy(m_buf, o.m_buf, m_length + 1);
+      }
+      o.m_dynamic = 0;
+      o.m_length = 0;
+      o.m_buf[0] = 0;
+    }
     return *this;
   }
 
@@ -138,6 +171,49 @@ class string {
 
 inline std::string to_std_string(const string& str) { return str.std_string(); }
 
+/**
+ * Non-owning reference to characters owned by someone else, typically a
+ * library object. It is valid only as long as the owner keeps the
+ * characters unchanged; see the accessor that returned it.
+ */
+class string_view {
+ private:
+  const char* m_data;
+  size_t m_length;
+
+ public:
+  string_view() : m_data(""), m_length(0) {}
+  string_view(const char* data, size_t length)
+      : m_data(data ? data : ""), m_length(data ? length : 0) {}
+  string_view(const string& str)
+      : m_data(str.c_string()), m_length(str.size()) {}
+  string_view(const std::string& str)
+      : m_data(str.c_str()), m_length(str.size()) {}
+
+  inline const char* data() const { return m_data; }
+
+  inline size_t size() const { return m_length; }
+
+  inline bool empty() const { return m_length == 0; }
+
+  inline std::string std_string() const {
+    return std::string(m_data, m_length);
+  }
+
+  /**
+   * Same contract as string::copy_to().
+   */
+  inline size_t copy_to(char* dest, size_t sz_dest) const {
+    if (dest == 0) { return 0; }
+    *dest = '\0';
+    if (sz_dest == 0 || m_length == 0) { return 0; }
+    size_t cch_len = m_length < sz_dest - 1 ? m_length : sz_dest - 1;
+    memcpy(dest, m_data, cch_len);
+    dest[cch_len] = '\0';
+    return cch_len;
+  }
+};
+
 template <typename T>
 class identity {
   T operator()(const T& x) { return x; }
@@ -152,6 +228,11 @@ class vector {
   T* m_array;
   size_t m_size;
 
+  // The storage is a single raw allocation; its capacity is kept in a header
+  // just before m_array, so the object itself stays {pointer, size}.
+  static constexpr size_t header_size =
+      (sizeof(size_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+
  public:
   class move_ref {
     friend class vector;
@@ -162,78 +243,100 @@ class vector {
   };
 
   vector() : m_array(0), m_size(0) {}
-  vector(T* array, size_t s) : m_array(array), m_size(s) {}
+
+  /**
+   * Copies |s| elements from |array|; the array is not adopted.
+   */
+  vector(const T* array, size_t s) : m_array(0), m_size(0) {
+    reserve(s);
+    for (size_t i = 0; i < s; ++i) {
+      new (m_array + i) T(array[i]);
+    }
+    m_size = s;
+  }
+
+  /**
+   * Adopts |array|, which must come from new T[s]: the elements are moved
+   * into the vector's own storage and the array is deleted.
+   */
+  vector(T* array, size_t s) : m_array(0), m_size(0) {
+    reserve(s);
+    for (size_t i = 0; i < s; ++i) {
+      new (m_array + i) T(std::move(array[i]));
+    }
+    m_size = s;
+    delete[] array;
+  }
 
   template <typename Iterable>
-  vector(const Iterable& v) {
-    m_size = v.size();
-    if (v.size() == 0) {
-      m_array = 0;
-    } else {
-      m_array = new T[v.size()];
-      size_t i = 0;
-      for (typename Iterable::const_iterator it = v.begin(); it != v.end();
-           ++it) {
-        m_array[i++] = *it;
-      }
+  vector(const Iterable& v) : m_array(0), m_size(0) {
+    reserve(v.size());
+    for (typename Iterable::const_iterator it = v.begin(); it != v.end();
+         ++it) {
+      new (m_array + m_size) T(*it);
+      ++m_size;
     }
   }
 
   template <typename Iterable, typename Converter>
-  vector(const Iterable& v, Converter convert) {
-    m_size = v.size();
-    if (v.size() == 0) {
-      m_array = 0;
-    } else {
-      m_array = new T[v.size()];
-      size_t i = 0;
-      for (typename Iterable::const_iterator it = v.begin(); it != v.end();
-           ++it) {
-        m_array[i++] = convert(*it);
-      }
+  vector(const Iterable& v, Converter convert) : m_array(0), m_size(0) {
+    reserve(v.size());
+    for (typename Iterable::const_iterator it = v.begin(); it != v.end();
+         ++it) {
+      new (m_array + m_size) T(convert(*it));
+      ++m_size;
     }
   }
 
-  vector(const vector<T>& o) {
-    m_size = o.m_size;
-    if (m_size != 0) {
-      m_array = new T[o.m_size];
-      for (size_t i = 0; i < o.m_size; ++i) {
-        m_array[i] = o.m_array[i];
-      }
+  vector(const vector<T>& o) : m_array(0), m_size(0) {
+    reserve(o.m_size);
+    for (size_t i = 0; i < o.m_size; ++i) {
+      new (m_array + i) T(o.m_array[i]);
     }
+    m_size = o.m_size;
+  }
+
+  vector(vector<T>&& o) noexcept : m_array(o.m_array), m_size(o.m_size) {
+    o.m_array = 0;
+    o.m_size = 0;
   }
 
   ~vector() { destroy_all(); }
 
   vector<T>& operator=(const vector<T>& o) {
-    if (m_size < o.m_size) {
-      destroy_all();
-      m_array = new T[o.m_size];
-    } else if (o.m_size == 0 && m_size != 0) {
+    if (this == &o) {
+      return *this;
+    }
+    if (capacity() < o.m_size) {
       destroy_all();
+      reserve(o.m_size);
+    } else {
+      destroy_elements();
     }
-    m_size = o.m_size;
     for (size_t i = 0; i < o.m_size; ++i) {
-      m_array[i] = o.m_array[i];
+      new (m_array + i) T(o.m_array[i]);
     }
+    m_size = o.m_size;
     return *this;
   }
 
-  vector(move_ref mr) : m_array(mr.m_ref.m_array), m_size(mr.m_ref.m_size) {}
-  vector<T>& operator=(move_ref mr) {
-    if (m_size != 0) {
+  vector<T>& operator=(vector<T>&& o) noexcept {
+    if (this != &o) {
       destroy_all();
+      m_array = o.m_array;
+      m_size = o.m_size;
+      o.m_array = 0;
+      o.m_size = 0;
     }
-    m_size = mr.m_ref.m_size;
-    m_array = mr.m_ref.m_array;
-    mr.m_ref.m_size = 0;
-    mr.m_ref.m_array = 0;
     return *this;
   }
+
+  vector(move_ref mr) : vector(static_cast<vector<T>&&>(mr.m_ref)) {}
+  vector<T>& operator=(move_ref mr) {
+    return *this = static_cast<vector<T>&&>(mr.m_ref);
+  }
   /**
-   * Not really safe - can't be used as vector(something).move(),
-   * but vector tmp(something); other = tmp.move();
+   * Kept for source compatibility; prefer std::move().
    */
   move_ref move() { return move_ref(*this); }
 
@@ -250,21 +353,134 @@ class vector {
 
   size_t size() const { return m_size; }
 
+  size_t capacity() const {
+    return m_array == 0 ? 0
+                        : *reinterpret_cast<const size_t*>(
+                              reinterpret_cast<const char*>(m_array) -
+                              header_size);
+  }
+
   T& operator[](size_t i) { return m_array[i]; }
 
   const T& operator[](size_t i) const { return m_array[i]; }
 
-  void clear() { destroy_all(); }
+  /**
+   * Grows the storage to hold at least |n| elements without reallocating.
+   */
+  void reserve(size_t n) {
+    if (n <= capacity()) {
+      return;
+    }
+    T* array = allocate(n);
+    for (size_t i = 0; i < m_size; ++i) {
+      new (array + i) T(std::move(m_array[i]));
+      destroy(&m_array[i]);
+    }
+    deallocate(m_array);
+    m_array = array;
+  }
+
+  void push_back(const T& value) {
+    if (m_size == capacity()) {
+      // |value| may live in the storage that is about to be replaced.
+      T copy(value);
+      grow();
+      new (m_array + m_size) T(std::move(copy));
+    } else {
+      new (m_array + m_size) T(value);
+    }
+    ++m_size;
+  }
+
+  void push_back(T&& value) {
+    if (m_size == capacity()) {
+      T moved(std::move(value));
+      grow();
+      new (m_array + m_size) T(std::move(moved));
+    } else {
+      new (m_array + m_size) T(std::move(value));
+    }
+    ++m_size;
+  }
+
+  /**
+   * Destroys the elements but keeps the storage for reuse.
+   */
+  void clear() { destroy_elements(); }
 
  protected:
   void destroy(T* rt) { reinterpret_cast<const T*>(rt)->~T(); }
 
-  void destroy_all() {
+  void destroy_elements() {
     for (size_t i = 0; i < m_size; ++i) {
       destroy(&m_array[i]);
     }
     m_size = 0;
   }
+
+  void destroy_all() {
+    destroy_elements();
+    deallocate(m_array);
+    m_array = 0;
+  }
+
+ private:
+  void grow() {
+    size_t n = capacity();
+    reserve(n < 4 ? 4 : n * 2);
+  }
+
+#if defined(__cpp_aligned_new)
+  static constexpr bool over_aligned =
+      alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else
+  // Before C++17 there is no aligned operator new; over-aligned storage is
+  // aligned by hand and the block's address is kept at the end of the
+  // header, which is alignof(T) bytes long for such types.
+  static constexpr bool over_aligned =
+      alignof(T) > alignof(std::max_align_t);
+  static_assert(!over_aligned ||
+                    header_size >= sizeof(size_t) + sizeof(void*),
+                "no room for the block address in the header");
+#endif
+
+  static T* allocate(size_t n) {
+    size_t bytes = header_size + n * sizeof(T);
+    char* raw;
+    if (!over_aligned) {
+      raw = static_cast<char*>(::operator new(bytes));
+    } else {
+#if defined(__cpp_aligned_new)
+      raw = static_cast<char*>(
+          ::operator new(bytes, std::align_val_t(alignof(T))));
+#else
+      char* block =
+          static_cast<char*>(::operator new(bytes + alignof(T) - 1));
+      raw = reinterpret_cast<char*>(
+          (reinterpret_cast<uintptr_t>(block) + alignof(T) - 1) &
+          ~static_cast<uintptr_t>(alignof(T) - 1));
+      reinterpret_cast<void**>(raw + header_size)[-1] = block;
+#endif
+    }
+    *reinterpret_cast<size_t*>(raw) = n;
+    return reinterpret_cast<T*>(raw + header_size);
+  }
+
+  static void deallocate(T* array) {
+    if (array == 0) {
+      return;
+    }
+    char* raw = reinterpret_cast<char*>(array) - header_size;
+    if (!over_aligned) {
+      ::operator delete(raw);
+    } else {
+#if defined(__cpp_aligned_new)
+      ::operator delete(raw, std::align_val_t(alignof(T)));
+#else
+      ::operator delete(reinterpret_cast<void**>(array)[-1]);
+#endif
+    }
+  }
 };
 
 inline std::string string::join(string separator, const vector<string>& values)
@@ -312,15 +528,16 @@ class map {
   }*/
 
   template <typename K2, typename KC, typename V2, typename VC>
-  static my_pair* to_array(const std::map<K2, V2>& m, KC convertKey,
-                           VC convertValue) {
-    my_pair* data = new my_pair[m.size()];
-    my_pair* dp = data;
+  static vector<my_pair> to_vector(const std::map<K2, V2>& m, KC convertKey,
+                                   VC convertValue) {
+    vector<my_pair> data;
+    data.reserve(m.size());
     for (typename std::map<K2, V2>::const_iterator it = m.begin();
          it != m.end(); ++it) {
-      dp->key = convertKey(it->first);
-      dp->value = convertValue(it->second);
-      ++dp;
+      my_pair p;
+      p.key = convertKey(it->first);
+      p.value = convertValue(it->second);
+      data.push_back(std::move(p));
     }
     return data;
   }
@@ -342,20 +559,27 @@ class map {
           m_vec(to_array(m, convertKey, convertValue), m.size()) {}*/
 
   map(const std::map<K, V>& m)
-      : m_vec(to_array(m, identity<K>(), identity<V>()), m.size()) {}
+      : m_vec(to_vector(m, identity<K>(), identity<V>())) {}
 
   template <typename K2, typename KC, typename V2, typename VC>
   map(const std::map<K2, V2>& m, KC convertKey = identity<K>(),
       VC convertValue = identity<V>())
-      : m_vec(to_array(m, convertKey, convertValue), m.size()) {}
+      : m_vec(to_vector(m, convertKey, convertValue)) {}
+
+  map(const map<K, V>& o) : m_vec(o.m_vec) {}
 
-  map(const map<K, V>& o) { m_vec = o.m_vec; }
+  map(map<K, V>&& o) noexcept : m_vec(std::move(o.m_vec)) {}
 
   map<K, V>& operator=(const map<K, V>& o) {
     m_vec = o.m_vec;
     return *this;
   }
 
+  map<K, V>& operator=(map<K, V>&& o) noexcept {
+    m_vec = std::move(o.m_vec);
+    return *this;
+  }
+
   map(move_ref mr) : m_vec(mr.m_ref.m_vec.move()) {}
   map<K, V>& operator=(move_ref mr) {
     m_vec = mr.m_ref.m_vec.move();
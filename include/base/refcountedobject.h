@@ -10,12 +10,15 @@
 #ifndef LIB_WEBRTC_REFCOUNTEDOBJECT_H_
 #define LIB_WEBRTC_REFCOUNTEDOBJECT_H_
 
+#include <atomic>
 #include <utility>
 
-#include "atomicops.h"
-
 namespace libwebrtc {
 
+// Increments are relaxed: taking another reference needs no ordering, since
+// the caller already holds one. The decrement is acq_rel so that every use of
+// the object happens before the thread that drops the last reference
+// deletes it.
 template <class T>
 class RefCountedObject : public T {
  public:
@@ -29,10 +32,12 @@ class RefCountedObject : public T {
       : T(std::forward<P0>(p0), std::forward<P1>(p1),
           std::forward<Args>(args)...) {}
 
-  virtual int AddRef() const { return AtomicOps::Increment(&ref_count_); }
+  virtual int AddRef() const {
+    return ref_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
 
   virtual int Release() const {
-    int count = AtomicOps::Decrement(&ref_count_);
+    int count = ref_count_.fetch_sub(1, std::memory_order_acq_rel) - 1;
     if (!count) {
       delete this;
     }
@@ -46,13 +51,44 @@ class RefCountedObject : public T {
   // barrier needed for the owning thread to act on the object, knowing that it
   // has exclusive access to the object.
   virtual bool HasOneRef() const {
-    return AtomicOps::AcquireLoad(&ref_count_) == 1;
+    return ref_count_.load(std::memory_order_acquire) == 1;
   }
 
  protected:
   virtual ~RefCountedObject() {}
 
-  mutable volatile int ref_count_ = 0;
+  mutable std::atomic<int> ref_count_{0};
+};
+
+// Intrusive reference counting for internal types that are never derived
+// from. A class declared final that derives from RefCountedFinal<Interface>
+// is created with plain new; calls through its own type are devirtualised
+// and inlined, callers holding the Interface still go through the vtable.
+template <class Interface>
+class RefCountedFinal : public Interface {
+ public:
+  int AddRef() const override {
+    return ref_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  int Release() const override {
+    int count = ref_count_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    if (!count) {
+      delete this;
+    }
+    return count;
+  }
+
+  bool HasOneRef() const {
+    return ref_count_.load(std::memory_order_acquire) == 1;
+  }
+
+ protected:
+  RefCountedFinal() {}
+  ~RefCountedFinal() override {}
+
+ private:
+  mutable std::atomic<int> ref_count_{0};
 };
 
 }  // namespace libwebrtc
@@ -22,15 +22,19 @@ using rtcCandidateNetworkPolicy = libwebrtc::CandidateNetworkPolicy;
 using rtcTcpCandidatePolicy = libwebrtc::TcpCandidatePolicy;
 using rtcMediaSecurityType = libwebrtc::MediaSecurityType;
 using rtcSdpSemantics = libwebrtc::SdpSemantics;
+using rtcContinualGatheringPolicy = libwebrtc::ContinualGatheringPolicy;
 using rtcMediaType = libwebrtc::RTCMediaType;
 using rtcDesktopType = libwebrtc::DesktopType;
+using rtcThumbnailFormat = libwebrtc::ThumbnailFormat;
 using rtcCaptureState = libwebrtc::RTCCaptureState;
+using rtcObserverThread = libwebrtc::RTCObserverThread;
 using rtcAudioDataToneFrequency = libwebrtc::RTCAudioDataToneFrequency;
 using rtcVideoFrameClearType = libwebrtc::RTCVideoFrameClearType;
 using rtcVideoFrameTypeARGB = libwebrtc::RTCVideoFrameTypeARGB;
 using rtcVideoFrameTypeYUV = libwebrtc::RTCVideoFrameTypeYUV;
 using rtcVideoFrameARGB = libwebrtc::RTCVideoFrameARGB;
 using rtcVideoFrameYUV = libwebrtc::RTCVideoFrameYUV;
+using rtcVideoFrameExportFormat = libwebrtc::RTCVideoFrameExportFormat;
 
 /// 64-bit timestamp for interop API.
 using rtcTimestamp = long long;
@@ -309,6 +313,25 @@ struct rtcPeerConnectionConfiguration {
   rtcBool32 disable_link_local_networks = rtcBool32::kFalse;
   int screencast_min_bitrate = -1;
 
+  rtcContinualGatheringPolicy continual_gathering_policy =
+      rtcContinualGatheringPolicy::kGatherOnce;
+  int ice_check_interval_strong_connectivity = -1;
+  int ice_check_interval_weak_connectivity = -1;
+  int ice_check_min_interval = -1;
+  int ice_connection_receiving_timeout = -1;
+  int ice_backup_candidate_pair_ping_interval = -1;
+
+  int min_port = 0;
+  int max_port = 0;
+
+  int audio_jitter_buffer_max_packets = 200;
+  rtcBool32 audio_jitter_buffer_fast_accelerate = rtcBool32::kFalse;
+  int audio_jitter_buffer_min_delay_ms = 0;
+
+  unsigned int ice_candidate_filter = 0;  // libwebrtc::IceCandidateFilter bits
+  int ice_candidate_batch_size = 0;
+  int ice_candidate_batch_window_ms = 0;
+
   // private
   rtcBool32 use_rtp_mux = rtcBool32::kTrue;
   uint32_t local_audio_bandwidth = 128;
@@ -339,6 +362,134 @@ struct rtcKeyProviderOptions {
   rtcBool32 discard_frame_when_cryptor_not_ready = rtcBool32::kFalse;
 };  // end struct rtcKeyProviderOptions
 
+struct rtcStatsSummary {
+  double min = 0;
+  double max = 0;
+  double mean = 0;
+  double last = 0;
+  int samples = 0;
+};  // end struct rtcStatsSummary
+
+/// Mirrors libwebrtc::RTCVideoLatencyStats.
+struct rtcVideoLatencyStats {
+  long long frames_rendered = 0;
+  long long frames_marked = 0;
+  long long frames_lost = 0;
+  long long freeze_count = 0;
+  long long total_freeze_ms = 0;
+  double latency_last_ms = 0;
+  double latency_min_ms = 0;
+  double latency_mean_ms = 0;
+  double latency_max_ms = 0;
+  double latency_p50_ms = 0;
+  double latency_p95_ms = 0;
+  double latency_p99_ms = 0;
+};  // end struct rtcVideoLatencyStats
+
+/// Size and encoding of desktop media source thumbnails. A zero size keeps
+/// the captured size.
+struct rtcThumbnailOptions {
+  int max_width = 0;
+  int max_height = 0;
+  rtcThumbnailFormat format = rtcThumbnailFormat::kJpeg;
+  int jpeg_quality = 75;
+};  // end struct rtcThumbnailOptions
+
+/// Everything needed to read a video frame, filled by RTCVideoFrame_GetInfo.
+/// The plane pointers stay valid while the frame handle is held.
+struct rtcVideoFrameInfo {
+  int width = 0;
+  int height = 0;
+  int size = 0;
+  rtcVideoRotation rotation = rtcVideoRotation::kVideoRotation_0;
+  rtcTimestamp timestamp_us = 0;
+  const unsigned char* data_y = nullptr;
+  const unsigned char* data_u = nullptr;
+  const unsigned char* data_v = nullptr;
+  int stride_y = 0;
+  int stride_u = 0;
+  int stride_v = 0;
+};  // end struct rtcVideoFrameInfo
+
+/// All fields of an RTCRtpEncodingParameters object. Strings longer than
+/// their buffer are truncated.
+struct rtcRtpEncodingParametersInfo {
+  unsigned int ssrc = 0;
+  double bitrate_priority = 0;
+  rtcNetworkPriority network_priority = rtcNetworkPriority::kLow;
+  int max_bitrate_bps = 0;
+  int min_bitrate_bps = 0;
+  double max_framerate = 0;
+  int num_temporal_layers = 0;
+  double scale_resolution_down_by = 0;
+  rtcBool32 active = rtcBool32::kFalse;
+  rtcBool32 adaptive_ptime = rtcBool32::kFalse;
+  char rid[64] = {};
+  char scalability_mode[32] = {};
+};  // end struct rtcRtpEncodingParametersInfo
+
+/// Sender level part of RTCRtpSender_GetParametersSnapshot.
+struct rtcRtpSenderParametersSnapshot {
+  unsigned int ssrc = 0;
+  rtcMediaType media_type = rtcMediaType::UNSUPPORTED;
+  rtcDegradationPreference degradation_preference =
+      rtcDegradationPreference::kBALANCED;
+  /// Total number of encodings; may exceed the number copied.
+  int encoding_count = 0;
+  int codec_count = 0;
+  int header_extension_count = 0;
+  char mid[32] = {};
+  char transaction_id[64] = {};
+};  // end struct rtcRtpSenderParametersSnapshot
+
+/// Mirrors libwebrtc::RTCVideoCodecStatus.
+enum class rtcVideoCodecStatus : int {
+  kOk = 0,
+  kError = -1,
+  kFallbackToBuiltin = -2
+};
+
+enum class rtcVideoCodecMode : int { kRealtimeVideo = 0, kScreensharing = 1 };
+
+/// An SDP video format. |parameters| holds the a=fmtp key=value pairs
+/// separated by ';'. Longer strings are truncated.
+struct rtcVideoCodecFormat {
+  char name[32] = {};
+  char parameters[256] = {};
+};  // end struct rtcVideoCodecFormat
+
+/// Mirrors libwebrtc::RTCVideoEncoderSettings.
+struct rtcVideoEncoderSettings {
+  int width = 0;
+  int height = 0;
+  int max_framerate = 0;
+  int start_bitrate_kbps = 0;
+  int min_bitrate_kbps = 0;
+  int max_bitrate_kbps = 0;
+  int number_of_cores = 1;
+  rtcVideoCodecMode mode = rtcVideoCodecMode::kRealtimeVideo;
+};  // end struct rtcVideoEncoderSettings
+
+/// Mirrors libwebrtc::RTCVideoDecoderSettings.
+struct rtcVideoDecoderSettings {
+  int max_width = 0;
+  int max_height = 0;
+  int number_of_cores = 1;
+};  // end struct rtcVideoDecoderSettings
+
+/// Mirrors libwebrtc::RTCEncodedVideoImage. The data is borrowed for the
+/// duration of the call it is passed to.
+struct rtcEncodedVideoImage {
+  const unsigned char* data = nullptr;
+  int size = 0;
+  int width = 0;
+  int height = 0;
+  unsigned int rtp_timestamp = 0;
+  rtcTimestamp capture_time_ms = 0;
+  rtcBool32 key_frame = rtcBool32::kFalse;
+  int qp = -1;
+};  // end struct rtcEncodedVideoImage
+
 /// Opaque handle to a native interop object.
 using rtcObjectHandle = void*;
 
@@ -417,6 +568,10 @@ using rtcAudioDataHandle = rtcRefCountedObjectHandle;
 /// Opaque handle to a native RTCVideoRenderer interop object.
 using rtcVideoRendererHandle = rtcRefCountedObjectHandle;  // ???
 
+/// Opaque handle to a native RTCVideoFrameExport interop object.
+/// It is also a valid rtcVideoRendererHandle.
+using rtcVideoFrameExportHandle = rtcRefCountedObjectHandle;
+
 /// Opaque handle to a native RTCDataChannel interop object.
 using rtcDataChannelHandle = rtcRefCountedObjectHandle;
 
@@ -534,6 +689,17 @@ using rtcRtpTransceiverListHandle = rtcRefCountedObjectHandle;
 /// Opaque handle to a native RTCSessionDescription interop object.
 using rtcSessionDescriptionHandle = rtcRefCountedObjectHandle;
 
+/// Opaque handle to a native RTCStatsSampler interop object.
+using rtcStatsSamplerHandle = rtcRefCountedObjectHandle;
+
+/// Opaque handle to the native side of an external video encoder. Valid
+/// from the Create delegate until the Destroy delegate.
+using rtcVideoEncoderPluginHandle = rtcObjectHandle;
+
+/// Opaque handle to the native side of an external video decoder. Valid
+/// from the Create delegate until the Destroy delegate.
+using rtcVideoDecoderPluginHandle = rtcObjectHandle;
+
 /* ---------------------------------------------------------------- */
 
 /**
@@ -718,6 +884,9 @@ using rtcIceConnectionStateChangedDelegate = void(LIB_WEBRTC_CALL*)(
 using rtcIceCandidateReadytoSendDelegate = void(LIB_WEBRTC_CALL*)(
     rtcObjectHandle user_data, rtcIceCandidateHandle iceCandidate);
 
+using rtcIceCandidatesReadytoSendDelegate = void(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle user_data, const rtcIceCandidateHandle* iceCandidates, int count);
+
 using rtcStreamAddedRemovedDelegate = void(LIB_WEBRTC_CALL*)(
     rtcObjectHandle user_data, rtcMediaStreamHandle mediaStream);
 
@@ -753,6 +922,9 @@ struct rtcPeerConnectionObserverCallbacks {
   rtcTransceiverAddedDelegate TransceiverAdded{};
   rtcTrackAddedDelegate TrackAdded{};
   rtcTrackRemovedDelegate TrackRemoved{};
+  // Batched candidates (see ice_candidate_batch_size). When not set,
+  // IceCandidateReadytoSend is called for each candidate of the batch.
+  rtcIceCandidatesReadytoSendDelegate IceCandidatesReadytoSend{};
 }; // end struct rtcPeerConnectionObserverCallbacks
 
 /*-----------------------------------------------------------------*/
@@ -768,6 +940,95 @@ using rtcOnGetSdpSuccessDelegate = void(LIB_WEBRTC_CALL*)(
 
 using rtcOnSetSdpSuccessDelegate = void(LIB_WEBRTC_CALL*)(rtcObjectHandle user_data);
 
+using rtcStatsSamplerSummaryDelegate = void(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle user_data, const rtcStatsSummary* summaries, int count);
+
+/**
+ * Fills up to |max_formats| formats and returns the number filled.
+ */
+using rtcVideoCodecGetSupportedFormatsDelegate = int(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle user_data, rtcVideoCodecFormat* formats, int max_formats);
+
+/**
+ * Creates an external codec for |format|. The returned handle is passed to
+ * the other delegates of the codec; nullptr selects the builtin codec.
+ * |plugin| is the handle for delivering the output.
+ */
+using rtcVideoEncoderPluginCreateDelegate = rtcObjectHandle(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle user_data, const rtcVideoCodecFormat* format,
+    rtcVideoEncoderPluginHandle plugin);
+
+using rtcVideoDecoderPluginCreateDelegate = rtcObjectHandle(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle user_data, const rtcVideoCodecFormat* format,
+    rtcVideoDecoderPluginHandle plugin);
+
+/**
+ * Shutdown and Destroy delegate of an external codec.
+ */
+using rtcVideoCodecPluginCommonDelegate = void(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle codec);
+
+using rtcVideoEncoderPluginInitEncodeDelegate =
+    rtcVideoCodecStatus(LIB_WEBRTC_CALL*)(
+        rtcObjectHandle codec, const rtcVideoEncoderSettings* settings);
+
+/**
+ * |frame| is an I420 frame borrowed for the duration of the call; add a
+ * reference to keep it.
+ */
+using rtcVideoEncoderPluginEncodeDelegate =
+    rtcVideoCodecStatus(LIB_WEBRTC_CALL*)(
+        rtcObjectHandle codec, rtcVideoFrameHandle frame,
+        unsigned int rtp_timestamp, rtcBool32 key_frame);
+
+using rtcVideoEncoderPluginSetRatesDelegate = void(LIB_WEBRTC_CALL*)(
+    rtcObjectHandle codec, unsigned int bitrate_bps, double framerate_fps);
+
+using rtcVideoDecoderPluginInitDecodeDelegate =
+    rtcVideoCodecStatus(LIB_WEBRTC_CALL*)(
+        rtcObjectHandle codec, const rtcVideoDecoderSettings* settings);
+
+using rtcVideoDecoderPluginDecodeDelegate =
+    rtcVideoCodecStatus(LIB_WEBRTC_CALL*)(
+        rtcObjectHandle codec, const rtcEncodedVideoImage* image);
+
+/**
+ * Callback delegate structure for an external video encoder factory.
+ * Output goes back through RTCVideoEncoderPlugin_DeliverEncodedImage; the
+ * codec must not deliver after Shutdown returns.
+ */
+struct rtcVideoEncoderPluginFactoryCallbacks {
+  rtcObjectHandle UserData{};
+  /// Copied when the peer connection factory initializes.
+  const char* ImplementationName{};
+  rtcBool32 HardwareAccelerated{};
+  rtcVideoCodecGetSupportedFormatsDelegate GetSupportedFormats{};
+  rtcVideoEncoderPluginCreateDelegate Create{};
+  rtcVideoEncoderPluginInitEncodeDelegate InitEncode{};
+  rtcVideoEncoderPluginEncodeDelegate Encode{};
+  rtcVideoEncoderPluginSetRatesDelegate SetRates{};
+  rtcVideoCodecPluginCommonDelegate Shutdown{};
+  rtcVideoCodecPluginCommonDelegate Destroy{};
+};
+
+/**
+ * Callback delegate structure for an external video decoder factory.
+ * Output goes back through RTCVideoDecoderPlugin_DeliverDecodedFrame; the
+ * codec must not deliver after Shutdown returns.
+ */
+struct rtcVideoDecoderPluginFactoryCallbacks {
+  rtcObjectHandle UserData{};
+  /// Copied when the peer connection factory initializes.
+  const char* ImplementationName{};
+  rtcBool32 HardwareAccelerated{};
+  rtcVideoCodecGetSupportedFormatsDelegate GetSupportedFormats{};
+  rtcVideoDecoderPluginCreateDelegate Create{};
+  rtcVideoDecoderPluginInitDecodeDelegate InitDecode{};
+  rtcVideoDecoderPluginDecodeDelegate Decode{};
+  rtcVideoCodecPluginCommonDelegate Shutdown{};
+  rtcVideoCodecPluginCommonDelegate Destroy{};
+};
+
 /*
  * ----------------------------------------------------------------------
  * LibWebRTC interop methods
@@ -811,6 +1072,16 @@ LibWebRTC_CreateRTCPeerConnectionFactory(
  */
 LIB_WEBRTC_API void LIB_WEBRTC_CALL LibWebRTC_Terminate() noexcept;
 
+/**
+ * @brief Enables slice-parallel colour conversion of large frames.
+ *
+ * Frames of at least 'min_pixels' pixels are converted in horizontal bands
+ * on a shared pool of 'threads' - 1 workers plus the calling thread.
+ * A 'threads' value of 1 or less disables it.
+ */
+LIB_WEBRTC_API void LIB_WEBRTC_CALL
+LibWebRTC_SetParallelConversion(int threads, int min_pixels) noexcept;
+
 /**
  * @brief Returns the error message text for the specified 'code' value.
  */
@@ -879,6 +1150,20 @@ LIB_WEBRTC_API rtcBool32 LIB_WEBRTC_CALL RTCPeerConnectionFactory_Initialize(
     rtcBool32 use_dummy_audio = rtcBool32::kFalse
 ) noexcept;
 
+/**
+ * @brief Initializes the RTCPeerConnectionFactory object with external
+ * video codecs, used ahead of the builtin ones.
+ * A nullptr callbacks structure keeps the builtin codecs only.
+ * The structures are copied.
+ */
+LIB_WEBRTC_API rtcBool32 LIB_WEBRTC_CALL
+RTCPeerConnectionFactory_InitializeWithOptions(
+    rtcPeerConnectionFactoryHandle factory,
+    rtcBool32 use_dummy_audio,
+    const rtcVideoEncoderPluginFactoryCallbacks* encoder_callbacks,
+    const rtcVideoDecoderPluginFactoryCallbacks* decoder_callbacks
+) noexcept;
+
 /**
  * @brief Terminates the RTCPeerConnectionFactor object.
  */
@@ -1045,6 +1330,16 @@ RTCPeerConnectionFactory_GetUseDummyAudio(
     rtcPeerConnectionFactoryHandle factory,
     rtcBool32* pRetVal) noexcept;
 
+/**
+ * Selects the thread that calls the capturer and desktop media list
+ * observers. Capturers and media lists created afterwards use it; the
+ * media lists of the desktop device switch over at once.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnectionFactory_SetObserverThread(
+    rtcPeerConnectionFactoryHandle factory,
+    rtcObserverThread thread) noexcept;
+
 /*
  * ----------------------------------------------------------------------
  * RTCAudioData interop methods
@@ -1368,6 +1663,32 @@ LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCMediaTrack_GetKind(
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCMediaTrack_GetId(
     rtcMediaTrackHandle mediaTrack, char* pOutId, int cchOutId) noexcept;
 
+/**
+ * Returns the track kind without copying it. The characters are not
+ * null-terminated and stay valid while the track handle is held.
+ *
+ * @param mediaTrack - Media track handle
+ * @param pOutData - Receives a pointer to the characters
+ * @param pOutLength - Receives the number of characters
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCMediaTrack_GetKindView(
+    rtcMediaTrackHandle mediaTrack, const char** pOutData,
+    int* pOutLength) noexcept;
+
+/**
+ * Returns the track id without copying it. The characters are not
+ * null-terminated and stay valid while the track handle is held.
+ *
+ * @param mediaTrack - Media track handle
+ * @param pOutData - Receives a pointer to the characters
+ * @param pOutLength - Receives the number of characters
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCMediaTrack_GetIdView(
+    rtcMediaTrackHandle mediaTrack, const char** pOutData,
+    int* pOutLength) noexcept;
+
 /**
  * Returns the enable/disable status of the track.
  *
@@ -1614,6 +1935,17 @@ RTCVideoFrame_GetStrideV(
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCVideoFrame_GetRotation(
     rtcVideoFrameHandle videoFrame, rtcVideoRotation* pOutRetVal) noexcept;
 
+/**
+ * Returns the size, rotation, timestamp, plane pointers and strides of the
+ * video frame in one call.
+ *
+ * @param videoFrame - Source video frame handle
+ * @param pOutInfo - Receives the frame description.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL RTCVideoFrame_GetInfo(
+    rtcVideoFrameHandle videoFrame, rtcVideoFrameInfo* pOutInfo) noexcept;
+
 /**
  * Returns a timestamp in microseconds.
  *
@@ -1738,6 +2070,56 @@ LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCVideoRenderer_UnRegisterFrameCallback(
     rtcVideoRendererHandle videoRenderer) noexcept;
 
+/**
+ * Enables reading the latency watermark written by dummy video capturers
+ * with RTCDummyVideoCapturer_SetLatencyWatermark. Enabling it clears the
+ * statistics.
+ *
+ * @param videoRenderer - Video renderer handle.
+ * @param enable - kTrue to measure.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_SetLatencyMeasurement(
+    rtcVideoRendererHandle videoRenderer, rtcBool32 enable) noexcept;
+
+/**
+ * Copies the latency, frame loss and freeze statistics of the renderer.
+ *
+ * @param videoRenderer - Video renderer handle.
+ * @param stats - Receives the statistics.
+ * @param pOutRetVal - kFalse if the renderer is not measuring.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_GetLatencyStats(
+    rtcVideoRendererHandle videoRenderer, rtcVideoLatencyStats* stats,
+    rtcBool32* pOutRetVal) noexcept;
+
+/**
+ * Copies the latency in microseconds of the newest frames, oldest first.
+ *
+ * @param videoRenderer - Video renderer handle.
+ * @param latencies - Receives up to max_frames values.
+ * @param max_frames - Size of the latencies array.
+ * @param pOutRetVal - Number of values copied.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_GetFrameLatencies(
+    rtcVideoRendererHandle videoRenderer, long long* latencies,
+    int max_frames, int* pOutRetVal) noexcept;
+
+/**
+ * Clears the latency statistics of the renderer.
+ *
+ * @param videoRenderer - Video renderer handle.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_ResetLatencyStats(
+    rtcVideoRendererHandle videoRenderer) noexcept;
+
 #if defined(DEBUG) || defined(_DEBUG)
 /**
  * It is used for testing purposes to trigger
@@ -1752,6 +2134,53 @@ RTCVideoRenderer_FireOnFrame(rtcVideoRendererHandle videoRenderer,
                              rtcVideoFrameHandle videoFrame) noexcept;
 #endif  // DEBUG or _DEBUG
 
+/*
+ * ----------------------------------------------------------------------
+ * RTCVideoFrameExport interop methods
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * Creates a video renderer that publishes the frames it receives in the
+ * named shared memory (see rtc_video_frame_export.h for the layout).
+ * The handle can be used wherever a video renderer handle is expected.
+ *
+ * @param name - Shared memory name.
+ * @param format - Pixel format written to the slots.
+ * @param max_width - Largest frame width; larger frames are scaled down.
+ * @param max_height - Largest frame height; larger frames are scaled down.
+ * @param slot_count - Number of frame slots in the ring.
+ * @param pOutRetVal - Frame export handle.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_Create(const char* name,
+                           rtcVideoFrameExportFormat format, int max_width,
+                           int max_height, int slot_count,
+                           rtcVideoFrameExportHandle* pOutRetVal) noexcept;
+
+/**
+ * Returns the size of the shared memory in bytes.
+ *
+ * @param handle - Frame export handle.
+ * @param pOutRetVal - Mapping size.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_GetMappingSize(rtcVideoFrameExportHandle handle,
+                                   unsigned long long* pOutRetVal) noexcept;
+
+/**
+ * Returns the number of frames written to the shared memory.
+ *
+ * @param handle - Frame export handle.
+ * @param pOutRetVal - Frame count.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_GetFramesWritten(rtcVideoFrameExportHandle handle,
+                                     unsigned long long* pOutRetVal) noexcept;
+
 /*
  * ----------------------------------------------------------------------
  * RTCVideoTrack interop methods
@@ -1834,6 +2263,20 @@ LIB_WEBRTC_API int LIB_WEBRTC_CALL RTCDesktopMediaList_UpdateSourceList(
     rtcBool32 force_reload = rtcBool32::kFalse,
     rtcBool32 get_thumbnail = rtcBool32::kTrue) noexcept;
 
+/**
+ * Updates media sources and their thumbnails. The sources are scaled
+ * down to the thumbnail size before they are converted or encoded.
+ *
+ * @param hMediaList - Desktop media list handle
+ * @param force_reload - Force reloads media sources.
+ * @param options - Thumbnail size and format.
+ * @return int - Returns the number of sources, or -1.
+ */
+LIB_WEBRTC_API int LIB_WEBRTC_CALL
+RTCDesktopMediaList_UpdateSourceListWithOptions(
+    rtcDesktopMediaListHandle hMediaList, rtcBool32 force_reload,
+    const rtcThumbnailOptions* options) noexcept;
+
 /**
  * Returns the current number of media sources.
  *
@@ -1867,6 +2310,30 @@ LIB_WEBRTC_API rtcBool32 LIB_WEBRTC_CALL RTCDesktopMediaList_GetThumbnail(
     rtcDesktopMediaListHandle hMediaList, rtcDesktopMediaSourceHandle hSource,
     rtcBool32 notify = rtcBool32::kFalse) noexcept;
 
+/**
+ * Refreshes the thumbnails of the listed sources periodically. Only
+ * changed thumbnails are encoded and notified.
+ *
+ * @param hMediaList - Desktop media list handle
+ * @param interval_ms - Refresh interval, 250 ms at least.
+ * @param options - Thumbnail size and format.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCDesktopMediaList_StartThumbnailRefresh(
+    rtcDesktopMediaListHandle hMediaList, int interval_ms,
+    const rtcThumbnailOptions* options) noexcept;
+
+/**
+ * Stops the periodic thumbnail refresh.
+ *
+ * @param hMediaList - Desktop media list handle
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCDesktopMediaList_StopThumbnailRefresh(
+    rtcDesktopMediaListHandle hMediaList) noexcept;
+
 /*
  * ----------------------------------------------------------------------
  * MediaSource interop methods
@@ -1898,7 +2365,34 @@ LIB_WEBRTC_API rtcBool32 LIB_WEBRTC_CALL
 MediaSource_UpdateThumbnail(rtcDesktopMediaSourceHandle mediaSource) noexcept;
 
 /**
- * Returns the thumbnail of the media source, jpeg format.
+ * Updates the media source thumbnail with the given size and format.
+ *
+ * @param mediaSource - Media source handle
+ * @param options - Thumbnail size and format.
+ * @return rtcBool32 - kTrue if successful, otherwise kFalse
+ */
+LIB_WEBRTC_API rtcBool32 LIB_WEBRTC_CALL MediaSource_UpdateThumbnailWithOptions(
+    rtcDesktopMediaSourceHandle mediaSource,
+    const rtcThumbnailOptions* options) noexcept;
+
+/**
+ * Returns the size and format of the current thumbnail. RGBA thumbnails
+ * are width * height * 4 bytes without row padding.
+ *
+ * @param mediaSource - Media source handle
+ * @param pOutWidth - Thumbnail width.
+ * @param pOutHeight - Thumbnail height.
+ * @param pOutFormat - Thumbnail format.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+MediaSource_GetThumbnailInfo(rtcDesktopMediaSourceHandle mediaSource,
+                             int* pOutWidth, int* pOutHeight,
+                             rtcThumbnailFormat* pOutFormat) noexcept;
+
+/**
+ * Returns the thumbnail of the media source, in the format given by
+ * MediaSource_GetThumbnailInfo (jpeg by default).
  * At the end of the process, the 'refSizeOfBuffer' value
  * gives the actual size of the buffer area.
  *
@@ -2052,6 +2546,22 @@ RTCDummyVideoCapturer_GetState(
     rtcCaptureState* pOutRetVal
 ) noexcept;
 
+/**
+ * Paints the capture time and a sequence number into every frame, for
+ * renderers with RTCVideoRenderer_SetLatencyMeasurement to read.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCDummyVideoCapturer_SetLatencyWatermark(
+    rtcDummyVideoCapturerHandle handle,
+    rtcBool32 enable
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCDummyVideoCapturer_GetLatencyWatermark(
+    rtcDummyVideoCapturerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept;
+
 /*
  * ----------------------------------------------------------------------
  * RTCDataChannel interop methods
@@ -2089,6 +2599,16 @@ RTCDataChannel_GetLabel(
     int label_size
 ) noexcept;
 
+/**
+ * Returns the label without copying it; valid while the handle is held.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCDataChannel_GetLabelView(
+    rtcDataChannelHandle dataChannel,
+    const char** pOutData,
+    int* pOutLength
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCDataChannel_GetId(
     rtcDataChannelHandle dataChannel,
@@ -2183,6 +2703,27 @@ RTCIceCandidate_GetSdpMid(
     int sz_value
 ) noexcept;
 
+/**
+ * Returns the candidate line without copying it; valid while the handle
+ * is held.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCIceCandidate_GetCandidateView(
+    rtcIceCandidateHandle iceCandidate,
+    const char** pOutData,
+    int* pOutLength
+) noexcept;
+
+/**
+ * Returns the sdp mid without copying it; valid while the handle is held.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCIceCandidate_GetSdpMidView(
+    rtcIceCandidateHandle iceCandidate,
+    const char** pOutData,
+    int* pOutLength
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCIceCandidate_GetSdpMlineIndex(
     rtcIceCandidateHandle iceCandidate,
@@ -2415,6 +2956,17 @@ RTCRtpCodecCapability_GetMimeType(
     int sz_value
 ) noexcept;
 
+/**
+ * Returns the mime type without copying it; valid until the next
+ * setter call on the same handle.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpCodecCapability_GetMimeTypeView(
+    rtcRtpCodecCapabilityHandle handle,
+    const char** pOutData,
+    int* pOutLength
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpCodecCapability_SetMimeType(
     rtcRtpCodecCapabilityHandle handle,
@@ -2452,6 +3004,17 @@ RTCRtpCodecCapability_GetSdpFmtpLine(
     int sz_value
 ) noexcept;
 
+/**
+ * Returns the fmtp line without copying it; valid until the next
+ * setter call on the same handle.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpCodecCapability_GetSdpFmtpLineView(
+    rtcRtpCodecCapabilityHandle handle,
+    const char** pOutData,
+    int* pOutLength
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpCodecCapability_SetSdpFmtpLine(
     rtcRtpCodecCapabilityHandle handle,
@@ -3129,6 +3692,15 @@ RTCRtcpParametersList_GetItem (
      rtcRtpEncodingParametersHandle* pOutRetVal
  ) noexcept;
 
+/**
+ * Reads every field of the encoding parameters in one call.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpEncodingParameters_GetAll (
+    rtcRtpEncodingParametersHandle handle,
+    rtcRtpEncodingParametersInfo* pOutInfo
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpEncodingParameters_GetSSRC (
     rtcRtpEncodingParametersHandle handle,
@@ -3622,6 +4194,24 @@ RTCRtpSender_GetParameters (
     rtcRtpParametersHandle* pOutRetVal
 ) noexcept;
 
+/**
+ * Reads the sender parameters and up to max_encodings of its encodings
+ * without creating any handles.
+ *
+ * @param handle - Sender handle
+ * @param pOutSnapshot - Receives the sender level values.
+ * @param encodings - Receives the encodings; may be null.
+ * @param max_encodings - Capacity of encodings.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpSender_GetParametersSnapshot (
+    rtcRtpSenderHandle handle,
+    rtcRtpSenderParametersSnapshot* pOutSnapshot,
+    rtcRtpEncodingParametersInfo* encodings,
+    int max_encodings
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpSender_SetParameters (
     rtcRtpSenderHandle handle,
@@ -3875,6 +4465,96 @@ RTCMediaRTCStatsList_GetItem (
     rtcMediaRTCStatsHandle* pOutRetVal
 ) noexcept;
 
+/*
+ * ----------------------------------------------------------------------
+ * RTCStatsSampler interop methods
+ * ----------------------------------------------------------------------
+ */
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Start (
+    rtcStatsSamplerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Stop (
+    rtcStatsSamplerHandle handle
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_IsRunning (
+    rtcStatsSamplerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Clear (
+    rtcStatsSamplerHandle handle
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetFieldCount (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetCapacity (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept;
+
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetSampleCount (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept;
+
+/**
+ * @brief Copies the sampled history in one call.
+ *
+ * Copies the newest max_samples samples, oldest first. timestamps receives
+ * one value (microseconds) per sample, values receives field count values
+ * per sample; NaN marks a field that was not available. Either buffer may be
+ * nullptr.
+ *
+ * @param pOutRetVal - Receives the number of samples copied.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetHistory (
+    rtcStatsSamplerHandle handle,
+    rtcTimestamp* timestamps,
+    double* values,
+    int max_samples,
+    int* pOutRetVal
+) noexcept;
+
+/**
+ * @brief Summarises the sampled history per field (min, max, mean, last).
+ *
+ * @param pOutRetVal - Receives the number of summaries written.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetSummary (
+    rtcStatsSamplerHandle handle,
+    rtcStatsSummary* summaries,
+    int max_fields,
+    int* pOutRetVal
+) noexcept;
+
+/**
+ * @brief Calls callback with the per-field summary after every every_samples
+ * new samples. A nullptr callback disables it.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_SetSummaryCallback (
+    rtcStatsSamplerHandle handle,
+    int every_samples,
+    rtcObjectHandle user_data,
+    rtcStatsSamplerSummaryDelegate callback
+) noexcept;
+
 /*
  * ----------------------------------------------------------------------
  * RTCPeerConnection interop methods
@@ -4039,6 +4719,45 @@ RTCPeerConnection_GetStats (
     rtcOnFailureDelegate failure
 ) noexcept;
 
+/**
+ * @brief Collects only the requested part of the stats report.
+ *
+ * @param stats_types - '\n' separated stats types (e.g. "inbound-rtp"),
+ *                      nullptr or empty for all types.
+ * @param member_names - '\n' separated member names, nullptr or empty for all.
+ * @param delta - kTrue to return only the members changed since the previous
+ *                delta call, plus the computed rate members.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnection_GetFilteredStats (
+    rtcPeerConnectionHandle handle,
+    const char* stats_types,
+    const char* member_names,
+    rtcBool32 delta,
+    rtcObjectHandle user_data,
+    rtcOnStatsCollectorSuccessDelegate success,
+    rtcOnFailureDelegate failure
+) noexcept;
+
+/**
+ * @brief Creates a periodic stats sampler for the peer connection.
+ *
+ * @param interval_ms - Sampling interval in milliseconds.
+ * @param history_size - Number of samples kept in the history.
+ * @param fields - '\n' separated "type.member" fields, e.g.
+ *                 "inbound-rtp.bytesReceived". A "/s" suffix records the
+ *                 per-second rate of the member instead of its value. Each
+ *                 field sums the member over all stats of that type.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnection_CreateStatsSampler (
+    rtcPeerConnectionHandle handle,
+    int interval_ms,
+    int history_size,
+    const char* fields,
+    rtcStatsSamplerHandle* pOutRetVal
+) noexcept;
+
 LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
 RTCPeerConnection_AddTransceiver1 (
     rtcPeerConnectionHandle handle,
@@ -4124,6 +4843,42 @@ RTCPeerConnection_GetIceGatheringState (
     rtcIceGatheringState* pOutRetVal
 ) noexcept;
 
+/*
+ * ----------------------------------------------------------------------
+ * RTCVideoEncoderPlugin / RTCVideoDecoderPlugin interop methods
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * Hands an encoded frame of an external encoder to the RTP sender.
+ * Can be called from any thread, one frame at a time.
+ *
+ * @param plugin - Handle passed to the Create delegate.
+ * @param image - The frame; the data is copied.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoEncoderPlugin_DeliverEncodedImage(
+    rtcVideoEncoderPluginHandle plugin,
+    const rtcEncodedVideoImage* image
+) noexcept;
+
+/**
+ * Hands a decoded frame of an external decoder to the renderers.
+ * Can be called from any thread.
+ *
+ * @param plugin - Handle passed to the Create delegate.
+ * @param frame - The decoded frame; a reference is added.
+ * @param rtp_timestamp - Timestamp of the image it was decoded from.
+ * @return rtcResultU4 - 0 if successful, otherwise an error code.
+ */
+LIB_WEBRTC_API rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoDecoderPlugin_DeliverDecodedFrame(
+    rtcVideoDecoderPluginHandle plugin,
+    rtcVideoFrameHandle frame,
+    unsigned int rtp_timestamp
+) noexcept;
+
 }  // extern "C"
 
 #endif  // LIB_WEBRTC_INTROP_API_HXX
\ No newline at end of file
@@ -1,6 +1,10 @@
 #ifndef LIB_WEBRTC_INTROP_MACROS_HXX
 #define LIB_WEBRTC_INTROP_MACROS_HXX
 
+// The macros below borrow |handle| through a raw pointer: the caller owns a
+// reference for the duration of the call, so taking another one would only
+// cost an AddRef/Release pair.
+
 #define CHECK_POINTER_EX(p, r) \
   if ((p) == nullptr) {        \
     return (r);                \
@@ -40,25 +44,38 @@
 #define DECLARE_GET_STRING(handle, value, sz_value, class_name, fun_name) \
   CHECK_NATIVE_HANDLE(handle);                                            \
   CHECK_AND_ZERO_MEMORY(value, sz_value);                                 \
-  scoped_refptr<class_name> p = static_cast<class_name*>(handle);         \
+  class_name* p = static_cast<class_name*>(handle);                       \
   string strValue = p->fun_name();                                        \
   size_t len = strValue.copy_to(value, static_cast<size_t>(sz_value));    \
   return strValue.size() > len ? rtcResultU4::kBufferTooSmall             \
                                : rtcResultU4::kSuccess;
 
+#define DECLARE_GET_STRING_VIEW(handle, out_data, out_length, class_name, \
+                                fun_name)                                 \
+  CHECK_POINTER(out_data);                                                \
+  *(out_data) = nullptr;                                                  \
+  CHECK_POINTER(out_length);                                              \
+  *(out_length) = 0;                                                      \
+  CHECK_NATIVE_HANDLE(handle);                                            \
+  class_name* p = static_cast<class_name*>(handle);                       \
+  string_view view = p->fun_name();                                       \
+  *(out_data) = view.data();                                              \
+  *(out_length) = static_cast<int>(view.size());                          \
+  return rtcResultU4::kSuccess;
+
 #define DECLARE_GET_VALUE(handle, value, value_type_name, class_name, \
                           fun_name)                                   \
   CHECK_POINTER(value);                                               \
   *(value) = static_cast<value_type_name>(0);                         \
   CHECK_NATIVE_HANDLE(handle);                                        \
-  scoped_refptr<class_name> p = static_cast<class_name*>(handle);     \
+  class_name* p = static_cast<class_name*>(handle);                   \
   *(value) = static_cast<value_type_name>(p->fun_name());             \
   return rtcResultU4::kSuccess;
 
 #define DECLARE_SET_VALUE(handle, value, value_type_name, class_name, \
                           fun_name)                                   \
   CHECK_NATIVE_HANDLE(handle);                                        \
-  scoped_refptr<class_name> p = static_cast<class_name*>(handle);     \
+  class_name* p = static_cast<class_name*>(handle);                   \
   p->fun_name(static_cast<value_type_name>(value));                   \
   return rtcResultU4::kSuccess;
 
@@ -66,7 +83,7 @@
                                 owner_class_name, list_class_name, fun_name)  \
   CHECK_OUT_POINTER(value);                                                   \
   CHECK_NATIVE_HANDLE(handle);                                                \
-  scoped_refptr<owner_class_name> p = static_cast<owner_class_name*>(handle); \
+  owner_class_name* p = static_cast<owner_class_name*>(handle);               \
   scoped_refptr<list_class_name> pList =                                      \
       list_class_name::Create(p->fun_name());                                 \
   if (pList == nullptr) {                                                     \
@@ -78,15 +95,14 @@
 #define DECLARE_SET_LIST_HANDLE(handle, value, owner_class_name,               \
                                 list_class_name, fun_name)                     \
   CHECK_NATIVE_HANDLE(handle);                                                 \
-  scoped_refptr<owner_class_name> pOwner =                                     \
-      static_cast<owner_class_name*>(handle);                                  \
-  scoped_refptr<list_class_name> pList = static_cast<list_class_name*>(value); \
+  owner_class_name* pOwner = static_cast<owner_class_name*>(handle);           \
+  list_class_name* pList = static_cast<list_class_name*>(value);               \
   pOwner->fun_name(pList->to_vector());                                        \
   return rtcResultU4::kSuccess;
 
 #define DECLARE_LIST_GET_COUNT(handle, list_type_name)                        \
   CHECK_POINTER_EX(handle, 0);                                                \
-  scoped_refptr<list_type_name> pList = static_cast<list_type_name*>(handle); \
+  list_type_name* pList = static_cast<list_type_name*>(handle);               \
   return static_cast<int>(pList->count());
 
 #define DECLARE_LIST_GET_ITEM(handle, index, out_val, out_val_type_name,      \
@@ -96,7 +112,7 @@
   if (static_cast<int>(index) < 0) {                                          \
     return rtcResultU4::kOutOfRange;                                          \
   }                                                                           \
-  scoped_refptr<list_type_name> pList = static_cast<list_type_name*>(handle); \
+  list_type_name* pList = static_cast<list_type_name*>(handle);               \
   if (static_cast<size_t>(index) >= pList->count()) {                         \
     return rtcResultU4::kOutOfRange;                                          \
   }                                                                           \
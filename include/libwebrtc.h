@@ -43,6 +43,16 @@ class LibWebRTC {
   LIB_WEBRTC_API static scoped_refptr<RTCPeerConnectionFactory>
   CreateRTCPeerConnectionFactory(bool use_dummy_audio = false);
 
+  /**
+   * @brief Creates a new WebRTC PeerConnectionFactory with |options|.
+   *
+   * Same as above; |options| can also plug in external video encoders and
+   * decoders, see RTCPeerConnectionFactoryOptions.
+   */
+  LIB_WEBRTC_API static scoped_refptr<RTCPeerConnectionFactory>
+  CreateRTCPeerConnectionFactory(
+      const RTCPeerConnectionFactoryOptions& options);
+
   /**
    * @brief Terminates the WebRTC PeerConnectionFactory and threads.
    *
@@ -53,6 +63,21 @@ class LibWebRTC {
    *
    */
   LIB_WEBRTC_API static void Terminate();
+
+  /**
+   * @brief Enables slice-parallel colour conversion of large frames.
+   *
+   * Frame conversions and scaling done by the library (RTCVideoFrame
+   * ConvertToARGB and ScaleFrom, desktop capture) split frames of at least
+   * |min_pixels| pixels into horizontal bands and convert them on a shared
+   * pool of |threads| - 1 worker threads plus the calling thread. Disabled
+   * by default; a |threads| value of 1 or less disables it again.
+   *
+   * @param threads Number of threads converting a frame.
+   * @param min_pixels Smallest frame, in pixels, converted in parallel.
+   */
+  LIB_WEBRTC_API static void SetParallelConversion(
+      int threads, int min_pixels = 2560 * 1440);
 };
 
 }  // namespace libwebrtc
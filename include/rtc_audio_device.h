@@ -12,7 +12,8 @@ namespace libwebrtc {
  */
 class RTCAudioDevice : public RefCountInterface {
  public:
-  typedef fixed_size_function<void()> OnDeviceChangeCallback;
+  typedef fixed_size_function<void(), kResultCallbackSize>
+      OnDeviceChangeCallback;
 
  public:
   static const int kAdmMaxDeviceNameSize = 128;
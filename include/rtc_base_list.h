@@ -1,6 +1,11 @@
 #ifndef LIB_WEBRTC_RTC_BASE_LIST_HXX
 #define LIB_WEBRTC_RTC_BASE_LIST_HXX
 
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
 #include "rtc_types.h"
 
 namespace libwebrtc {
@@ -28,6 +33,13 @@ class RTCBasePair : public RefCountInterface {
   const TVal& value() const { return value_; }
 }; // end class RTCBasePair
 
+/**
+ * class RTCBaseList
+ *
+ * Immutable snapshot of a vector. The items live in one block that is
+ * allocated once and released with the list; they are constructed in place,
+ * moved from the source when it is an rvalue.
+ */
 template <typename T>
 class RTCBaseList : public RefCountInterface {
  protected:
@@ -41,28 +53,31 @@ class RTCBaseList : public RefCountInterface {
   RTCBaseList() : m_items(0), m_count(0) {}
 
   RTCBaseList(const vector<T>& o) : m_items(0), m_count(0) {
-    m_count = o.size();
-    if (m_count != 0) {
-      m_items = new T[m_count];
-      for (size_t i = 0; i < m_count; ++i) {
-        m_items[i] = o[i];
+    if (o.size() != 0) {
+      m_items = allocate(o.size());
+      for (; m_count < o.size(); ++m_count) {
+        new (&m_items[m_count]) T(o[m_count]);
       }
     }
   }
 
-  vector<T> to_vector() const { 
-    if (m_count == 0) {
-      return vector<T>();
-    }
-    else {
-      T* items = new T[m_count];
-      for (size_t i = 0; i < m_count; ++i) {
-        items[i] = m_items[i];
-      } 
-      return vector<T>(items, m_count);
+  RTCBaseList(vector<T>&& o) : m_items(0), m_count(0) {
+    if (o.size() != 0) {
+      m_items = allocate(o.size());
+      for (; m_count < o.size(); ++m_count) {
+        new (&m_items[m_count]) T(std::move(o[m_count]));
+      }
+      o.clear();
     }
   }
 
+  RTCBaseList(const RTCBaseList&) = delete;
+  RTCBaseList& operator=(const RTCBaseList&) = delete;
+
+  vector<T> to_vector() const {
+    return vector<T>(static_cast<const T*>(m_items), m_count);
+  }
+
   ~RTCBaseList() { destroy_all(); }
 
  public:
@@ -81,9 +96,55 @@ class RTCBaseList : public RefCountInterface {
     for (size_t i = 0; i < m_count; ++i) {
       destroy(&m_items[i]);
     }
+    deallocate(m_items);
     m_items = 0;
     m_count = 0;
   }
+
+ private:
+#if defined(__cpp_aligned_new)
+  static constexpr bool over_aligned =
+      alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else
+  // Before C++17 over-aligned storage is aligned by hand. The block is
+  // over-allocated by alignof(T), which leaves at least
+  // alignof(std::max_align_t) bytes before the items for its address.
+  static constexpr bool over_aligned =
+      alignof(T) > alignof(std::max_align_t);
+#endif
+
+  static T* allocate(size_t n) {
+    size_t bytes = n * sizeof(T);
+    if (!over_aligned) {
+      return static_cast<T*>(::operator new(bytes));
+    }
+#if defined(__cpp_aligned_new)
+    return static_cast<T*>(
+        ::operator new(bytes, std::align_val_t(alignof(T))));
+#else
+    char* block = static_cast<char*>(::operator new(bytes + alignof(T)));
+    T* items = reinterpret_cast<T*>(
+        (reinterpret_cast<uintptr_t>(block) + alignof(T)) &
+        ~static_cast<uintptr_t>(alignof(T) - 1));
+    reinterpret_cast<void**>(items)[-1] = block;
+    return items;
+#endif
+  }
+
+  static void deallocate(T* items) {
+    if (items == 0) {
+      return;
+    }
+    if (!over_aligned) {
+      ::operator delete(items);
+    } else {
+#if defined(__cpp_aligned_new)
+      ::operator delete(items, std::align_val_t(alignof(T)));
+#else
+      ::operator delete(reinterpret_cast<void**>(items)[-1]);
+#endif
+    }
+  }
 };  // end class RTCBaseList
 
 }  // namespace libwebrtc
@@ -108,6 +108,12 @@ class RTCDataChannel : public RefCountInterface {
    */
   virtual RTCDataChannelState state() = 0;
 
+  /**
+   * Returns the label without copying it. The view is valid for the
+   * lifetime of the data channel.
+   */
+  virtual string_view label_view() const = 0;
+
  protected:
   virtual ~RTCDataChannel() {}
 };
@@ -62,6 +62,8 @@ class RTCDesktopCapturer : public RefCountInterface {
 
   /**
    * @brief Stops desktop capture.
+   *
+   * A started capturer keeps itself alive until this is called.
    */
   virtual void Stop() = 0;
 
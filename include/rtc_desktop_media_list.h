@@ -5,6 +5,20 @@
 
 namespace libwebrtc {
 
+/**
+ * struct ThumbnailOptions
+ *
+ * The captured source is scaled down to fit within max_width x max_height,
+ * keeping its aspect ratio, before it is converted or encoded. A size of
+ * zero keeps the captured size.
+ */
+struct ThumbnailOptions {
+  int max_width = 0;
+  int max_height = 0;
+  ThumbnailFormat format = ThumbnailFormat::kJpeg;
+  int jpeg_quality = 75;
+};
+
 class MediaSource : public RefCountInterface {
  public:
   // source id
@@ -13,13 +27,21 @@ class MediaSource : public RefCountInterface {
   // source name
   virtual string name() const = 0;
 
-  // Returns the thumbnail of the source, jpeg format.
+  // Returns the thumbnail of the source, in thumbnail_format().
   virtual portable::vector<unsigned char> thumbnail() const = 0;
 
   virtual DesktopType type() const = 0;
 
+  // Captures a full-size JPEG thumbnail.
   virtual bool UpdateThumbnail() = 0;
 
+  // Size and encoding of the current thumbnail.
+  virtual int thumbnail_width() const = 0;
+  virtual int thumbnail_height() const = 0;
+  virtual ThumbnailFormat thumbnail_format() const = 0;
+
+  virtual bool UpdateThumbnailWithOptions(const ThumbnailOptions& options) = 0;
+
  protected:
   virtual ~MediaSource() {}
 };
@@ -57,6 +79,23 @@ class RTCDesktopMediaList : public RefCountInterface {
   virtual bool GetThumbnail(scoped_refptr<MediaSource> source,
                             bool notify = false) = 0;
 
+  // Updates the list and the thumbnails of every source with |options|.
+  virtual int32_t UpdateSourceListWithOptions(
+      bool force_reload, const ThumbnailOptions& options) = 0;
+
+  // Returns false if a thumbnail of |source| is already being captured.
+  virtual bool GetThumbnailWithOptions(scoped_refptr<MediaSource> source,
+                                       const ThumbnailOptions& options,
+                                       bool notify = false) = 0;
+
+  // Refreshes the thumbnails of the listed sources every |interval_ms|
+  // (250 ms at least) until stopped. Only thumbnails whose image changed
+  // are re-encoded and notified; sources still being encoded are skipped.
+  virtual void StartThumbnailRefresh(int interval_ms,
+                                     const ThumbnailOptions& options) = 0;
+
+  virtual void StopThumbnailRefresh() = 0;
+
  protected:
   ~RTCDesktopMediaList() {}
 };
@@ -57,6 +57,15 @@ class RTCDummyVideoCapturer : public RefCountInterface {
 
   virtual DummyVideoCapturerObserver* GetObserver() = 0;
 
+  /**
+   * Paints the capture time and a sequence number into the top quarter of
+   * every frame, after OnFillBuffer(), for renderers with
+   * SetLatencyMeasurement(true) to read. Off by default.
+   */
+  virtual void SetLatencyWatermark(bool enable) = 0;
+
+  virtual bool GetLatencyWatermark() const = 0;
+
   virtual ~RTCDummyVideoCapturer() {}
 }; // class RTCDummyVideoCapturer
 
@@ -41,6 +41,15 @@ struct KeyProviderOptions {
         key_ring_size(copy.key_ring_size) {}
 };
 
+/// One key of a KeyProvider::SetKeys() call. The pointers are only read
+/// during the call.
+struct KeyProviderEntry {
+  const char* participant_id;
+  int index;
+  const uint8_t* key;
+  int key_size;
+};
+
 /// Shared secret key for frame encryption.
 class KeyProvider : public RefCountInterface {
  public:
@@ -64,6 +73,13 @@ class KeyProvider : public RefCountInterface {
 
   virtual void SetSifTrailer(vector<uint8_t> trailer) = 0;
 
+  /// Set many keys at once, e.g. a key rotation of a whole room. Frames
+  /// keep being encrypted and decrypted with the current keys meanwhile;
+  /// only the participant whose key is being derived waits for it.
+  /// Returns the number of keys set; entries with an index outside the
+  /// key ring are skipped.
+  virtual int SetKeys(const KeyProviderEntry* entries, int count) = 0;
+
  protected:
   virtual ~KeyProvider() {}
 };
@@ -115,8 +131,48 @@ class RTCFrameCryptor : public RefCountInterface {
   virtual ~RTCFrameCryptor() {}
 };
 
+/// How frame cryptors are spread over the crypto queues.
+enum class FrameCryptorSharding {
+  /// All cryptors of a participant share a queue.
+  kByParticipant = 0,
+  /// Each cryptor goes to the queue with the fewest cryptors.
+  kByTrack,
+};
+
+struct FrameCryptorPoolOptions {
+  /// Number of crypto queues; 0 picks one per two cores, at most 8.
+  int queue_count = 0;
+  FrameCryptorSharding sharding = FrameCryptorSharding::kByParticipant;
+};
+
+/// Load of one crypto queue since it was created.
+struct FrameCryptorQueueStats {
+  int transformers;
+  uint64_t frames;
+  uint64_t bytes;
+  /// Time frames waited in the queue before being transformed.
+  int64_t queue_delay_avg_us;
+  int64_t queue_delay_max_us;
+  /// Time spent transforming frames.
+  int64_t busy_us;
+};
+
 class FrameCryptorFactory {
  public:
+  /// Replaces the pool of crypto queues that frame cryptors created
+  /// afterwards transform frames on. Existing cryptors keep their queue.
+  /// Without a call, a default pool is created with the first cryptor.
+  LIB_WEBRTC_API static void SetCryptoQueuePool(
+      scoped_refptr<RTCPeerConnectionFactory> factory,
+      const FrameCryptorPoolOptions& options);
+
+  /// Copies the load of the current pool's queues into |stats|, up to
+  /// |max_queues| entries. Returns the number of entries written, 0 if no
+  /// pool has been created yet.
+  LIB_WEBRTC_API static int GetCryptoQueueStats(
+      scoped_refptr<RTCPeerConnectionFactory> factory,
+      FrameCryptorQueueStats* stats, int max_queues);
+
   /// Create a frame cyrptor for [RTCRtpSender].
   LIB_WEBRTC_API static scoped_refptr<RTCFrameCryptor>
   frameCryptorFromRtpSender(scoped_refptr<RTCPeerConnectionFactory> factory,
@@ -21,6 +21,14 @@ class RTCIceCandidate : public RefCountInterface {
 
   virtual bool ToString(string& out) = 0;
 
+  /**
+   * candidate() and sdp_mid() without a copy; valid for the lifetime of
+   * the object.
+   */
+  virtual string_view candidate_view() const = 0;
+
+  virtual string_view sdp_mid_view() const = 0;
+
  protected:
   virtual ~RTCIceCandidate() {}
 };
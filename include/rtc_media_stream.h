@@ -46,11 +46,18 @@ class RTCMediaStreamList : public RTCBaseList<scoped_refptr<RTCMediaStream>> {
   LIB_WEBRTC_API static scoped_refptr<RTCMediaStreamList> Create(
     const vector<scoped_refptr<RTCMediaStream>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCMediaStreamList> Create(
+    vector<scoped_refptr<RTCMediaStream>>&& source);
+
  protected:
   RTCMediaStreamList(const vector<scoped_refptr<RTCMediaStream>>& source)
     : RTCBaseList<scoped_refptr<RTCMediaStream>>(source)
   {}
 
+  RTCMediaStreamList(vector<scoped_refptr<RTCMediaStream>>&& source)
+    : RTCBaseList<scoped_refptr<RTCMediaStream>>(std::move(source))
+  {}
+
   ~RTCMediaStreamList() {}
 };
 
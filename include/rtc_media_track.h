@@ -25,6 +25,11 @@ class RTCMediaTrack : public RefCountInterface {
   /*mute track*/
   virtual bool set_enabled(bool enable) = 0;
 
+  /*kind() and id() without a copy; valid for the lifetime of the track*/
+  virtual string_view kind_view() const = 0;
+
+  virtual string_view id_view() const = 0;
+
  protected:
   ~RTCMediaTrack() {}
 };
@@ -11,6 +11,7 @@
 #include "rtc_rtp_sender.h"
 #include "rtc_rtp_transceiver.h"
 #include "rtc_session_description.h"
+#include "rtc_stats_sampler.h"
 #include "rtc_video_source.h"
 #include "rtc_video_track.h"
 
@@ -115,11 +116,18 @@ class RTCStatsMemberList : public RTCBaseList<scoped_refptr<RTCStatsMember>> {
   LIB_WEBRTC_API static scoped_refptr<RTCStatsMemberList> Create(
     const vector<scoped_refptr<RTCStatsMember>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCStatsMemberList> Create(
+    vector<scoped_refptr<RTCStatsMember>>&& source);
+
  protected:
   RTCStatsMemberList(const vector<scoped_refptr<RTCStatsMember>>& source)
     : RTCBaseList<scoped_refptr<RTCStatsMember>>(source)
   {}
 
+  RTCStatsMemberList(vector<scoped_refptr<RTCStatsMember>>&& source)
+    : RTCBaseList<scoped_refptr<RTCStatsMember>>(std::move(source))
+  {}
+
   ~RTCStatsMemberList() {}
 }; // end class RTCStatsMemberList
 
@@ -133,7 +141,13 @@ class MediaRTCStats : public RefCountInterface {
 
   virtual const string ToJson() = 0;
 
-  virtual const vector<scoped_refptr<RTCStatsMember>> Members() = 0;
+  virtual vector<scoped_refptr<RTCStatsMember>> Members() = 0;
+
+  /**
+   * ToJson() without a copy. The JSON is built on the first call and the
+   * view is valid for the lifetime of the object.
+   */
+  virtual string_view ToJsonView() = 0;
 };
 
 /**
@@ -144,33 +158,65 @@ class MediaRTCStatsList : public RTCBaseList<scoped_refptr<MediaRTCStats>> {
   LIB_WEBRTC_API static scoped_refptr<MediaRTCStatsList> Create(
     const vector<scoped_refptr<MediaRTCStats>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<MediaRTCStatsList> Create(
+    vector<scoped_refptr<MediaRTCStats>>&& source);
+
  protected:
   MediaRTCStatsList(const vector<scoped_refptr<MediaRTCStats>>& source)
     : RTCBaseList<scoped_refptr<MediaRTCStats>>(source)
   {}
 
+  MediaRTCStatsList(vector<scoped_refptr<MediaRTCStats>>&& source)
+    : RTCBaseList<scoped_refptr<MediaRTCStats>>(std::move(source))
+  {}
+
   ~MediaRTCStatsList() {}
 }; // end class MediaRTCStatsList
 
+/**
+ * struct RTCStatsFilter
+ *
+ * Restricts a GetFilteredStats() call to the stats types (e.g. "inbound-rtp",
+ * "candidate-pair", "transport") and member names of interest. An empty list
+ * does not filter.
+ *
+ * In delta mode only members whose values changed since the previous delta
+ * call are returned, together with the computed rate members "sendBitrate",
+ * "receiveBitrate" (bits/s), "packetsSentPerSecond",
+ * "packetsReceivedPerSecond" and "packetLossRate" (0..1).
+ */
+struct RTCStatsFilter {
+  vector<string> types;
+  vector<string> members;
+  bool delta = false;
+};
+
 typedef fixed_size_function<void(
-    const vector<scoped_refptr<MediaRTCStats>> reports)>
+    const vector<scoped_refptr<MediaRTCStats>> reports),
+                            kResultCallbackSize>
     OnStatsCollectorSuccess;
 
-typedef fixed_size_function<void(const char* error)> OnStatsCollectorFailure;
+typedef fixed_size_function<void(const char* error), kResultCallbackSize>
+    OnStatsCollectorFailure;
 
-typedef fixed_size_function<void(const string sdp, const string type)>
+typedef fixed_size_function<void(const string sdp, const string type),
+                            kResultCallbackSize>
     OnSdpCreateSuccess;
 
-typedef fixed_size_function<void(const char* erro)> OnSdpCreateFailure;
+typedef fixed_size_function<void(const char* erro), kResultCallbackSize>
+    OnSdpCreateFailure;
 
-typedef fixed_size_function<void()> OnSetSdpSuccess;
+typedef fixed_size_function<void(), kResultCallbackSize> OnSetSdpSuccess;
 
-typedef fixed_size_function<void(const char* error)> OnSetSdpFailure;
+typedef fixed_size_function<void(const char* error), kResultCallbackSize>
+    OnSetSdpFailure;
 
-typedef fixed_size_function<void(const char* sdp, const char* type)>
+typedef fixed_size_function<void(const char* sdp, const char* type),
+                            kResultCallbackSize>
     OnGetSdpSuccess;
 
-typedef fixed_size_function<void(const char* error)> OnGetSdpFailure;
+typedef fixed_size_function<void(const char* error), kResultCallbackSize>
+    OnGetSdpFailure;
 
 class RTCPeerConnectionObserver {
  public:
@@ -199,6 +245,15 @@ class RTCPeerConnectionObserver {
 
   virtual void OnRemoveTrack(scoped_refptr<RTCRtpReceiver> receiver) = 0;
 
+  // Called instead of OnIceCandidate() when candidate batching is enabled in
+  // RTCConfiguration. Forwards each candidate to OnIceCandidate() by default.
+  virtual void OnIceCandidates(
+      vector<scoped_refptr<RTCIceCandidate>> candidates) {
+    for (size_t i = 0; i < candidates.size(); i++) {
+      OnIceCandidate(candidates[i]);
+    }
+  }
+
  protected:
   virtual ~RTCPeerConnectionObserver() {}
 };
@@ -302,6 +357,19 @@ class RTCPeerConnection : public RefCountInterface {
 
   virtual RTCPeerConnectionObserver* GetObserver() = 0;
 
+  /// GetStats() restricted by |filter|, see RTCStatsFilter.
+  virtual void GetFilteredStats(const RTCStatsFilter& filter,
+                                OnStatsCollectorSuccess success,
+                                OnStatsCollectorFailure failure) = 0;
+
+  /**
+   * Creates a sampler that records |config.fields| periodically into a
+   * fixed-size history. Returns null if the configuration is invalid or the
+   * connection is closed. Samplers stop when the connection is closed.
+   */
+  virtual scoped_refptr<RTCStatsSampler> CreateStatsSampler(
+      const RTCStatsSamplerConfig& config) = 0;
+
  protected:
   virtual ~RTCPeerConnection() {}
 };
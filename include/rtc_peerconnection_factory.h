@@ -9,6 +9,7 @@
 #endif
 #include "rtc_media_stream.h"
 #include "rtc_mediaconstraints.h"
+#include "rtc_video_codec.h"
 #include "rtc_video_device.h"
 #include "rtc_video_source.h"
 #include "rtc_dummy_video_capturer.h"
@@ -21,6 +22,17 @@ class RTCAudioDevice;
 class RTCVideoDevice;
 class RTCRtpCapabilities;
 
+struct RTCPeerConnectionFactoryOptions {
+  bool use_dummy_audio = false;
+
+  /// External video codecs, used ahead of the builtin ones. The builtin
+  /// codecs stay available for the other formats and as the fallback of the
+  /// formats a plugin shares with them. nullptr keeps the builtin codecs
+  /// only.
+  scoped_refptr<RTCVideoEncoderPluginFactory> video_encoder_factory;
+  scoped_refptr<RTCVideoDecoderPluginFactory> video_decoder_factory;
+};
+
 class RTCPeerConnectionFactory : public RefCountInterface {
  public:
   virtual bool Initialize(bool use_dummy_audio = false) = 0;
@@ -81,6 +93,19 @@ class RTCPeerConnectionFactory : public RefCountInterface {
       RTCMediaType media_type) = 0;
 
   virtual bool GetUseDummyAudio() = 0;
+
+  /**
+   * Selects the thread that calls the capturer and desktop media list
+   * observers. Events are always posted: capture threads never wait for an
+   * observer to return. Capturers and media lists created afterwards use
+   * the new thread; the media lists of the desktop device switch over at
+   * once, keeping their events in order.
+   */
+  virtual void SetObserverThread(RTCObserverThread thread) = 0;
+
+  /// Initialize() with the options above, such as external video codecs.
+  virtual bool InitializeWithOptions(
+      const RTCPeerConnectionFactoryOptions& options) = 0;
 };
 
 }  // namespace libwebrtc
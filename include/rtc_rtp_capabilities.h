@@ -23,6 +23,10 @@ class RTCRtpCodecCapability : public RefCountInterface {
   virtual int channels() const = 0;
   virtual string sdp_fmtp_line() const = 0;
 
+  // Borrowed variants, valid until the next setter call on this object.
+  virtual string_view mime_type_view() const = 0;
+  virtual string_view sdp_fmtp_line_view() const = 0;
+
  protected:
   virtual ~RTCRtpCodecCapability() {}
 };
@@ -35,11 +39,18 @@ class RTCRtpCodecCapabilityList : public RTCBaseList<scoped_refptr<RTCRtpCodecCa
   LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecCapabilityList> Create(
     const vector<scoped_refptr<RTCRtpCodecCapability>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecCapabilityList> Create(
+    vector<scoped_refptr<RTCRtpCodecCapability>>&& source);
+
  protected:
   RTCRtpCodecCapabilityList(const vector<scoped_refptr<RTCRtpCodecCapability>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpCodecCapability>>(source)
   {}
 
+  RTCRtpCodecCapabilityList(vector<scoped_refptr<RTCRtpCodecCapability>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpCodecCapability>>(std::move(source))
+  {}
+
   ~RTCRtpCodecCapabilityList() {}
 };
 
@@ -63,28 +74,35 @@ class RTCRtpHeaderExtensionCapabilityList : public RTCBaseList<scoped_refptr<RTC
   LIB_WEBRTC_API static scoped_refptr<RTCRtpHeaderExtensionCapabilityList> Create(
     const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpHeaderExtensionCapabilityList> Create(
+    vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>&& source);
+
  protected:
   RTCRtpHeaderExtensionCapabilityList(const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpHeaderExtensionCapability>>(source)
   {}
 
+  RTCRtpHeaderExtensionCapabilityList(vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpHeaderExtensionCapability>>(std::move(source))
+  {}
+
   ~RTCRtpHeaderExtensionCapabilityList() {}
 };
 
 class RTCRtpCapabilities : public RefCountInterface {
  public:
-  virtual const vector<scoped_refptr<RTCRtpCodecCapability>> codecs() = 0;
+  virtual vector<scoped_refptr<RTCRtpCodecCapability>> codecs() = 0;
   virtual void set_codecs(
       const vector<scoped_refptr<RTCRtpCodecCapability>> codecs) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
+  virtual vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
   header_extensions() = 0;
 
   virtual void set_header_extensions(
       const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
           header_extensions) = 0;
 
-  // virtual const vector<scoped_refptr<RTCFecMechanism>> fec() = 0;
+  // virtual vector<scoped_refptr<RTCFecMechanism>> fec() = 0;
   // virtual void set_fec(const vector<scoped_refptr<RTCFecMechanism>> fec) = 0;
 };
 
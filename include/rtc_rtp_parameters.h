@@ -68,11 +68,18 @@ class RTCRtcpFeedbackList : public RTCBaseList<scoped_refptr<RTCRtcpFeedback>> {
   LIB_WEBRTC_API static scoped_refptr<RTCRtcpFeedbackList> Create(
     const vector<scoped_refptr<RTCRtcpFeedback>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtcpFeedbackList> Create(
+    vector<scoped_refptr<RTCRtcpFeedback>>&& source);
+
  protected:
   RTCRtcpFeedbackList(const vector<scoped_refptr<RTCRtcpFeedback>>& source)
     : RTCBaseList<scoped_refptr<RTCRtcpFeedback>>(source)
   {}
 
+  RTCRtcpFeedbackList(vector<scoped_refptr<RTCRtcpFeedback>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtcpFeedback>>(std::move(source))
+  {}
+
   ~RTCRtcpFeedbackList() {}
 };
 
@@ -105,11 +112,18 @@ class RTCRtpExtensionList : public RTCBaseList<scoped_refptr<RTCRtpExtension>> {
   LIB_WEBRTC_API static scoped_refptr<RTCRtpExtensionList> Create(
     const vector<scoped_refptr<RTCRtpExtension>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpExtensionList> Create(
+    vector<scoped_refptr<RTCRtpExtension>>&& source);
+
  protected:
   RTCRtpExtensionList(const vector<scoped_refptr<RTCRtpExtension>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpExtension>>(source)
   {}
 
+  RTCRtpExtensionList(vector<scoped_refptr<RTCRtpExtension>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpExtension>>(std::move(source))
+  {}
+
   ~RTCRtpExtensionList() {}
 };
 
@@ -162,6 +176,9 @@ class RTCRtpCodecParametersMap : public RTCBaseList<scoped_refptr<RTCRtpCodecPar
  public:
   LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecParametersMap> Create(
     const vector<scoped_refptr<RTCRtpCodecParametersPair>>& source);
+
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecParametersMap> Create(
+    vector<scoped_refptr<RTCRtpCodecParametersPair>>&& source);
   
   LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecParametersMap> Create();
 
@@ -174,6 +191,10 @@ class RTCRtpCodecParametersMap : public RTCBaseList<scoped_refptr<RTCRtpCodecPar
     : RTCBaseList<scoped_refptr<RTCRtpCodecParametersPair>>(source)
   {}
 
+  RTCRtpCodecParametersMap(vector<scoped_refptr<RTCRtpCodecParametersPair>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpCodecParametersPair>>(std::move(source))
+  {}
+
   ~RTCRtpCodecParametersMap() {}
 
  public:
@@ -205,7 +226,7 @@ class RTCRtpCodecParameters : public RefCountInterface {
   virtual int ptime() = 0;
   virtual void set_ptime(int value) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtcpFeedback>> rtcp_feedback() = 0;
+  virtual vector<scoped_refptr<RTCRtcpFeedback>> rtcp_feedback() = 0;
   virtual void set_rtcp_feedback(
       const vector<scoped_refptr<RTCRtcpFeedback>> feecbacks) = 0;
 
@@ -228,11 +249,18 @@ class RTCRtpCodecParametersList : public RTCBaseList<scoped_refptr<RTCRtpCodecPa
   LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecParametersList> Create(
     const vector<scoped_refptr<RTCRtpCodecParameters>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpCodecParametersList> Create(
+    vector<scoped_refptr<RTCRtpCodecParameters>>&& source);
+
  protected:
   RTCRtpCodecParametersList(const vector<scoped_refptr<RTCRtpCodecParameters>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpCodecParameters>>(source)
   {}
 
+  RTCRtpCodecParametersList(vector<scoped_refptr<RTCRtpCodecParameters>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpCodecParameters>>(std::move(source))
+  {}
+
   ~RTCRtpCodecParametersList() {}
 };
 
@@ -262,11 +290,18 @@ class RTCRtcpParametersList : public RTCBaseList<scoped_refptr<RTCRtcpParameters
   LIB_WEBRTC_API static scoped_refptr<RTCRtcpParametersList> Create(
     const vector<scoped_refptr<RTCRtcpParameters>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtcpParametersList> Create(
+    vector<scoped_refptr<RTCRtcpParameters>>&& source);
+
  protected:
   RTCRtcpParametersList(const vector<scoped_refptr<RTCRtcpParameters>>& source)
     : RTCBaseList<scoped_refptr<RTCRtcpParameters>>(source)
   {}
 
+  RTCRtcpParametersList(vector<scoped_refptr<RTCRtcpParameters>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtcpParameters>>(std::move(source))
+  {}
+
   ~RTCRtcpParametersList() {}
 };
 
@@ -329,11 +364,18 @@ class RTCRtpEncodingParametersList : public RTCBaseList<scoped_refptr<RTCRtpEnco
   LIB_WEBRTC_API static scoped_refptr<RTCRtpEncodingParametersList> Create(
     const vector<scoped_refptr<RTCRtpEncodingParameters>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpEncodingParametersList> Create(
+    vector<scoped_refptr<RTCRtpEncodingParameters>>&& source);
+
  protected:
   RTCRtpEncodingParametersList(const vector<scoped_refptr<RTCRtpEncodingParameters>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpEncodingParameters>>(source)
   {}
 
+  RTCRtpEncodingParametersList(vector<scoped_refptr<RTCRtpEncodingParameters>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpEncodingParameters>>(std::move(source))
+  {}
+
   ~RTCRtpEncodingParametersList() {}
 };
 
@@ -346,15 +388,15 @@ struct RTCRtpParameters : public RefCountInterface {
   virtual const string mid() = 0;
   virtual void set_mid(const string mid) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpCodecParameters>> codecs() = 0;
+  virtual vector<scoped_refptr<RTCRtpCodecParameters>> codecs() = 0;
   virtual void set_codecs(
       const vector<scoped_refptr<RTCRtpCodecParameters>> codecs) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpExtension>> header_extensions() = 0;
+  virtual vector<scoped_refptr<RTCRtpExtension>> header_extensions() = 0;
   virtual void set_header_extensions(
       const vector<scoped_refptr<RTCRtpExtension>> header_extensions) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>> encodings() = 0;
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>> encodings() = 0;
   virtual void set_encodings(
       const vector<scoped_refptr<RTCRtpEncodingParameters>> encodings) = 0;
 
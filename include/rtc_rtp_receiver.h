@@ -66,11 +66,18 @@ class RTCRtpReceiverList : public RTCBaseList<scoped_refptr<RTCRtpReceiver>> {
   LIB_WEBRTC_API static scoped_refptr<RTCRtpReceiverList> Create(
     const vector<scoped_refptr<RTCRtpReceiver>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpReceiverList> Create(
+    vector<scoped_refptr<RTCRtpReceiver>>&& source);
+
  protected:
   RTCRtpReceiverList(const vector<scoped_refptr<RTCRtpReceiver>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpReceiver>>(source)
   {}
 
+  RTCRtpReceiverList(vector<scoped_refptr<RTCRtpReceiver>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpReceiver>>(std::move(source))
+  {}
+
   ~RTCRtpReceiverList() {}
 }; // end class RTCRtpReceiverList
 
@@ -31,7 +31,7 @@ class RTCRtpSender : public RefCountInterface {
 
   virtual void set_stream_ids(const vector<string> stream_ids) const = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>>
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>>
   init_send_encodings() const = 0;
 
   virtual scoped_refptr<RTCRtpParameters> parameters() const = 0;
@@ -50,11 +50,18 @@ class RTCRtpSenderList : public RTCBaseList<scoped_refptr<RTCRtpSender>> {
   LIB_WEBRTC_API static scoped_refptr<RTCRtpSenderList> Create(
     const vector<scoped_refptr<RTCRtpSender>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpSenderList> Create(
+    vector<scoped_refptr<RTCRtpSender>>&& source);
+
  protected:
   RTCRtpSenderList(const vector<scoped_refptr<RTCRtpSender>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpSender>>(source)
   {}
 
+  RTCRtpSenderList(vector<scoped_refptr<RTCRtpSender>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpSender>>(std::move(source))
+  {}
+
   ~RTCRtpSenderList() {}
 }; // end class RTCRtpSenderList
 
@@ -22,7 +22,7 @@ class RTCRtpTransceiverInit : public RefCountInterface {
   virtual const vector<string> stream_ids() = 0;
   virtual void set_stream_ids(const vector<string> ids) = 0;
 
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>>
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>>
   send_encodings() = 0;
   virtual void set_send_encodings(
       const vector<scoped_refptr<RTCRtpEncodingParameters>> send_encodings) = 0;
@@ -69,11 +69,18 @@ class RTCRtpTransceiverList : public RTCBaseList<scoped_refptr<RTCRtpTransceiver
   LIB_WEBRTC_API static scoped_refptr<RTCRtpTransceiverList> Create(
     const vector<scoped_refptr<RTCRtpTransceiver>>& source);
 
+  LIB_WEBRTC_API static scoped_refptr<RTCRtpTransceiverList> Create(
+    vector<scoped_refptr<RTCRtpTransceiver>>&& source);
+
  protected:
   RTCRtpTransceiverList(const vector<scoped_refptr<RTCRtpTransceiver>>& source)
     : RTCBaseList<scoped_refptr<RTCRtpTransceiver>>(source)
   {}
 
+  RTCRtpTransceiverList(vector<scoped_refptr<RTCRtpTransceiver>>&& source)
+    : RTCBaseList<scoped_refptr<RTCRtpTransceiver>>(std::move(source))
+  {}
+
   ~RTCRtpTransceiverList() {}
 }; // end class RTCRtpTransceiverList
 
@@ -22,6 +22,12 @@ class RTCSessionDescription : public RefCountInterface {
 
   virtual bool ToString(string& out) = 0;
 
+  /**
+   * sdp() without a copy. The view is valid for the lifetime of the
+   * object.
+   */
+  virtual string_view sdp_view() const = 0;
+
  protected:
   virtual ~RTCSessionDescription() {}
 };
@@ -0,0 +1,106 @@
+#ifndef LIB_WEBRTC_RTC_STATS_SAMPLER_HXX
+#define LIB_WEBRTC_RTC_STATS_SAMPLER_HXX
+
+#include "rtc_types.h"
+
+namespace libwebrtc {
+
+/**
+ * struct RTCStatsSamplerField
+ *
+ * One column of the sampled time series: the numeric member |member| summed
+ * over every stats object of type |type| (e.g. "inbound-rtp",
+ * "bytesReceived"). With |rate| set, the per-second rate of change of that
+ * sum is recorded instead of the sum itself.
+ */
+struct RTCStatsSamplerField {
+  string type;
+  string member;
+  bool rate = false;
+};
+
+/**
+ * struct RTCStatsSamplerConfig
+ */
+struct RTCStatsSamplerConfig {
+  int interval_ms = 1000;
+  int history_size = 300;
+  vector<RTCStatsSamplerField> fields;
+};
+
+/**
+ * struct RTCStatsSummary
+ *
+ * Per-field aggregate over the samples currently held in the history.
+ * Samples where the field was not available are not counted.
+ */
+struct RTCStatsSummary {
+  double min;
+  double max;
+  double mean;
+  double last;
+  int samples;
+};
+
+typedef fixed_size_function<void(const RTCStatsSummary* summaries,
+                                 int count),
+                            kResultCallbackSize>
+    OnStatsSamplerSummary;
+
+/**
+ * class RTCStatsSampler
+ *
+ * Collects the configured stats fields of a peer connection every
+ * interval_ms() on a library thread and keeps the last capacity() samples in
+ * a ring buffer. Values are stored as doubles, one row of field_count()
+ * values per sample; NaN marks a field that was not available.
+ */
+class RTCStatsSampler : public RefCountInterface {
+ public:
+  virtual bool Start() = 0;
+
+  virtual void Stop() = 0;
+
+  virtual bool IsRunning() const = 0;
+
+  /**
+   * Drops all recorded samples.
+   */
+  virtual void Clear() = 0;
+
+  virtual int interval_ms() const = 0;
+
+  virtual int field_count() const = 0;
+
+  virtual int capacity() const = 0;
+
+  virtual int sample_count() const = 0;
+
+  /**
+   * Copies the newest |max_samples| samples, oldest first. |timestamps_us|
+   * receives one value per sample and |values| field_count() values per
+   * sample; either may be null. Returns the number of samples copied.
+   */
+  virtual int GetHistory(int64_t* timestamps_us, double* values,
+                         int max_samples) const = 0;
+
+  /**
+   * Summarises the history into |summaries| (up to |max_fields| entries).
+   * Returns the number of entries written.
+   */
+  virtual int GetSummary(RTCStatsSummary* summaries, int max_fields) const = 0;
+
+  /**
+   * Invokes |callback| with the summary after every |every_samples| new
+   * samples. A null callback or a non-positive count disables it.
+   */
+  virtual void SetSummaryCallback(int every_samples,
+                                  OnStatsSamplerSummary callback) = 0;
+
+ protected:
+  virtual ~RTCStatsSampler() {}
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_STATS_SAMPLER_HXX
@@ -26,6 +26,11 @@ namespace libwebrtc {
 
 enum { kMaxIceServerSize = 8 };
 
+// Size in bytes, v-table included, of the callbacks that report the outcome
+// of a single call or a notification. The interop layer stores a delegate and
+// its user_data pointer in them.
+enum { kResultCallbackSize = 64 };
+
 // template <typename T>
 // using vector = bsp::inlined_vector<T, 16, true>;
 
@@ -38,6 +43,14 @@ enum class RTCMediaType { AUDIO, VIDEO, DATA, UNSUPPORTED };
 
 enum class RTCCaptureState { CS_RUNNING = 0, CS_STOPPED, CS_FAILED };
 
+// Thread that calls the capturer and desktop media list observers.
+enum class RTCObserverThread : int32_t {
+  kSignalingThread = 0,
+  // A library thread that only delivers observer events, so a slow observer
+  // does not hold up the signaling thread.
+  kEventThread = 1
+};
+
 enum class RTCVideoFrameTypeARGB {
   kARGB = RTC_FOURCC('A', 'R', 'G', 'B'),
   kBGRA = RTC_FOURCC('B', 'G', 'R', 'A'),
@@ -51,6 +64,15 @@ enum class RTCVideoFrameTypeYUV {
   kNV12 = RTC_FOURCC('N', 'V', '1', '2')
 };
 
+// Pixel format of frames written by RTCVideoFrameExport.
+enum class RTCVideoFrameExportFormat : uint32_t {
+  kARGB = RTC_FOURCC('A', 'R', 'G', 'B'),
+  kBGRA = RTC_FOURCC('B', 'G', 'R', 'A'),
+  kABGR = RTC_FOURCC('A', 'B', 'G', 'R'),
+  kRGBA = RTC_FOURCC('R', 'G', 'B', 'A'),
+  kI420 = RTC_FOURCC('I', '4', '2', '0')
+};
+
 enum class RTCAudioDataToneFrequency {
   kNone = 0,         // Clear audio buffer
   kTone60Hz = 60,
@@ -67,6 +89,7 @@ enum class RTCVideoFrameClearType {
 };
 
 using string = portable::string;
+using string_view = portable::string_view;
 
 // template <typename Key, typename T>
 // using map = portable::map<Key, T>;
@@ -105,6 +128,28 @@ enum BundlePolicy {
 
 enum class SdpSemantics { kPlanB, kUnifiedPlan };
 
+enum class ContinualGatheringPolicy { kGatherOnce, kGatherContinually };
+
+// Bits of RTCConfiguration::ice_candidate_filter. Local candidates matching
+// any set bit (by protocol, type or network) are dropped before they are
+// reported to the observer.
+enum IceCandidateFilter {
+  kIceCandidateFilterNone = 0,
+  kIceCandidateFilterUdp = 1 << 0,
+  kIceCandidateFilterTcp = 1 << 1,
+  kIceCandidateFilterHost = 1 << 2,
+  kIceCandidateFilterSrflx = 1 << 3,
+  kIceCandidateFilterPrflx = 1 << 4,
+  kIceCandidateFilterRelay = 1 << 5,
+  kIceCandidateFilterIPv4 = 1 << 6,
+  kIceCandidateFilterIPv6 = 1 << 7,
+  kIceCandidateFilterEthernet = 1 << 8,
+  kIceCandidateFilterWifi = 1 << 9,
+  kIceCandidateFilterCellular = 1 << 10,
+  kIceCandidateFilterVpn = 1 << 11,
+  kIceCandidateFilterLoopback = 1 << 12,
+};
+
 struct RTCConfiguration {
   IceServer ice_servers[kMaxIceServerSize];
   IceTransportsType type = IceTransportsType::kAll;
@@ -128,6 +173,34 @@ struct RTCConfiguration {
   bool disable_link_local_networks = false;
   int screencast_min_bitrate = -1;
 
+  // ICE timing and gathering. -1 keeps the WebRTC default.
+  ContinualGatheringPolicy continual_gathering_policy =
+      ContinualGatheringPolicy::kGatherOnce;
+  int ice_check_interval_strong_connectivity = -1;
+  int ice_check_interval_weak_connectivity = -1;
+  int ice_check_min_interval = -1;
+  int ice_connection_receiving_timeout = -1;
+  int ice_backup_candidate_pair_ping_interval = -1;
+
+  // Local UDP/TCP port range for candidates; 0 leaves it unrestricted.
+  int min_port = 0;
+  int max_port = 0;
+
+  // Receive side audio jitter buffer.
+  int audio_jitter_buffer_max_packets = 200;
+  bool audio_jitter_buffer_fast_accelerate = false;
+  int audio_jitter_buffer_min_delay_ms = 0;
+
+  // IceCandidateFilter bits of local candidates to drop.
+  uint32_t ice_candidate_filter = kIceCandidateFilterNone;
+  // Trickle ICE batching. When either value is > 0, local candidates are
+  // reported through RTCPeerConnectionObserver::OnIceCandidates once
+  // |ice_candidate_batch_size| candidates are queued or
+  // |ice_candidate_batch_window_ms| has passed since the first queued one.
+  // Queued candidates are always flushed when gathering completes.
+  int ice_candidate_batch_size = 0;
+  int ice_candidate_batch_window_ms = 0;
+
   // private
   bool use_rtp_mux = true;
   uint32_t local_audio_bandwidth = 128;
@@ -144,6 +217,13 @@ struct RTCConfiguration {
 
 enum DesktopType { kScreen, kWindow };
 
+// Encoding of desktop media source thumbnails.
+enum class ThumbnailFormat : int32_t {
+  kJpeg = 0,
+  // Raw pixels, 4 bytes per pixel in R, G, B, A byte order, no row padding.
+  kRGBA = 1
+};
+
 struct RTCVideoFrameARGB {
   RTCVideoFrameTypeARGB type = RTCVideoFrameTypeARGB::kARGB;
   int width = 0;
@@ -0,0 +1,190 @@
+#ifndef LIB_WEBRTC_RTC_VIDEO_CODEC_HXX
+#define LIB_WEBRTC_RTC_VIDEO_CODEC_HXX
+
+#include "rtc_types.h"
+#include "rtc_video_frame.h"
+
+namespace libwebrtc {
+
+/**
+ * An SDP video format, such as "VP8", or "H264" with
+ * "level-asymmetry-allowed=1;packetization-mode=1;profile-level-id=42e01f".
+ */
+struct RTCVideoCodecFormat {
+  string name;
+  /// Format parameters as in an a=fmtp line: key=value pairs separated by ';'.
+  string parameters;
+};
+
+/// Result of the plugin calls.
+enum class RTCVideoCodecStatus : int32_t {
+  kOk = 0,
+  kError = -1,
+  /// The builtin codec takes over the stream from now on.
+  kFallbackToBuiltin = -2,
+};
+
+enum class RTCVideoCodecMode : int32_t {
+  kRealtimeVideo = 0,
+  kScreensharing = 1,
+};
+
+struct RTCVideoEncoderSettings {
+  int width = 0;
+  int height = 0;
+  int max_framerate = 0;
+  int start_bitrate_kbps = 0;
+  int min_bitrate_kbps = 0;
+  int max_bitrate_kbps = 0;
+  int number_of_cores = 1;
+  RTCVideoCodecMode mode = RTCVideoCodecMode::kRealtimeVideo;
+};
+
+struct RTCVideoDecoderSettings {
+  /// Largest resolution the stream is expected to reach; 0 when unknown.
+  int max_width = 0;
+  int max_height = 0;
+  int number_of_cores = 1;
+};
+
+/**
+ * One encoded frame. The data is borrowed: it only has to stay valid for
+ * the duration of the call it is passed to.
+ */
+struct RTCEncodedVideoImage {
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  int width = 0;
+  int height = 0;
+  /// 90 kHz RTP timestamp of the frame that was encoded.
+  uint32_t rtp_timestamp = 0;
+  /// Encoders pass on timestamp_us() / 1000 of the input frame.
+  int64_t capture_time_ms = 0;
+  bool key_frame = false;
+  /// Quantizer of the frame, or -1 when unknown.
+  int qp = -1;
+};
+
+class RTCVideoEncoderCallback {
+ public:
+  /// Hands an encoded frame to the RTP sender. Can be called from any
+  /// thread, one frame at a time.
+  virtual void OnEncodedImage(const RTCEncodedVideoImage& image) = 0;
+
+ protected:
+  virtual ~RTCVideoEncoderCallback() {}
+};
+
+class RTCVideoDecoderCallback {
+ public:
+  /// Hands a decoded frame to the renderers. |rtp_timestamp| is the one of
+  /// the RTCEncodedVideoImage the frame was decoded from.
+  virtual void OnDecodedFrame(scoped_refptr<RTCVideoFrame> frame,
+                              uint32_t rtp_timestamp) = 0;
+
+ protected:
+  virtual ~RTCVideoDecoderCallback() {}
+};
+
+/**
+ * class RTCVideoEncoderPlugin
+ *
+ * An external encoder for one video stream. All calls come from the same
+ * encoder queue; the callback may be called from any thread.
+ */
+class RTCVideoEncoderPlugin : public RefCountInterface {
+ public:
+  virtual RTCVideoCodecStatus InitEncode(
+      const RTCVideoEncoderSettings& settings) = 0;
+
+  /// |callback| stays valid until Shutdown() or the next call; nullptr
+  /// unregisters it.
+  virtual void RegisterCallback(RTCVideoEncoderCallback* callback) = 0;
+
+  /// Encodes |frame|, an I420 frame, and reports the result through the
+  /// callback, synchronously or later.
+  virtual RTCVideoCodecStatus Encode(scoped_refptr<RTCVideoFrame> frame,
+                                     uint32_t rtp_timestamp,
+                                     bool key_frame) = 0;
+
+  /// Target set by the bandwidth estimation.
+  virtual void SetRates(uint32_t bitrate_bps, double framerate_fps) = 0;
+
+  /// Frees the resources of InitEncode(). InitEncode() may follow again.
+  virtual void Shutdown() = 0;
+
+  virtual string ImplementationName() const = 0;
+
+  virtual bool IsHardwareAccelerated() const { return false; }
+
+ protected:
+  virtual ~RTCVideoEncoderPlugin() {}
+};
+
+/**
+ * class RTCVideoDecoderPlugin
+ *
+ * An external decoder for one video stream. All calls come from the same
+ * decoder queue; the callback may be called from any thread.
+ */
+class RTCVideoDecoderPlugin : public RefCountInterface {
+ public:
+  virtual RTCVideoCodecStatus InitDecode(
+      const RTCVideoDecoderSettings& settings) = 0;
+
+  /// |callback| stays valid until Shutdown() or the next call; nullptr
+  /// unregisters it.
+  virtual void RegisterCallback(RTCVideoDecoderCallback* callback) = 0;
+
+  /// Decodes one complete frame and reports the result through the
+  /// callback, synchronously or later.
+  virtual RTCVideoCodecStatus Decode(const RTCEncodedVideoImage& image) = 0;
+
+  virtual void Shutdown() = 0;
+
+  virtual string ImplementationName() const = 0;
+
+  virtual bool IsHardwareAccelerated() const { return false; }
+
+ protected:
+  virtual ~RTCVideoDecoderPlugin() {}
+};
+
+/**
+ * class RTCVideoEncoderPluginFactory
+ *
+ * Formats from GetSupportedFormats() are negotiated ahead of the builtin
+ * ones; it is called once, when the peer connection factory initializes.
+ * The builtin encoder of the same format, if any, takes over when Create()
+ * returns nullptr, InitEncode() fails or a call returns kFallbackToBuiltin.
+ */
+class RTCVideoEncoderPluginFactory : public RefCountInterface {
+ public:
+  virtual vector<RTCVideoCodecFormat> GetSupportedFormats() = 0;
+
+  virtual scoped_refptr<RTCVideoEncoderPlugin> Create(
+      const RTCVideoCodecFormat& format) = 0;
+
+ protected:
+  virtual ~RTCVideoEncoderPluginFactory() {}
+};
+
+/**
+ * class RTCVideoDecoderPluginFactory
+ *
+ * Same as RTCVideoEncoderPluginFactory, for the receiving side.
+ */
+class RTCVideoDecoderPluginFactory : public RefCountInterface {
+ public:
+  virtual vector<RTCVideoCodecFormat> GetSupportedFormats() = 0;
+
+  virtual scoped_refptr<RTCVideoDecoderPlugin> Create(
+      const RTCVideoCodecFormat& format) = 0;
+
+ protected:
+  virtual ~RTCVideoDecoderPluginFactory() {}
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_VIDEO_CODEC_HXX
@@ -0,0 +1,126 @@
+#ifndef LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_HXX
+#define LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_HXX
+
+#include <stdint.h>
+
+#include "rtc_types.h"
+#include "rtc_video_frame.h"
+#include "rtc_video_renderer.h"
+
+namespace libwebrtc {
+
+/**
+ * Shared memory layout written by RTCVideoFrameExport.
+ *
+ * The mapping starts with an RTCVideoFrameExportHeader, followed by
+ * |slot_count| slots of |slot_size| bytes each. Every slot starts with an
+ * RTCVideoFrameExportSlot; the pixels follow at kRTCVideoFrameExportSlotData.
+ * All fields are little endian on every supported platform, and all offsets
+ * are multiples of 64.
+ *
+ * Frames are written round robin into the slots. A slot's |sequence| is odd
+ * while the slot is being written and 2 * n once frame n (counting from 1)
+ * is complete. A reader:
+ *   1. loads |latest_slot| after |latest_sequence| (acquire),
+ *   2. loads the slot's |sequence| (acquire) and skips the frame if odd,
+ *   3. reads the pixels in place,
+ *   4. loads |sequence| again; if it changed, the writer lapped the ring
+ *      and what was read is torn.
+ * The writer never waits for readers; three or more slots give a reader two
+ * frame intervals to finish with the newest frame.
+ *
+ * On Linux |frame_signal| is a futex word holding the low 32 bits of
+ * |latest_sequence|; it is woken (FUTEX_WAKE, not private) after every
+ * frame, so a reader can FUTEX_WAIT on the value it last saw. Elsewhere
+ * readers poll |latest_sequence|.
+ */
+enum : uint32_t {
+  kRTCVideoFrameExportMagic = RTC_FOURCC('L', 'W', 'F', 'X'),
+  kRTCVideoFrameExportVersion = 1,
+  kRTCVideoFrameExportSlotData = 64,
+};
+
+struct RTCVideoFrameExportHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t format;  // RTCVideoFrameExportFormat
+  uint32_t slot_count;
+  uint32_t slot_size;
+  uint32_t max_width;
+  uint32_t max_height;
+  uint32_t frame_signal;
+  uint64_t latest_sequence;
+  uint32_t latest_slot;
+  uint32_t reserved[5];
+};
+
+struct RTCVideoFrameExportSlot {
+  uint64_t sequence;
+  int64_t timestamp_us;
+  uint32_t width;
+  uint32_t height;
+  // ARGB formats use plane 0 only. I420 planes start at |offset_*| bytes
+  // from the slot's pixel data.
+  uint32_t stride_y;
+  uint32_t stride_u;
+  uint32_t stride_v;
+  uint32_t offset_u;
+  uint32_t offset_v;
+  uint32_t reserved[5];
+};
+
+/**
+ * struct RTCVideoFrameExportConfig
+ *
+ * |name| names the shared memory object: shm_open() name on POSIX (a
+ * leading '/' is added if missing), file mapping name on Windows. Frames are
+ * rotated upright and scaled down to fit |max_width| x |max_height|, keeping
+ * their aspect ratio. Creation fails if the name is already in use; on POSIX
+ * an object left behind by a crashed process has to be shm_unlink()ed by the
+ * application first.
+ */
+struct RTCVideoFrameExportConfig {
+  string name;
+  RTCVideoFrameExportFormat format = RTCVideoFrameExportFormat::kARGB;
+  int max_width = 1920;
+  int max_height = 1080;
+  int slot_count = 3;
+};
+
+/**
+ * class RTCVideoFrameExport
+ *
+ * A video renderer that converts every frame straight into a shared memory
+ * ring, so a compositor in another process can read it without further
+ * copies. Frame callbacks registered on it are still invoked after the frame
+ * is written.
+ */
+class RTCVideoFrameExport
+    : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame>> {
+ public:
+  /**
+   * Creates and maps the shared memory. Returns null if that fails, or if
+   * the configuration is invalid. The object is unlinked when the export is
+   * destroyed; readers that still map it keep their view.
+   */
+  LIB_WEBRTC_API static scoped_refptr<RTCVideoFrameExport> Create(
+      const RTCVideoFrameExportConfig& config);
+
+  virtual const string name() const = 0;
+
+  virtual RTCVideoFrameExportFormat format() const = 0;
+
+  /**
+   * Total size of the mapping in bytes.
+   */
+  virtual size_t mapping_size() const = 0;
+
+  virtual uint64_t frames_written() const = 0;
+
+ protected:
+  virtual ~RTCVideoFrameExport() {}
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_HXX
@@ -5,6 +5,32 @@
 
 namespace libwebrtc {
 
+/**
+ * struct RTCVideoLatencyStats
+ *
+ * Glass-to-glass statistics of a renderer, for frames sent by a dummy video
+ * capturer with SetLatencyWatermark(true). Latency runs from the capture of
+ * a frame to its OnFrame() call; percentiles have 1 ms resolution. A freeze
+ * is a gap between rendered frames of at least three times the recent mean
+ * frame interval and at least 150 ms longer than it.
+ */
+struct RTCVideoLatencyStats {
+  int64_t frames_rendered = 0;
+  // Rendered frames that carried a readable watermark.
+  int64_t frames_marked = 0;
+  // Watermark sequence numbers that were never rendered.
+  int64_t frames_lost = 0;
+  int64_t freeze_count = 0;
+  int64_t total_freeze_ms = 0;
+  double latency_last_ms = 0;
+  double latency_min_ms = 0;
+  double latency_mean_ms = 0;
+  double latency_max_ms = 0;
+  double latency_p50_ms = 0;
+  double latency_p95_ms = 0;
+  double latency_p99_ms = 0;
+};
+
 template <typename VideoFrameT>
 class RTCVideoRenderer : public RefCountInterface {
  public:
@@ -19,6 +45,32 @@ class RTCVideoRenderer : public RefCountInterface {
   virtual void RegisterFrameCallback(OnFrameCallbackSafe callback) = 0;
   virtual void UnRegisterFrameCallback() = 0;
 
+  /**
+   * Enables reading the latency watermark of every frame. The capturer and
+   * the renderer must use the same monotonic clock, i.e. run on the same
+   * host. Renderers that do not support it ignore the call.
+   */
+  virtual void SetLatencyMeasurement(bool /*enable*/) {}
+
+  /**
+   * Copies the statistics since the measurement was enabled or last reset.
+   * Returns false if the renderer does not measure latency.
+   */
+  virtual bool GetLatencyStats(RTCVideoLatencyStats* /*stats*/) {
+    return false;
+  }
+
+  /**
+   * Copies the latency in microseconds of the newest |max_frames| marked
+   * frames, oldest first. Returns the number of values copied.
+   */
+  virtual int GetFrameLatencies(int64_t* /*latencies_us*/,
+                                int /*max_frames*/) {
+    return 0;
+  }
+
+  virtual void ResetLatencyStats() {}
+
  public:
   LIB_WEBRTC_API static scoped_refptr<RTCVideoRenderer<VideoFrameT>> Create();
 };
@@ -0,0 +1,134 @@
+#include "src/internal/crypto_queue_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "rtc_base/time_utils.h"
+#include "rtc_frame_cryptor.h"
+
+namespace libwebrtc {
+
+CryptoQueuePool::CryptoQueuePool(const FrameCryptorPoolOptions& options)
+    : sharding_(options.sharding) {
+  int count = options.queue_count;
+  if (count <= 0) {
+    count = std::min(
+        kMaxDefaultCryptoQueues,
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2));
+  }
+  queues_.resize(count);
+  for (Queue& queue : queues_) {
+    queue.thread = rtc::Thread::Create();
+    queue.thread->SetName("frame_crypto_thread", nullptr);
+    queue.thread->Start();
+  }
+}
+
+CryptoQueuePool::~CryptoQueuePool() {
+  for (Queue& queue : queues_) {
+    queue.thread->Stop();
+  }
+}
+
+int CryptoQueuePool::Acquire(const std::string& participant_id) {
+  webrtc::MutexLock lock(&mutex_);
+  size_t index = 0;
+  if (sharding_ == FrameCryptorSharding::kByParticipant) {
+    index = std::hash<std::string>()(participant_id) % queues_.size();
+  } else {
+    for (size_t i = 1; i < queues_.size(); i++) {
+      if (queues_[i].transformers < queues_[index].transformers) {
+        index = i;
+      }
+    }
+  }
+  queues_[index].transformers++;
+  return static_cast<int>(index);
+}
+
+void CryptoQueuePool::Release(int queue) {
+  webrtc::MutexLock lock(&mutex_);
+  queues_[queue].transformers--;
+}
+
+void CryptoQueuePool::OnFrame(int queue, size_t bytes, int64_t queue_delay_us,
+                              int64_t busy_us) {
+  webrtc::MutexLock lock(&mutex_);
+  Queue& q = queues_[queue];
+  q.frames++;
+  q.bytes += bytes;
+  q.queue_delay_total_us += queue_delay_us;
+  q.queue_delay_max_us = std::max(q.queue_delay_max_us, queue_delay_us);
+  q.busy_us += busy_us;
+}
+
+int CryptoQueuePool::GetStats(FrameCryptorQueueStats* stats,
+                              int max_queues) const {
+  if (!stats || max_queues <= 0) {
+    return 0;
+  }
+
+  webrtc::MutexLock lock(&mutex_);
+  size_t count = std::min(queues_.size(), static_cast<size_t>(max_queues));
+  for (size_t i = 0; i < count; i++) {
+    const Queue& q = queues_[i];
+    stats[i].transformers = q.transformers;
+    stats[i].frames = q.frames;
+    stats[i].bytes = q.bytes;
+    stats[i].queue_delay_avg_us =
+        q.frames > 0 ? q.queue_delay_total_us / static_cast<int64_t>(q.frames)
+                     : 0;
+    stats[i].queue_delay_max_us = q.queue_delay_max_us;
+    stats[i].busy_us = q.busy_us;
+  }
+  return static_cast<int>(count);
+}
+
+CryptoQueueTransformer::CryptoQueueTransformer(
+    rtc::scoped_refptr<CryptoQueuePool> pool, int queue,
+    rtc::scoped_refptr<webrtc::FrameTransformerInterface> transformer)
+    : pool_(pool), queue_(queue), transformer_(transformer) {}
+
+CryptoQueueTransformer::~CryptoQueueTransformer() {}
+
+void CryptoQueueTransformer::Transform(
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame) {
+  const size_t bytes = frame->GetData().size();
+  const int64_t posted_us = rtc::TimeMicros();
+  // The task holds the transformer but not this object: the pool, which
+  // outlives every task on its threads, is then never released there.
+  CryptoQueuePool* pool = pool_.get();
+  const int queue = queue_;
+  pool->thread(queue)->PostTask([pool, queue, bytes, posted_us,
+                                 transformer = transformer_,
+                                 frame = std::move(frame)]() mutable {
+    const int64_t start_us = rtc::TimeMicros();
+    transformer->Transform(std::move(frame));
+    pool->OnFrame(queue, bytes, start_us - posted_us,
+                  rtc::TimeMicros() - start_us);
+  });
+}
+
+void CryptoQueueTransformer::RegisterTransformedFrameCallback(
+    rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) {
+  transformer_->RegisterTransformedFrameCallback(callback);
+}
+
+void CryptoQueueTransformer::RegisterTransformedFrameSinkCallback(
+    rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+    uint32_t ssrc) {
+  transformer_->RegisterTransformedFrameSinkCallback(callback, ssrc);
+}
+
+void CryptoQueueTransformer::UnregisterTransformedFrameCallback() {
+  transformer_->UnregisterTransformedFrameCallback();
+}
+
+void CryptoQueueTransformer::UnregisterTransformedFrameSinkCallback(
+    uint32_t ssrc) {
+  transformer_->UnregisterTransformedFrameSinkCallback(ssrc);
+}
+
+}  // namespace libwebrtc
@@ -0,0 +1,108 @@
+#ifndef LIB_WEBRTC_CRYPTO_QUEUE_POOL_HXX
+#define LIB_WEBRTC_CRYPTO_QUEUE_POOL_HXX
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "api/frame_transformer_interface.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/ref_count.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+
+namespace libwebrtc {
+
+// Declared in rtc_frame_cryptor.h, which is not included here: its key ring
+// macros clash with api/crypto/frame_crypto_transformer.h when included
+// before it.
+enum class FrameCryptorSharding;
+struct FrameCryptorPoolOptions;
+struct FrameCryptorQueueStats;
+
+// Upper bound of the default number of crypto queues.
+static const int kMaxDefaultCryptoQueues = 8;
+
+/**
+ * class CryptoQueuePool
+ *
+ * Threads that frame cryptors transform frames on, instead of the
+ * signaling thread. A cryptor stays on the queue it was assigned, so its
+ * frames are transformed in order. Held by reference by every cryptor and
+ * transformer that uses it; the threads stop when the last one is gone.
+ */
+class CryptoQueuePool : public rtc::RefCountInterface {
+ public:
+  explicit CryptoQueuePool(const FrameCryptorPoolOptions& options);
+  ~CryptoQueuePool();
+
+  // Picks the queue of a new cryptor of |participant_id|.
+  int Acquire(const std::string& participant_id);
+
+  // Called when the cryptor on |queue| is destroyed.
+  void Release(int queue);
+
+  rtc::Thread* thread(int queue) { return queues_[queue].thread.get(); }
+
+  void OnFrame(int queue, size_t bytes, int64_t queue_delay_us,
+               int64_t busy_us);
+
+  int GetStats(FrameCryptorQueueStats* stats, int max_queues) const;
+
+ private:
+  struct Queue {
+    std::unique_ptr<rtc::Thread> thread;
+    int transformers = 0;
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+    int64_t queue_delay_total_us = 0;
+    int64_t queue_delay_max_us = 0;
+    int64_t busy_us = 0;
+  };
+
+  const FrameCryptorSharding sharding_;
+
+  // Guards the counters of the queues; the threads do not change.
+  mutable webrtc::Mutex mutex_;
+  std::vector<Queue> queues_;
+};
+
+/**
+ * class CryptoQueueTransformer
+ *
+ * Hands each frame to the crypto queue of its cryptor and transforms it
+ * there with |transformer|, which returns it through the callbacks
+ * registered by the RTP sender or receiver.
+ */
+class CryptoQueueTransformer : public webrtc::FrameTransformerInterface {
+ public:
+  CryptoQueueTransformer(
+      rtc::scoped_refptr<CryptoQueuePool> pool, int queue,
+      rtc::scoped_refptr<webrtc::FrameTransformerInterface> transformer);
+  ~CryptoQueueTransformer() override;
+
+  void Transform(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override;
+
+  void RegisterTransformedFrameCallback(
+      rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) override;
+
+  void RegisterTransformedFrameSinkCallback(
+      rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback,
+      uint32_t ssrc) override;
+
+  void UnregisterTransformedFrameCallback() override;
+
+  void UnregisterTransformedFrameSinkCallback(uint32_t ssrc) override;
+
+ private:
+  // Declared first, so |transformer_| is released before the pool threads
+  // it was created with stop.
+  rtc::scoped_refptr<CryptoQueuePool> pool_;
+  const int queue_;
+  rtc::scoped_refptr<webrtc::FrameTransformerInterface> transformer_;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_CRYPTO_QUEUE_POOL_HXX
@@ -7,6 +7,7 @@
 #include "src/internal/dummy_audio_capturer.h"
 
 #include "rtc_base/logging.h"
+#include "rtc_base/ref_counted_object.h"
 #include "rtc_base/time_utils.h"
 
 namespace webrtc {
@@ -14,13 +15,13 @@ namespace internal {
 
 DummyAudioCapturer::DummyAudioCapturer(
   TaskQueueFactory* task_queue_factory,
-  rtc::Thread* signaling_thread,
+  rtc::Thread* observer_thread,
   int bits_per_sample,
   int sample_rate_hz,
   size_t number_of_channels,
   const std::string name
 ) : task_queue_(task_queue_factory->CreateTaskQueue("DummyAudioCapturer", TaskQueueFactory::Priority::HIGH))
-  , signaling_thread_(signaling_thread)
+  , dispatcher_(new rtc::RefCountedObject<libwebrtc::ObserverDispatcher>(observer_thread))
   , name_(name)
   , bits_per_sample_(bits_per_sample)
   , sample_rate_hz_(sample_rate_hz)
@@ -34,6 +35,8 @@ DummyAudioCapturer::DummyAudioCapturer(
 DummyAudioCapturer::~DummyAudioCapturer()
 {
   Stop();
+  // Drops the OnStop() just posted; nothing may reach |observer_| now.
+  dispatcher_->Detach();
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
 
@@ -48,14 +51,9 @@ RTCCaptureState DummyAudioCapturer::Start()
   capture_state_ = RTCCaptureState::CS_RUNNING;
   task_queue_->PostTask([this] { CaptureFrame(); });
   if (observer_) {
-    if (!signaling_thread_->IsCurrent()) {
-      signaling_thread_->BlockingCall([&, this]() { 
-        if (observer_) { observer_->OnStart(); }
-      });
-    }
-    else {
-      observer_->OnStart();
-    }
+    dispatcher_->Post([this] {
+      if (observer_) { observer_->OnStart(); }
+    });
   }
   return capture_state_;
 }
@@ -67,13 +65,9 @@ void DummyAudioCapturer::Stop()
   }
 
   if (observer_) {
-    if (!signaling_thread_->IsCurrent()) {
-      signaling_thread_->BlockingCall([&, this]() { 
-        if (observer_) { observer_->OnStop(); }
-      });
-    } else {
-      observer_->OnStop();
-    }
+    dispatcher_->Post([this] {
+      if (observer_) { observer_->OnStop(); }
+    });
   }
   capture_state_ = RTCCaptureState::CS_STOPPED;
 }
@@ -12,6 +12,7 @@
 #include "api/media_stream_interface.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "rtc_base/thread.h"
+#include "src/internal/observer_dispatcher.h"
 #include "rtc_types.h"
 #include "rtc_audio_data.h"
 #include "rtc_dummy_audio_source.h"
@@ -31,7 +32,7 @@ class DummyAudioCapturer : public AudioSourceInterface {
  public:
   DummyAudioCapturer(
     TaskQueueFactory* task_queue_factory,
-    rtc::Thread* signaling_thread,
+    rtc::Thread* observer_thread,
     int bits_per_sample,
     int sample_rate_hz,
     size_t number_of_channels,
@@ -97,7 +98,7 @@ class DummyAudioCapturer : public AudioSourceInterface {
 
  private:
   std::unique_ptr<TaskQueueBase, TaskQueueDeleter> task_queue_;
-  rtc::Thread* signaling_thread_ = nullptr;
+  rtc::scoped_refptr<libwebrtc::ObserverDispatcher> dispatcher_;
   std::string name_;
   uint32_t sample_index_ = 0;
   int bits_per_sample_ = 16;
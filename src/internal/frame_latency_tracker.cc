@@ -0,0 +1,137 @@
+#include "src/internal/frame_latency_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/internal/frame_watermark.h"
+
+namespace libwebrtc {
+
+// 1 ms buckets; the last one collects everything above.
+static const size_t kHistogramBuckets = 2000;
+// Per-frame latencies kept for GetFrameLatencies().
+static const size_t kRecentFrames = 256;
+// Frame intervals the freeze threshold is averaged over.
+static const size_t kFreezeWindow = 30;
+static const int64_t kFreezeMinExtraUs = 150000;
+
+FrameLatencyTracker::FrameLatencyTracker()
+    : histogram_(kHistogramBuckets, 0), recent_us_(kRecentFrames, 0) {}
+
+void FrameLatencyTracker::OnFrame(const RTCVideoFrame& frame, int64_t now_us) {
+  FrameWatermark mark;
+  bool marked = ReadFrameWatermark(frame.DataY(), frame.StrideY(),
+                                   frame.width(), frame.height(), &mark);
+
+  webrtc::MutexLock lock(&mutex_);
+  stats_.frames_rendered++;
+  if (last_render_us_ > 0) {
+    OnFrameIntervalLocked(now_us - last_render_us_);
+  }
+  last_render_us_ = now_us;
+  if (!marked) {
+    return;
+  }
+
+  const int64_t latency_us = FrameWatermarkAge(mark, now_us);
+  const double latency_ms = latency_us / 1000.0;
+  stats_.latency_last_ms = latency_ms;
+  if (stats_.frames_marked == 0) {
+    stats_.latency_min_ms = stats_.latency_max_ms = latency_ms;
+  } else {
+    stats_.latency_min_ms = std::min(stats_.latency_min_ms, latency_ms);
+    stats_.latency_max_ms = std::max(stats_.latency_max_ms, latency_ms);
+  }
+  stats_.frames_marked++;
+  latency_sum_ms_ += latency_ms;
+  histogram_[std::min(static_cast<size_t>(latency_us / 1000),
+                      kHistogramBuckets - 1)]++;
+
+  recent_us_[recent_head_] = latency_us;
+  recent_head_ = (recent_head_ + 1) % kRecentFrames;
+  recent_count_ = std::min(recent_count_ + 1, kRecentFrames);
+
+  if (have_sequence_) {
+    uint16_t gap = static_cast<uint16_t>(mark.sequence - last_sequence_);
+    // A gap in the upper half is a reordered or repeated frame.
+    if (gap > 1 && gap < 0x8000) {
+      stats_.frames_lost += gap - 1;
+    }
+  }
+  have_sequence_ = true;
+  last_sequence_ = mark.sequence;
+}
+
+void FrameLatencyTracker::OnFrameIntervalLocked(int64_t interval_us) {
+  if (!intervals_us_.empty()) {
+    const int64_t mean_us =
+        interval_sum_us_ / static_cast<int64_t>(intervals_us_.size());
+    if (interval_us >= std::max(3 * mean_us, mean_us + kFreezeMinExtraUs)) {
+      stats_.freeze_count++;
+      stats_.total_freeze_ms += interval_us / 1000;
+    }
+  }
+  intervals_us_.push_back(interval_us);
+  interval_sum_us_ += interval_us;
+  if (intervals_us_.size() > kFreezeWindow) {
+    interval_sum_us_ -= intervals_us_.front();
+    intervals_us_.pop_front();
+  }
+}
+
+double FrameLatencyTracker::PercentileMsLocked(double p) const {
+  if (stats_.frames_marked == 0) {
+    return 0;
+  }
+  const int64_t rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(p * stats_.frames_marked)));
+  int64_t count = 0;
+  for (size_t i = 0; i < kHistogramBuckets; i++) {
+    count += histogram_[i];
+    if (count >= rank) {
+      return static_cast<double>(i);
+    }
+  }
+  return static_cast<double>(kHistogramBuckets - 1);
+}
+
+void FrameLatencyTracker::GetStats(RTCVideoLatencyStats* stats) const {
+  webrtc::MutexLock lock(&mutex_);
+  *stats = stats_;
+  if (stats_.frames_marked > 0) {
+    stats->latency_mean_ms = latency_sum_ms_ / stats_.frames_marked;
+  }
+  stats->latency_p50_ms = PercentileMsLocked(0.50);
+  stats->latency_p95_ms = PercentileMsLocked(0.95);
+  stats->latency_p99_ms = PercentileMsLocked(0.99);
+}
+
+int FrameLatencyTracker::GetFrameLatencies(int64_t* latencies_us,
+                                           int max_frames) const {
+  if (!latencies_us || max_frames <= 0) {
+    return 0;
+  }
+
+  webrtc::MutexLock lock(&mutex_);
+  size_t count = std::min(recent_count_, static_cast<size_t>(max_frames));
+  size_t first = (recent_head_ + kRecentFrames - count) % kRecentFrames;
+  for (size_t n = 0; n < count; n++) {
+    latencies_us[n] = recent_us_[(first + n) % kRecentFrames];
+  }
+  return static_cast<int>(count);
+}
+
+void FrameLatencyTracker::Reset() {
+  webrtc::MutexLock lock(&mutex_);
+  stats_ = RTCVideoLatencyStats();
+  latency_sum_ms_ = 0;
+  std::fill(histogram_.begin(), histogram_.end(), 0);
+  recent_head_ = 0;
+  recent_count_ = 0;
+  have_sequence_ = false;
+  last_render_us_ = 0;
+  intervals_us_.clear();
+  interval_sum_us_ = 0;
+}
+
+}  // namespace libwebrtc
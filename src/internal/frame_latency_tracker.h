@@ -0,0 +1,54 @@
+#ifndef LIB_WEBRTC_FRAME_LATENCY_TRACKER_HXX
+#define LIB_WEBRTC_FRAME_LATENCY_TRACKER_HXX
+
+#include <deque>
+#include <vector>
+
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_video_frame.h"
+#include "rtc_video_renderer.h"
+
+namespace libwebrtc {
+
+/**
+ * class FrameLatencyTracker
+ *
+ * Reads the watermark of each rendered frame and keeps the statistics behind
+ * RTCVideoRenderer::GetLatencyStats(). Latencies go into a 1 ms histogram,
+ * so percentiles cover every frame since the last Reset(); the latest
+ * per-frame values are kept in a ring as well.
+ */
+class FrameLatencyTracker {
+ public:
+  FrameLatencyTracker();
+
+  void OnFrame(const RTCVideoFrame& frame, int64_t now_us);
+
+  void GetStats(RTCVideoLatencyStats* stats) const;
+
+  int GetFrameLatencies(int64_t* latencies_us, int max_frames) const;
+
+  void Reset();
+
+ private:
+  void OnFrameIntervalLocked(int64_t interval_us);
+  double PercentileMsLocked(double p) const;
+
+  // Guards the members below.
+  mutable webrtc::Mutex mutex_;
+  RTCVideoLatencyStats stats_;
+  double latency_sum_ms_ = 0;
+  std::vector<int64_t> histogram_;
+  std::vector<int64_t> recent_us_;
+  size_t recent_head_ = 0;
+  size_t recent_count_ = 0;
+  bool have_sequence_ = false;
+  uint16_t last_sequence_ = 0;
+  int64_t last_render_us_ = 0;
+  std::deque<int64_t> intervals_us_;
+  int64_t interval_sum_us_ = 0;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_FRAME_LATENCY_TRACKER_HXX
@@ -0,0 +1,106 @@
+#include "src/internal/frame_watermark.h"
+
+namespace libwebrtc {
+
+namespace {
+
+const int kColumns = 16;
+const int kRows = 4;
+const int kBytes = kColumns * kRows / 8;
+const uint8_t kMagic = 0xB7;
+// Video range luma, so limited range conversions leave the levels alone.
+const uint8_t kBlack = 16;
+const uint8_t kWhite = 235;
+
+uint8_t Crc8(const uint8_t* data, int size) {
+  uint8_t crc = 0;
+  for (int i = 0; i < size; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07)
+                         : static_cast<uint8_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+bool IsMarkable(const uint8_t* data_y, int stride_y, int width, int height) {
+  return data_y != nullptr && width >= kFrameWatermarkMinSize &&
+         height >= kFrameWatermarkMinSize && stride_y >= width;
+}
+
+}  // namespace
+
+bool WriteFrameWatermark(uint8_t* data_y, int stride_y, int width, int height,
+                         const FrameWatermark& mark) {
+  if (!IsMarkable(data_y, stride_y, width, height)) {
+    return false;
+  }
+
+  uint8_t bytes[kBytes] = {kMagic,
+                           static_cast<uint8_t>(mark.sequence >> 8),
+                           static_cast<uint8_t>(mark.sequence),
+                           static_cast<uint8_t>(mark.timestamp_us >> 24),
+                           static_cast<uint8_t>(mark.timestamp_us >> 16),
+                           static_cast<uint8_t>(mark.timestamp_us >> 8),
+                           static_cast<uint8_t>(mark.timestamp_us)};
+  bytes[kBytes - 1] = Crc8(bytes, kBytes - 1);
+
+  const int block_width = width / kColumns;
+  const int block_height = height / (kRows * 4);
+  for (int n = 0; n < kColumns * kRows; n++) {
+    const uint8_t level = (bytes[n / 8] >> (7 - n % 8)) & 1 ? kWhite : kBlack;
+    uint8_t* block = data_y + (n / kColumns) * block_height * stride_y +
+                     (n % kColumns) * block_width;
+    for (int y = 0; y < block_height; y++) {
+      for (int x = 0; x < block_width; x++) {
+        block[y * stride_y + x] = level;
+      }
+    }
+  }
+  return true;
+}
+
+bool ReadFrameWatermark(const uint8_t* data_y, int stride_y, int width,
+                        int height, FrameWatermark* mark) {
+  if (!mark || !IsMarkable(data_y, stride_y, width, height)) {
+    return false;
+  }
+
+  // Only the middle half of each block is sampled, away from the edges the
+  // codec blurs into the neighbouring blocks.
+  const int block_width = width / kColumns;
+  const int block_height = height / (kRows * 4);
+  const int sample_x = block_width / 4;
+  const int sample_y = block_height / 4;
+  const int sample_width = block_width - 2 * sample_x;
+  const int sample_height = block_height - 2 * sample_y;
+
+  uint8_t bytes[kBytes] = {0};
+  for (int n = 0; n < kColumns * kRows; n++) {
+    const uint8_t* block = data_y +
+                           ((n / kColumns) * block_height + sample_y) *
+                               stride_y +
+                           (n % kColumns) * block_width + sample_x;
+    int sum = 0;
+    for (int y = 0; y < sample_height; y++) {
+      for (int x = 0; x < sample_width; x++) {
+        sum += block[y * stride_y + x];
+      }
+    }
+    if (sum > 128 * sample_width * sample_height) {
+      bytes[n / 8] |= static_cast<uint8_t>(0x80 >> (n % 8));
+    }
+  }
+
+  if (bytes[0] != kMagic || bytes[kBytes - 1] != Crc8(bytes, kBytes - 1)) {
+    return false;
+  }
+  mark->sequence = static_cast<uint16_t>((bytes[1] << 8) | bytes[2]);
+  mark->timestamp_us = (static_cast<uint32_t>(bytes[3]) << 24) |
+                       (static_cast<uint32_t>(bytes[4]) << 16) |
+                       (static_cast<uint32_t>(bytes[5]) << 8) | bytes[6];
+  return true;
+}
+
+}  // namespace libwebrtc
@@ -0,0 +1,39 @@
+#ifndef LIB_WEBRTC_FRAME_WATERMARK_HXX
+#define LIB_WEBRTC_FRAME_WATERMARK_HXX
+
+#include <inttypes.h>
+
+namespace libwebrtc {
+
+// What a frame watermark carries: the sequence number of the frame and the
+// low 32 bits of its capture time in microseconds.
+struct FrameWatermark {
+  uint16_t sequence = 0;
+  uint32_t timestamp_us = 0;
+};
+
+// Frames need at least this many pixels in each direction to be marked.
+static const int kFrameWatermarkMinSize = 32;
+
+// Paints |mark| into the top quarter of the Y plane as a 16 x 4 grid of black
+// and white blocks sized relative to the frame, so it can still be read after
+// lossy coding and after the encoder scales the frame down. Returns false if
+// the plane is too small.
+bool WriteFrameWatermark(uint8_t* data_y, int stride_y, int width, int height,
+                         const FrameWatermark& mark);
+
+// Reads a watermark written by WriteFrameWatermark(). Returns false if the
+// frame does not carry one or it did not survive intact.
+bool ReadFrameWatermark(const uint8_t* data_y, int stride_y, int width,
+                        int height, FrameWatermark* mark);
+
+// Microseconds from the capture time in |mark| to |now_us|, which must be
+// on the same clock and less than 2^32 us (about 71 minutes) later.
+inline int64_t FrameWatermarkAge(const FrameWatermark& mark, int64_t now_us) {
+  return static_cast<uint32_t>(static_cast<uint32_t>(now_us) -
+                               mark.timestamp_us);
+}
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_FRAME_WATERMARK_HXX
@@ -32,7 +32,7 @@ std::vector<unsigned char> EncodeRGBToJpeg(const unsigned char* rgb_buf,
   cinfo.image_width = width;
   cinfo.image_height = height;
   cinfo.input_components = color_planes;
-  cinfo.in_color_space = JCS_EXT_BGR;
+  cinfo.in_color_space = color_planes == 4 ? JCS_EXT_BGRX : JCS_EXT_BGR;
   jpeg_set_defaults(&cinfo);
   jpeg_set_quality(&cinfo, quality, TRUE);
 
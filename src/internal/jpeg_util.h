@@ -6,7 +6,8 @@
 #include <vector>
 
 namespace libwebrtc {
-// Encodes the given RGB data into a JPEG image.
+// Encodes the given RGB data into a JPEG image. Pixels are B, G, R bytes,
+// followed by an ignored fourth byte when |color_planes| is 4.
 std::vector<unsigned char> EncodeRGBToJpeg(const unsigned char* data, int width,
                                            int height, int color_planes,
                                            int quality);
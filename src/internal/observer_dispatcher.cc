@@ -0,0 +1,69 @@
+#include "src/internal/observer_dispatcher.h"
+
+#include <utility>
+
+#include "api/scoped_refptr.h"
+
+namespace libwebrtc {
+
+void ObserverDispatcher::SetThread(rtc::Thread* thread) {
+  webrtc::MutexLock lock(&mutex_);
+  thread_ = thread;
+}
+
+void ObserverDispatcher::Post(std::function<void()> event) {
+  rtc::Thread* thread = nullptr;
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (detached_ || !thread_) {
+      return;
+    }
+    events_.push_back(std::move(event));
+    // One delivery task drains the whole queue, which keeps the events in
+    // order even when the delivery thread is changed in between.
+    if (scheduled_) {
+      return;
+    }
+    scheduled_ = true;
+    thread = thread_;
+  }
+  rtc::scoped_refptr<ObserverDispatcher> self(this);
+  thread->PostTask([self] { self->Deliver(); });
+}
+
+void ObserverDispatcher::Deliver() {
+  webrtc::MutexLock delivery(&delivery_mutex_);
+  for (;;) {
+    std::function<void()> event;
+    {
+      webrtc::MutexLock lock(&mutex_);
+      if (detached_ || events_.empty()) {
+        scheduled_ = false;
+        delivering_ = false;
+        return;
+      }
+      event = std::move(events_.front());
+      events_.pop_front();
+      delivering_thread_ = rtc::CurrentThreadRef();
+      delivering_ = true;
+    }
+    event();
+  }
+}
+
+void ObserverDispatcher::Detach() {
+  {
+    webrtc::MutexLock lock(&mutex_);
+    detached_ = true;
+    events_.clear();
+    // The owner is being released by its own observer; the event returns
+    // to Deliver() only after Detach() does.
+    if (delivering_ &&
+        rtc::IsThreadRefEqual(delivering_thread_, rtc::CurrentThreadRef())) {
+      return;
+    }
+  }
+  webrtc::MutexLock delivery(&delivery_mutex_);
+}
+
+}  // namespace libwebrtc
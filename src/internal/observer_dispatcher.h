@@ -0,0 +1,55 @@
+#ifndef LIB_WEBRTC_OBSERVER_DISPATCHER_HXX
+#define LIB_WEBRTC_OBSERVER_DISPATCHER_HXX
+
+#include <deque>
+#include <functional>
+
+#include "rtc_base/platform_thread_types.h"
+#include "rtc_base/ref_count.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+
+namespace libwebrtc {
+
+/**
+ * class ObserverDispatcher
+ *
+ * Delivers the observer events of one capturer or media list on a delivery
+ * thread, in the order they were posted, without blocking the posting
+ * thread. The owner calls Detach() when it is destroyed; events still queued
+ * are dropped, so they may refer to the owner through a raw pointer.
+ */
+class ObserverDispatcher : public rtc::RefCountInterface {
+ public:
+  explicit ObserverDispatcher(rtc::Thread* thread) : thread_(thread) {}
+
+  // Delivers events that are not yet running on |thread| from now on.
+  void SetThread(rtc::Thread* thread);
+
+  // Queues |event|. Dropped once Detach() was called.
+  void Post(std::function<void()> event);
+
+  // Drops the queued events and waits for a running one to return, unless it
+  // is called from that event.
+  void Detach();
+
+ private:
+  void Deliver();
+
+ private:
+  // Held while an event runs.
+  webrtc::Mutex delivery_mutex_;
+
+  // Guards the members below.
+  webrtc::Mutex mutex_;
+  rtc::Thread* thread_;
+  std::deque<std::function<void()>> events_;
+  bool scheduled_ = false;
+  bool detached_ = false;
+  rtc::PlatformThreadRef delivering_thread_{};
+  bool delivering_ = false;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_OBSERVER_DISPATCHER_HXX
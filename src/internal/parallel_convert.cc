@@ -0,0 +1,256 @@
+#include "parallel_convert.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "libyuv/convert.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/scale.h"
+#include "rtc_base/event.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+
+namespace libwebrtc {
+
+// Bands thinner than this cost more to hand over than to convert.
+static const int kMinBandRows = 64;
+
+/**
+ * Worker threads shared by every conversion. Held by reference while a
+ * conversion uses it, so it can be replaced while frames are in flight.
+ */
+class SliceWorkerPool : public rtc::RefCountInterface {
+ public:
+  explicit SliceWorkerPool(int workers) {
+    for (int i = 0; i < workers; i++) {
+      std::unique_ptr<rtc::Thread> thread = rtc::Thread::Create();
+      thread->SetName("slice_convert_thread", nullptr);
+      thread->Start();
+      threads_.push_back(std::move(thread));
+    }
+  }
+
+  ~SliceWorkerPool() {
+    for (auto& thread : threads_) {
+      thread->Stop();
+    }
+  }
+
+  int size() const { return static_cast<int>(threads_.size()); }
+
+  rtc::Thread* thread(int index) { return threads_[index].get(); }
+
+ private:
+  std::vector<std::unique_ptr<rtc::Thread>> threads_;
+};
+
+// Read without the lock on every frame, so a disabled pool costs nothing.
+static std::atomic<int> g_threads{1};
+static std::atomic<int64_t> g_min_pixels{kParallelConversionMinPixels};
+
+static webrtc::Mutex& PoolMutex() {
+  static webrtc::Mutex* mutex = new webrtc::Mutex();
+  return *mutex;
+}
+
+// Guarded by PoolMutex().
+static rtc::scoped_refptr<SliceWorkerPool>& Pool() {
+  static rtc::scoped_refptr<SliceWorkerPool>* pool =
+      new rtc::scoped_refptr<SliceWorkerPool>();
+  return *pool;
+}
+
+void SetParallelConversion(int threads, int min_pixels) {
+  threads = std::max(threads, 1);
+  rtc::scoped_refptr<SliceWorkerPool> old_pool;
+  {
+    webrtc::MutexLock lock(&PoolMutex());
+    g_min_pixels = std::max(min_pixels, 0);
+    if (threads == g_threads) {
+      return;
+    }
+    old_pool = Pool();
+    Pool() = threads > 1
+                 ? rtc::make_ref_counted<SliceWorkerPool>(threads - 1)
+                 : nullptr;
+    g_threads = threads;
+  }
+  // |old_pool| stops its workers here, outside the lock, once the
+  // conversions still using it are done.
+}
+
+void ParallelRows(int64_t pixels, int height, int row_align,
+                  rtc::FunctionView<void(int first_row, int rows)> convert) {
+  rtc::scoped_refptr<SliceWorkerPool> pool;
+  if (g_threads.load(std::memory_order_relaxed) > 1 &&
+      pixels >= g_min_pixels.load(std::memory_order_relaxed)) {
+    webrtc::MutexLock lock(&PoolMutex());
+    pool = Pool();
+  }
+
+  row_align = std::max(row_align, 1);
+  int bands = 1;
+  if (pool) {
+    bands = std::min(pool->size() + 1,
+                     height / std::max(row_align, kMinBandRows));
+  }
+  if (bands <= 1) {
+    convert(0, height);
+    return;
+  }
+
+  int band_rows = (height + bands - 1) / bands;
+  band_rows = (band_rows + row_align - 1) / row_align * row_align;
+
+  std::atomic<int> pending{0};
+  rtc::Event done;
+  int posted = (height - 1) / band_rows;
+  pending = posted;
+  for (int band = 1; band <= posted; band++) {
+    int first_row = band * band_rows;
+    int rows = std::min(band_rows, height - first_row);
+    pool->thread(band - 1)->PostTask([&, first_row, rows] {
+      convert(first_row, rows);
+      if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        done.Set();
+      }
+    });
+  }
+  convert(0, band_rows);
+  done.Wait(rtc::Event::kForever);
+}
+
+void ParallelI420ToARGB(const webrtc::I420BufferInterface& src,
+                        RTCVideoFrameTypeARGB type, uint8_t* dst,
+                        int dst_stride) {
+  const int width = src.width();
+  ParallelRows(
+      static_cast<int64_t>(width) * src.height(), src.height(), 2,
+      [&](int y, int rows) {
+        const uint8_t* src_y = src.DataY() + y * src.StrideY();
+        const uint8_t* src_u = src.DataU() + y / 2 * src.StrideU();
+        const uint8_t* src_v = src.DataV() + y / 2 * src.StrideV();
+        uint8_t* dst_argb = dst + y * dst_stride;
+        switch (type) {
+          case RTCVideoFrameTypeARGB::kARGB:
+            libyuv::I420ToARGB(src_y, src.StrideY(), src_u, src.StrideU(),
+                               src_v, src.StrideV(), dst_argb, dst_stride,
+                               width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kBGRA:
+            libyuv::I420ToBGRA(src_y, src.StrideY(), src_u, src.StrideU(),
+                               src_v, src.StrideV(), dst_argb, dst_stride,
+                               width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kABGR:
+            libyuv::I420ToABGR(src_y, src.StrideY(), src_u, src.StrideU(),
+                               src_v, src.StrideV(), dst_argb, dst_stride,
+                               width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kRGBA:
+            libyuv::I420ToRGBA(src_y, src.StrideY(), src_u, src.StrideU(),
+                               src_v, src.StrideV(), dst_argb, dst_stride,
+                               width, rows);
+            break;
+          default:
+            break;
+        }
+      });
+}
+
+int ParallelARGBToI420(RTCVideoFrameTypeARGB type, const uint8_t* src,
+                       int src_stride, webrtc::I420Buffer* dst) {
+  const int width = dst->width();
+  std::atomic<int> result{0};
+  ParallelRows(
+      static_cast<int64_t>(width) * dst->height(), dst->height(), 2,
+      [&](int y, int rows) {
+        const uint8_t* src_argb = src + y * src_stride;
+        uint8_t* dst_y = dst->MutableDataY() + y * dst->StrideY();
+        uint8_t* dst_u = dst->MutableDataU() + y / 2 * dst->StrideU();
+        uint8_t* dst_v = dst->MutableDataV() + y / 2 * dst->StrideV();
+        int r = -1;
+        switch (type) {
+          case RTCVideoFrameTypeARGB::kARGB:
+            r = libyuv::ARGBToI420(src_argb, src_stride, dst_y,
+                                   dst->StrideY(), dst_u, dst->StrideU(),
+                                   dst_v, dst->StrideV(), width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kBGRA:
+            r = libyuv::BGRAToI420(src_argb, src_stride, dst_y,
+                                   dst->StrideY(), dst_u, dst->StrideU(),
+                                   dst_v, dst->StrideV(), width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kABGR:
+            r = libyuv::ABGRToI420(src_argb, src_stride, dst_y,
+                                   dst->StrideY(), dst_u, dst->StrideU(),
+                                   dst_v, dst->StrideV(), width, rows);
+            break;
+          case RTCVideoFrameTypeARGB::kRGBA:
+            r = libyuv::RGBAToI420(src_argb, src_stride, dst_y,
+                                   dst->StrideY(), dst_u, dst->StrideU(),
+                                   dst_v, dst->StrideV(), width, rows);
+            break;
+          default:
+            break;
+        }
+        if (r != 0) {
+          result = r;
+        }
+      });
+  return result;
+}
+
+void ParallelI420Scale(const webrtc::I420BufferInterface& src,
+                       webrtc::I420Buffer* dst) {
+  const int src_height = src.height();
+  const int dst_height = dst->height();
+  if (dst_height * 2 >= src_height) {
+    // Down to 2x libyuv filters bilinearly, reading source rows on both
+    // sides of a band edge, so the frame is scaled in one call.
+    libyuv::I420Scale(src.DataY(), src.StrideY(), src.DataU(), src.StrideU(),
+                      src.DataV(), src.StrideV(), src.width(), src_height,
+                      dst->MutableDataY(), dst->StrideY(),
+                      dst->MutableDataU(), dst->StrideU(),
+                      dst->MutableDataV(), dst->StrideV(), dst->width(),
+                      dst_height, libyuv::kFilterBox);
+    return;
+  }
+
+  // Past 2x the box filter averages only the source rows that map to each
+  // destination row. Bands start on a destination row that maps to a
+  // whole, even source row, so each band reads just its own source rows;
+  // the result can still differ from a single call by rounding in the
+  // rows next to a band edge.
+  int gcd = std::gcd(src_height, dst_height);
+  int dst_step = dst_height / gcd;
+  int src_step = src_height / gcd;
+  if ((dst_step | src_step) & 1) {
+    dst_step *= 2;
+    src_step *= 2;
+  }
+
+  int64_t pixels = std::max(static_cast<int64_t>(src.width()) * src_height,
+                            static_cast<int64_t>(dst->width()) * dst_height);
+  ParallelRows(pixels, dst_height, dst_step, [&](int y, int rows) {
+    int src_y = y / dst_step * src_step;
+    int src_rows = y + rows == dst_height ? src_height - src_y
+                                          : rows / dst_step * src_step;
+    libyuv::I420Scale(src.DataY() + src_y * src.StrideY(), src.StrideY(),
+                      src.DataU() + src_y / 2 * src.StrideU(), src.StrideU(),
+                      src.DataV() + src_y / 2 * src.StrideV(), src.StrideV(),
+                      src.width(), src_rows,
+                      dst->MutableDataY() + y * dst->StrideY(),
+                      dst->StrideY(),
+                      dst->MutableDataU() + y / 2 * dst->StrideU(),
+                      dst->StrideU(),
+                      dst->MutableDataV() + y / 2 * dst->StrideV(),
+                      dst->StrideV(), dst->width(), rows, libyuv::kFilterBox);
+  });
+}
+
+}  // namespace libwebrtc
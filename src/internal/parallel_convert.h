@@ -0,0 +1,45 @@
+#ifndef LIB_WEBRTC_PARALLEL_CONVERT_HXX
+#define LIB_WEBRTC_PARALLEL_CONVERT_HXX
+
+#include <inttypes.h>
+
+#include "api/function_view.h"
+#include "api/video/i420_buffer.h"
+#include "rtc_types.h"
+
+namespace libwebrtc {
+
+// Frames of at least this many pixels are converted in parallel, once
+// parallel conversion is enabled.
+static const int kParallelConversionMinPixels = 2560 * 1440;
+
+// Enables slice-parallel conversion on a shared pool of |threads| - 1
+// workers plus the calling thread, for frames of at least |min_pixels|
+// pixels. |threads| <= 1 disables it and stops the workers.
+void SetParallelConversion(int threads, int min_pixels);
+
+// Calls |convert(first_row, rows)| for horizontal bands covering
+// [0, height). Band boundaries are multiples of |row_align|. Runs as one
+// band on the calling thread when parallel conversion is disabled or
+// |pixels| is below the threshold; returns once every band is done.
+void ParallelRows(int64_t pixels, int height, int row_align,
+                  rtc::FunctionView<void(int first_row, int rows)> convert);
+
+// Converts |src| to packed 32-bit |type| pixels of the same size.
+void ParallelI420ToARGB(const webrtc::I420BufferInterface& src,
+                        RTCVideoFrameTypeARGB type, uint8_t* dst,
+                        int dst_stride);
+
+// Converts the top-left dst->width() x dst->height() pixels of |src| to I420.
+// Returns 0 on success.
+int ParallelARGBToI420(RTCVideoFrameTypeARGB type, const uint8_t* src,
+                       int src_stride, webrtc::I420Buffer* dst);
+
+// Box-filter scales |src| to the size of |dst|, as I420Buffer::ScaleFrom.
+// Only reductions past 2x are split across threads.
+void ParallelI420Scale(const webrtc::I420BufferInterface& src,
+                       webrtc::I420Buffer* dst);
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_PARALLEL_CONVERT_HXX
@@ -0,0 +1,196 @@
+#include "src/internal/snapshot_key_provider.h"
+
+#include <atomic>
+#include <utility>
+
+#include "rtc_base/ref_counted_object.h"
+
+namespace libwebrtc {
+
+// Participant id under which the shared key is kept, as
+// webrtc::DefaultKeyProviderImpl does.
+static const char kSharedKeyId[] = "shared";
+
+SnapshotKeyProvider::SnapshotKeyProvider(
+    const webrtc::KeyProviderOptions& options)
+    : options_(options), keys_(std::make_shared<const KeyMap>()) {}
+
+SnapshotKeyProvider::~SnapshotKeyProvider() {}
+
+std::shared_ptr<const SnapshotKeyProvider::KeyMap>
+SnapshotKeyProvider::Snapshot() const {
+  return std::atomic_load(&keys_);
+}
+
+rtc::scoped_refptr<webrtc::ParticipantKeyHandler> SnapshotKeyProvider::Find(
+    const std::string& participant_id) const {
+  std::shared_ptr<const KeyMap> keys = Snapshot();
+  auto it = keys->find(participant_id);
+  return it != keys->end() ? it->second : nullptr;
+}
+
+std::vector<rtc::scoped_refptr<webrtc::ParticipantKeyHandler>>
+SnapshotKeyProvider::FindOrAdd(
+    const std::vector<const std::string*>& participant_ids) {
+  std::vector<rtc::scoped_refptr<webrtc::ParticipantKeyHandler>> handlers(
+      participant_ids.size());
+  webrtc::MutexLock lock(&write_mutex_);
+  std::shared_ptr<const KeyMap> keys = Snapshot();
+  std::shared_ptr<KeyMap> copy;
+  for (size_t i = 0; i < participant_ids.size(); i++) {
+    const std::string& id = *participant_ids[i];
+    const KeyMap& current = copy ? *copy : *keys;
+    auto it = current.find(id);
+    if (it != current.end()) {
+      handlers[i] = it->second;
+      continue;
+    }
+    if (!copy) {
+      copy = std::make_shared<KeyMap>(*keys);
+    }
+    handlers[i] = rtc::make_ref_counted<webrtc::ParticipantKeyHandler>(this);
+    (*copy)[id] = handlers[i];
+  }
+  if (copy) {
+    std::atomic_store(&keys_, std::shared_ptr<const KeyMap>(std::move(copy)));
+  }
+  return handlers;
+}
+
+int SnapshotKeyProvider::SetKeys(const std::vector<KeyEntry>& entries) {
+  std::vector<const std::string*> participant_ids;
+  participant_ids.reserve(entries.size());
+  for (const KeyEntry& entry : entries) {
+    participant_ids.push_back(&entry.participant_id);
+  }
+  std::vector<rtc::scoped_refptr<webrtc::ParticipantKeyHandler>> handlers =
+      FindOrAdd(participant_ids);
+
+  // Deriving a key is the slow part; it only holds the handler's own lock.
+  int count = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    if (entries[i].index < 0 || entries[i].index >= options_.key_ring_size) {
+      continue;
+    }
+    handlers[i]->SetKey(entries[i].key, entries[i].index);
+    count++;
+  }
+  return count;
+}
+
+bool SnapshotKeyProvider::SetSharedKey(int key_index,
+                                       std::vector<uint8_t> key) {
+  if (!options_.shared_key) {
+    return false;
+  }
+
+  const std::string shared_id = kSharedKeyId;
+  FindOrAdd({&shared_id})[0]->SetKey(key, key_index);
+  std::shared_ptr<const KeyMap> keys = Snapshot();
+  for (const auto& pair : *keys) {
+    if (pair.first != shared_id) {
+      pair.second->SetKey(key, key_index);
+    }
+  }
+  return true;
+}
+
+const rtc::scoped_refptr<webrtc::ParticipantKeyHandler>
+SnapshotKeyProvider::GetSharedKey(const std::string participant_id) {
+  if (!options_.shared_key) {
+    return nullptr;
+  }
+
+  rtc::scoped_refptr<webrtc::ParticipantKeyHandler> handler =
+      Find(participant_id);
+  if (handler) {
+    return handler;
+  }
+
+  webrtc::MutexLock lock(&write_mutex_);
+  std::shared_ptr<const KeyMap> keys = Snapshot();
+  auto it = keys->find(participant_id);
+  if (it != keys->end()) {
+    return it->second;
+  }
+  auto shared = keys->find(kSharedKeyId);
+  if (shared == keys->end()) {
+    return nullptr;
+  }
+  handler = shared->second->Clone();
+  std::shared_ptr<KeyMap> copy = std::make_shared<KeyMap>(*keys);
+  (*copy)[participant_id] = handler;
+  std::atomic_store(&keys_, std::shared_ptr<const KeyMap>(std::move(copy)));
+  return handler;
+}
+
+const std::vector<uint8_t> SnapshotKeyProvider::RatchetSharedKey(
+    int key_index) {
+  rtc::scoped_refptr<webrtc::ParticipantKeyHandler> shared =
+      Find(kSharedKeyId);
+  if (!shared) {
+    return std::vector<uint8_t>();
+  }
+
+  std::vector<uint8_t> new_key = shared->RatchetKey(key_index);
+  if (options_.shared_key) {
+    std::shared_ptr<const KeyMap> keys = Snapshot();
+    for (const auto& pair : *keys) {
+      if (pair.first != kSharedKeyId) {
+        pair.second->SetKey(new_key, key_index);
+      }
+    }
+  }
+  return new_key;
+}
+
+const std::vector<uint8_t> SnapshotKeyProvider::ExportSharedKey(
+    int key_index) const {
+  return ExportKey(kSharedKeyId, key_index);
+}
+
+bool SnapshotKeyProvider::SetKey(const std::string participant_id,
+                                 int key_index, std::vector<uint8_t> key) {
+  return SetKeys({{participant_id, key_index, std::move(key)}}) == 1;
+}
+
+const rtc::scoped_refptr<webrtc::ParticipantKeyHandler>
+SnapshotKeyProvider::GetKey(const std::string participant_id) const {
+  return Find(participant_id);
+}
+
+const std::vector<uint8_t> SnapshotKeyProvider::RatchetKey(
+    const std::string participant_id, int key_index) {
+  rtc::scoped_refptr<webrtc::ParticipantKeyHandler> handler =
+      Find(participant_id);
+  if (!handler) {
+    return std::vector<uint8_t>();
+  }
+  return handler->RatchetKey(key_index);
+}
+
+const std::vector<uint8_t> SnapshotKeyProvider::ExportKey(
+    const std::string participant_id, int key_index) const {
+  rtc::scoped_refptr<webrtc::ParticipantKeyHandler> handler =
+      Find(participant_id);
+  if (!handler) {
+    return std::vector<uint8_t>();
+  }
+  auto key_set = handler->GetKeySet(key_index);
+  if (!key_set) {
+    return std::vector<uint8_t>();
+  }
+  return key_set->material;
+}
+
+void SnapshotKeyProvider::SetSifTrailer(const std::vector<uint8_t> trailer) {
+  webrtc::MutexLock lock(&sif_mutex_);
+  sif_trailer_ = trailer;
+}
+
+std::vector<uint8_t> SnapshotKeyProvider::GetSifTrailer() const {
+  webrtc::MutexLock lock(&sif_mutex_);
+  return sif_trailer_;
+}
+
+}  // namespace libwebrtc
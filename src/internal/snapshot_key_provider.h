@@ -0,0 +1,97 @@
+#ifndef LIB_WEBRTC_SNAPSHOT_KEY_PROVIDER_HXX
+#define LIB_WEBRTC_SNAPSHOT_KEY_PROVIDER_HXX
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "api/crypto/frame_crypto_transformer.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace libwebrtc {
+
+/**
+ * class SnapshotKeyProvider
+ *
+ * Key provider with the behaviour of webrtc::DefaultKeyProviderImpl, read
+ * optimised for the frame path. The participant map is an immutable
+ * snapshot that lookups load without a lock; writers copy it, add the new
+ * participants and publish the copy. Keys are derived outside the map lock,
+ * on the participant's own key handler, so a rotation only ever delays the
+ * frames of the participant being rotated.
+ */
+class SnapshotKeyProvider : public webrtc::KeyProvider {
+ public:
+  struct KeyEntry {
+    std::string participant_id;
+    int index;
+    std::vector<uint8_t> key;
+  };
+
+  explicit SnapshotKeyProvider(const webrtc::KeyProviderOptions& options);
+  ~SnapshotKeyProvider() override;
+
+  // Sets every key of |entries|, publishing the participant map once.
+  // Returns the number of keys set.
+  int SetKeys(const std::vector<KeyEntry>& entries);
+
+  bool SetSharedKey(int key_index, std::vector<uint8_t> key) override;
+
+  const rtc::scoped_refptr<webrtc::ParticipantKeyHandler> GetSharedKey(
+      const std::string participant_id) override;
+
+  const std::vector<uint8_t> RatchetSharedKey(int key_index) override;
+
+  const std::vector<uint8_t> ExportSharedKey(int key_index) const override;
+
+  bool SetKey(const std::string participant_id, int key_index,
+              std::vector<uint8_t> key) override;
+
+  const rtc::scoped_refptr<webrtc::ParticipantKeyHandler> GetKey(
+      const std::string participant_id) const override;
+
+  const std::vector<uint8_t> RatchetKey(const std::string participant_id,
+                                        int key_index) override;
+
+  const std::vector<uint8_t> ExportKey(const std::string participant_id,
+                                       int key_index) const override;
+
+  void SetSifTrailer(const std::vector<uint8_t> trailer) override;
+
+  std::vector<uint8_t> GetSifTrailer() const override;
+
+  webrtc::KeyProviderOptions& options() override { return options_; }
+
+ private:
+  typedef std::unordered_map<std::string,
+                             rtc::scoped_refptr<webrtc::ParticipantKeyHandler>>
+      KeyMap;
+
+  std::shared_ptr<const KeyMap> Snapshot() const;
+
+  rtc::scoped_refptr<webrtc::ParticipantKeyHandler> Find(
+      const std::string& participant_id) const;
+
+  // Returns the handlers of |participant_ids|, adding the missing ones to
+  // the map in a single publication.
+  std::vector<rtc::scoped_refptr<webrtc::ParticipantKeyHandler>> FindOrAdd(
+      const std::vector<const std::string*>& participant_ids);
+
+ private:
+  webrtc::KeyProviderOptions options_;
+  // Loaded and stored atomically; only replaced under |write_mutex_|.
+  std::shared_ptr<const KeyMap> keys_;
+
+  // Serialises the writers of |keys_|.
+  webrtc::Mutex write_mutex_;
+
+  // Guards the member below.
+  mutable webrtc::Mutex sif_mutex_;
+  std::vector<uint8_t> sif_trailer_;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_SNAPSHOT_KEY_PROVIDER_HXX
@@ -41,12 +41,18 @@ void VideoCapturer::OnFrame(const VideoFrame& frame) {
     rtc::scoped_refptr<I420Buffer> scaled_buffer =
         I420Buffer::Create(out_width, out_height);
     scaled_buffer->ScaleFrom(*frame.video_frame_buffer()->ToI420());
-    broadcaster_.OnFrame(VideoFrame::Builder()
-                             .set_video_frame_buffer(scaled_buffer)
-                             .set_rotation(kVideoRotation_0)
-                             .set_timestamp_us(frame.timestamp_us())
-                             .set_id(frame.id())
-                             .build());
+    VideoFrame::Builder builder;
+    builder.set_video_frame_buffer(scaled_buffer)
+        .set_rotation(kVideoRotation_0)
+        .set_timestamp_us(frame.timestamp_us())
+        .set_id(frame.id());
+    if (frame.has_update_rect()) {
+      // Keeps the encoder hint of captures that report what changed.
+      builder.set_update_rect(frame.update_rect().ScaleWithFrame(
+          frame.width(), frame.height(), 0, 0, frame.width(), frame.height(),
+          out_width, out_height));
+    }
+    broadcaster_.OnFrame(builder.build());
   } else {
     // No adaptations needed, just return the frame as is.
     broadcaster_.OnFrame(frame);
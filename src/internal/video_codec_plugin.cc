@@ -0,0 +1,556 @@
+#include "src/internal/video_codec_plugin.h"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "absl/types/optional.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/scalability_mode.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_decoder_software_fallback_wrapper.h"
+#include "api/video_codecs/video_encoder.h"
+#include "api/video_codecs/video_encoder_software_fallback_wrapper.h"
+#include "common_video/include/video_frame_buffer.h"
+#include "media/base/media_constants.h"
+#include "modules/video_coding/include/video_codec_interface.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "modules/video_coding/svc/scalability_mode_util.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "src/rtc_video_frame_impl.h"
+
+namespace libwebrtc {
+
+namespace {
+
+int32_t ToWebRtcStatus(RTCVideoCodecStatus status) {
+  switch (status) {
+    case RTCVideoCodecStatus::kOk:
+      return WEBRTC_VIDEO_CODEC_OK;
+    case RTCVideoCodecStatus::kFallbackToBuiltin:
+      return WEBRTC_VIDEO_CODEC_FALLBACK_SOFTWARE;
+    default:
+      return WEBRTC_VIDEO_CODEC_ERROR;
+  }
+}
+
+/**
+ * class PluginVideoEncoder
+ *
+ * Runs an RTCVideoEncoderPlugin as a webrtc::VideoEncoder. The plugin only
+ * produces the bitstream; the codec specific info the RTP packetizer needs
+ * is filled in here, for a single spatial and temporal layer.
+ */
+class PluginVideoEncoder : public webrtc::VideoEncoder,
+                           public RTCVideoEncoderCallback {
+ public:
+  PluginVideoEncoder(scoped_refptr<RTCVideoEncoderPlugin> plugin,
+                     const webrtc::SdpVideoFormat& format)
+      : plugin_(plugin),
+        codec_type_(webrtc::PayloadStringToCodecType(format.name)),
+        implementation_name_(plugin->ImplementationName().std_string()),
+        hardware_accelerated_(plugin->IsHardwareAccelerated()) {
+    auto it = format.parameters.find(cricket::kH264FmtpPacketizationMode);
+    if (it != format.parameters.end() && it->second == "1") {
+      packetization_mode_ = webrtc::H264PacketizationMode::NonInterleaved;
+    }
+  }
+
+  ~PluginVideoEncoder() override { Release(); }
+
+  int32_t InitEncode(const webrtc::VideoCodec* codec_settings,
+                     const Settings& settings) override {
+    if (!codec_settings) {
+      return WEBRTC_VIDEO_CODEC_ERR_PARAMETER;
+    }
+    Release();
+
+    // The plugin produces a single stream with a single layer. Simulcast and
+    // SVC go to the builtin encoder when there is one.
+    if (codec_settings->numberOfSimulcastStreams > 1) {
+      return WEBRTC_VIDEO_CODEC_ERR_SIMULCAST_PARAMETERS_NOT_SUPPORTED;
+    }
+    if (!IsSingleLayer(*codec_settings)) {
+      return WEBRTC_VIDEO_CODEC_FALLBACK_SOFTWARE;
+    }
+
+    RTCVideoEncoderSettings plugin_settings;
+    plugin_settings.width = codec_settings->width;
+    plugin_settings.height = codec_settings->height;
+    plugin_settings.max_framerate = codec_settings->maxFramerate;
+    plugin_settings.start_bitrate_kbps = codec_settings->startBitrate;
+    plugin_settings.min_bitrate_kbps = codec_settings->minBitrate;
+    plugin_settings.max_bitrate_kbps = codec_settings->maxBitrate;
+    plugin_settings.number_of_cores = settings.number_of_cores;
+    bool screenshare =
+        codec_settings->mode == webrtc::VideoCodecMode::kScreensharing;
+    plugin_settings.mode = screenshare ? RTCVideoCodecMode::kScreensharing
+                                       : RTCVideoCodecMode::kRealtimeVideo;
+    {
+      webrtc::MutexLock lock(&mutex_);
+      screenshare_ = screenshare;
+      rotations_.clear();
+    }
+
+    plugin_->RegisterCallback(this);
+    RTCVideoCodecStatus status = plugin_->InitEncode(plugin_settings);
+    if (status != RTCVideoCodecStatus::kOk) {
+      plugin_->RegisterCallback(nullptr);
+      return ToWebRtcStatus(status);
+    }
+    initialized_ = true;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t RegisterEncodeCompleteCallback(
+      webrtc::EncodedImageCallback* callback) override {
+    webrtc::MutexLock lock(&mutex_);
+    callback_ = callback;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t Release() override {
+    if (initialized_) {
+      plugin_->Shutdown();
+      plugin_->RegisterCallback(nullptr);
+      initialized_ = false;
+    }
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t Encode(
+      const webrtc::VideoFrame& frame,
+      const std::vector<webrtc::VideoFrameType>* frame_types) override {
+    if (!initialized_) {
+      return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+    }
+
+    bool key_frame = false;
+    if (frame_types) {
+      for (webrtc::VideoFrameType type : *frame_types) {
+        key_frame |= type == webrtc::VideoFrameType::kVideoFrameKey;
+      }
+    }
+
+    rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer =
+        frame.video_frame_buffer();
+    if (buffer->type() != webrtc::VideoFrameBuffer::Type::kI420) {
+      buffer = buffer->ToI420();
+      if (!buffer) {
+        return WEBRTC_VIDEO_CODEC_ERROR;
+      }
+    }
+    scoped_refptr<VideoFrameBufferImpl> input =
+        scoped_refptr<VideoFrameBufferImpl>(new VideoFrameBufferImpl(buffer));
+    input->set_rotation(frame.rotation());
+    input->set_timestamp_us(frame.timestamp_us());
+
+    {
+      webrtc::MutexLock lock(&mutex_);
+      // Frames the plugin drops never come back; bound the queue.
+      if (rotations_.size() >= kMaxPendingFrames) {
+        rotations_.pop_front();
+      }
+      rotations_.emplace_back(frame.rtp_timestamp(), frame.rotation());
+    }
+    return ToWebRtcStatus(
+        plugin_->Encode(input, frame.rtp_timestamp(), key_frame));
+  }
+
+  void SetRates(const RateControlParameters& parameters) override {
+    if (initialized_) {
+      plugin_->SetRates(parameters.bitrate.get_sum_bps(),
+                        parameters.framerate_fps);
+    }
+  }
+
+  EncoderInfo GetEncoderInfo() const override {
+    EncoderInfo info;
+    info.implementation_name = implementation_name_;
+    info.is_hardware_accelerated = hardware_accelerated_;
+    info.supports_native_handle = false;
+    return info;
+  }
+
+  // RTCVideoEncoderCallback
+  void OnEncodedImage(const RTCEncodedVideoImage& image) override {
+    if (!image.data || image.size == 0) {
+      return;
+    }
+
+    webrtc::EncodedImage encoded;
+    encoded.SetEncodedData(
+        webrtc::EncodedImageBuffer::Create(image.data, image.size));
+    encoded._encodedWidth = image.width;
+    encoded._encodedHeight = image.height;
+    encoded.SetRtpTimestamp(image.rtp_timestamp);
+    encoded.capture_time_ms_ = image.capture_time_ms;
+    encoded._frameType = image.key_frame
+                             ? webrtc::VideoFrameType::kVideoFrameKey
+                             : webrtc::VideoFrameType::kVideoFrameDelta;
+    encoded.qp_ = image.qp;
+
+    webrtc::CodecSpecificInfo info;
+    info.codecType = codec_type_;
+    switch (codec_type_) {
+      case webrtc::kVideoCodecVP8:
+        info.codecSpecific.VP8.nonReference = false;
+        info.codecSpecific.VP8.temporalIdx = webrtc::kNoTemporalIdx;
+        info.codecSpecific.VP8.layerSync = false;
+        info.codecSpecific.VP8.keyIdx = webrtc::kNoKeyIdx;
+        break;
+      case webrtc::kVideoCodecVP9:
+        // Non-flexible mode with one layer; the scalability structure is
+        // repeated with every key frame.
+        info.codecSpecific.VP9.first_frame_in_picture = true;
+        info.codecSpecific.VP9.inter_pic_predicted = !image.key_frame;
+        info.codecSpecific.VP9.flexible_mode = false;
+        info.codecSpecific.VP9.ss_data_available = image.key_frame;
+        info.codecSpecific.VP9.temporal_idx = webrtc::kNoTemporalIdx;
+        info.codecSpecific.VP9.temporal_up_switch = true;
+        info.codecSpecific.VP9.inter_layer_predicted = false;
+        info.codecSpecific.VP9.non_ref_for_inter_layer_pred = true;
+        info.codecSpecific.VP9.gof_idx = 0;
+        info.codecSpecific.VP9.num_spatial_layers = 1;
+        info.codecSpecific.VP9.first_active_layer = 0;
+        if (image.key_frame) {
+          info.codecSpecific.VP9.spatial_layer_resolution_present = true;
+          info.codecSpecific.VP9.width[0] = image.width;
+          info.codecSpecific.VP9.height[0] = image.height;
+          info.codecSpecific.VP9.gof.SetGofInfoVP9(
+              webrtc::kTemporalStructureMode1);
+        }
+        break;
+      case webrtc::kVideoCodecH264:
+        info.codecSpecific.H264.packetization_mode = packetization_mode_;
+        info.codecSpecific.H264.temporal_idx = webrtc::kNoTemporalIdx;
+        info.codecSpecific.H264.base_layer_sync = false;
+        info.codecSpecific.H264.idr_frame = image.key_frame;
+        break;
+      default:
+        break;
+    }
+
+    webrtc::MutexLock lock(&mutex_);
+    encoded.content_type_ = screenshare_
+                                ? webrtc::VideoContentType::SCREENSHARE
+                                : webrtc::VideoContentType::UNSPECIFIED;
+    encoded.rotation_ = TakeRotationLocked(image.rtp_timestamp);
+    if (callback_) {
+      callback_->OnEncodedImage(encoded, &info);
+    }
+  }
+
+ private:
+  // Input frames whose output is still outstanding.
+  static constexpr size_t kMaxPendingFrames = 30;
+
+  static bool IsSingleLayer(const webrtc::VideoCodec& codec) {
+    absl::optional<webrtc::ScalabilityMode> mode = codec.GetScalabilityMode();
+    if (mode && (webrtc::ScalabilityModeToNumSpatialLayers(*mode) > 1 ||
+                 webrtc::ScalabilityModeToNumTemporalLayers(*mode) > 1)) {
+      return false;
+    }
+    switch (codec.codecType) {
+      case webrtc::kVideoCodecVP8:
+        return codec.VP8().numberOfTemporalLayers <= 1;
+      case webrtc::kVideoCodecVP9:
+        return codec.VP9().numberOfSpatialLayers <= 1 &&
+               codec.VP9().numberOfTemporalLayers <= 1;
+      case webrtc::kVideoCodecH264:
+        return codec.H264().numberOfTemporalLayers <= 1;
+      default:
+        return true;
+    }
+  }
+
+  // Returns the rotation of the input frame with |rtp_timestamp| and forgets
+  // it together with the frames queued before it, which were dropped.
+  webrtc::VideoRotation TakeRotationLocked(uint32_t rtp_timestamp) {
+    for (auto it = rotations_.begin(); it != rotations_.end(); ++it) {
+      if (it->first == rtp_timestamp) {
+        webrtc::VideoRotation rotation = it->second;
+        rotations_.erase(rotations_.begin(), it + 1);
+        return rotation;
+      }
+    }
+    return webrtc::kVideoRotation_0;
+  }
+
+  scoped_refptr<RTCVideoEncoderPlugin> plugin_;
+  webrtc::VideoCodecType codec_type_;
+  webrtc::H264PacketizationMode packetization_mode_ =
+      webrtc::H264PacketizationMode::SingleNalUnit;
+  std::string implementation_name_;
+  bool hardware_accelerated_;
+  bool initialized_ = false;
+
+  // Guards the members below.
+  webrtc::Mutex mutex_;
+  webrtc::EncodedImageCallback* callback_ = nullptr;
+  bool screenshare_ = false;
+  std::deque<std::pair<uint32_t, webrtc::VideoRotation>> rotations_;
+};
+
+/**
+ * class PluginVideoDecoder
+ *
+ * Runs an RTCVideoDecoderPlugin as a webrtc::VideoDecoder. Decoded frames
+ * are handed on without a copy: the WebRTC frame buffer holds a reference
+ * to the plugin's frame.
+ */
+class PluginVideoDecoder : public webrtc::VideoDecoder,
+                           public RTCVideoDecoderCallback {
+ public:
+  explicit PluginVideoDecoder(scoped_refptr<RTCVideoDecoderPlugin> plugin)
+      : plugin_(plugin),
+        implementation_name_(plugin->ImplementationName().std_string()),
+        hardware_accelerated_(plugin->IsHardwareAccelerated()) {}
+
+  ~PluginVideoDecoder() override { Release(); }
+
+  bool Configure(const Settings& settings) override {
+    Release();
+
+    RTCVideoDecoderSettings plugin_settings;
+    plugin_settings.max_width = settings.max_render_resolution().Width();
+    plugin_settings.max_height = settings.max_render_resolution().Height();
+    plugin_settings.number_of_cores = settings.number_of_cores();
+
+    plugin_->RegisterCallback(this);
+    if (plugin_->InitDecode(plugin_settings) != RTCVideoCodecStatus::kOk) {
+      plugin_->RegisterCallback(nullptr);
+      return false;
+    }
+    initialized_ = true;
+    return true;
+  }
+
+  int32_t Decode(const webrtc::EncodedImage& input_image,
+                 int64_t render_time_ms) override {
+    if (!initialized_) {
+      return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+    }
+
+    RTCEncodedVideoImage image;
+    image.data = input_image.data();
+    image.size = input_image.size();
+    image.width = input_image._encodedWidth;
+    image.height = input_image._encodedHeight;
+    image.rtp_timestamp = input_image.RtpTimestamp();
+    image.capture_time_ms = input_image.capture_time_ms_;
+    image.key_frame =
+        input_image._frameType == webrtc::VideoFrameType::kVideoFrameKey;
+    image.qp = input_image.qp_;
+    return ToWebRtcStatus(plugin_->Decode(image));
+  }
+
+  int32_t RegisterDecodeCompleteCallback(
+      webrtc::DecodedImageCallback* callback) override {
+    webrtc::MutexLock lock(&mutex_);
+    callback_ = callback;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t Release() override {
+    if (initialized_) {
+      plugin_->Shutdown();
+      plugin_->RegisterCallback(nullptr);
+      initialized_ = false;
+    }
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  DecoderInfo GetDecoderInfo() const override {
+    DecoderInfo info;
+    info.implementation_name = implementation_name_;
+    info.is_hardware_accelerated = hardware_accelerated_;
+    return info;
+  }
+
+  const char* ImplementationName() const override {
+    return implementation_name_.c_str();
+  }
+
+  // RTCVideoDecoderCallback
+  void OnDecodedFrame(scoped_refptr<RTCVideoFrame> frame,
+                      uint32_t rtp_timestamp) override {
+    if (!frame) {
+      return;
+    }
+
+    rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer =
+        webrtc::WrapI420Buffer(frame->width(), frame->height(),
+                               frame->DataY(), frame->StrideY(),
+                               frame->DataU(), frame->StrideU(),
+                               frame->DataV(), frame->StrideV(),
+                               [frame]() {});
+    webrtc::VideoFrame decoded = webrtc::VideoFrame::Builder()
+                                     .set_video_frame_buffer(buffer)
+                                     .set_timestamp_rtp(rtp_timestamp)
+                                     .set_rotation(webrtc::kVideoRotation_0)
+                                     .build();
+
+    webrtc::MutexLock lock(&mutex_);
+    if (callback_) {
+      callback_->Decoded(decoded);
+    }
+  }
+
+ private:
+  scoped_refptr<RTCVideoDecoderPlugin> plugin_;
+  std::string implementation_name_;
+  bool hardware_accelerated_;
+  bool initialized_ = false;
+
+  // Guards the member below.
+  webrtc::Mutex mutex_;
+  webrtc::DecodedImageCallback* callback_ = nullptr;
+};
+
+std::vector<webrtc::SdpVideoFormat> ToSdpVideoFormats(
+    const vector<RTCVideoCodecFormat>& formats) {
+  std::vector<webrtc::SdpVideoFormat> result;
+  for (size_t i = 0; i < formats.size(); i++) {
+    result.push_back(ToSdpVideoFormat(formats[i]));
+  }
+  return result;
+}
+
+// Plugin formats first, then the builtin formats of other codecs.
+std::vector<webrtc::SdpVideoFormat> MergeFormats(
+    const std::vector<webrtc::SdpVideoFormat>& plugin_formats,
+    const std::vector<webrtc::SdpVideoFormat>& builtin_formats) {
+  std::vector<webrtc::SdpVideoFormat> formats = plugin_formats;
+  for (const webrtc::SdpVideoFormat& format : builtin_formats) {
+    if (!format.IsCodecInList(plugin_formats)) {
+      formats.push_back(format);
+    }
+  }
+  return formats;
+}
+
+}  // namespace
+
+webrtc::SdpVideoFormat ToSdpVideoFormat(const RTCVideoCodecFormat& format) {
+  std::map<std::string, std::string> parameters;
+  const std::string line = format.parameters.std_string();
+  size_t begin = 0;
+  while (begin < line.size()) {
+    size_t end = line.find(';', begin);
+    if (end == std::string::npos) {
+      end = line.size();
+    }
+    std::string parameter = line.substr(begin, end - begin);
+    size_t first = parameter.find_first_not_of(' ');
+    size_t equals = parameter.find('=');
+    if (first != std::string::npos && equals != std::string::npos &&
+        equals > first) {
+      parameters[parameter.substr(first, equals - first)] =
+          parameter.substr(equals + 1);
+    }
+    begin = end + 1;
+  }
+  return webrtc::SdpVideoFormat(format.name.std_string(), parameters);
+}
+
+RTCVideoCodecFormat ToVideoCodecFormat(const webrtc::SdpVideoFormat& format) {
+  std::string parameters;
+  for (const auto& parameter : format.parameters) {
+    if (!parameters.empty()) {
+      parameters += ";";
+    }
+    parameters += parameter.first + "=" + parameter.second;
+  }
+  RTCVideoCodecFormat result;
+  result.name = string(format.name);
+  result.parameters = string(parameters);
+  return result;
+}
+
+/**
+ * class PluginVideoEncoderFactory
+ */
+
+PluginVideoEncoderFactory::PluginVideoEncoderFactory(
+    scoped_refptr<RTCVideoEncoderPluginFactory> plugins,
+    std::unique_ptr<webrtc::VideoEncoderFactory> builtin)
+    : plugins_(plugins),
+      builtin_(std::move(builtin)),
+      plugin_formats_(ToSdpVideoFormats(plugins->GetSupportedFormats())) {}
+
+std::vector<webrtc::SdpVideoFormat>
+PluginVideoEncoderFactory::GetSupportedFormats() const {
+  return MergeFormats(plugin_formats_, builtin_->GetSupportedFormats());
+}
+
+std::unique_ptr<webrtc::VideoEncoder>
+PluginVideoEncoderFactory::CreateVideoEncoder(
+    const webrtc::SdpVideoFormat& format) {
+  std::unique_ptr<webrtc::VideoEncoder> builtin;
+  if (format.IsCodecInList(builtin_->GetSupportedFormats())) {
+    builtin = builtin_->CreateVideoEncoder(format);
+  }
+  if (!format.IsCodecInList(plugin_formats_)) {
+    return builtin;
+  }
+
+  scoped_refptr<RTCVideoEncoderPlugin> plugin =
+      plugins_->Create(ToVideoCodecFormat(format));
+  if (!plugin) {
+    return builtin;
+  }
+  std::unique_ptr<webrtc::VideoEncoder> encoder =
+      std::make_unique<PluginVideoEncoder>(plugin, format);
+  if (!builtin) {
+    return encoder;
+  }
+  return webrtc::CreateVideoEncoderSoftwareFallbackWrapper(std::move(builtin),
+                                                           std::move(encoder));
+}
+
+/**
+ * class PluginVideoDecoderFactory
+ */
+
+PluginVideoDecoderFactory::PluginVideoDecoderFactory(
+    scoped_refptr<RTCVideoDecoderPluginFactory> plugins,
+    std::unique_ptr<webrtc::VideoDecoderFactory> builtin)
+    : plugins_(plugins),
+      builtin_(std::move(builtin)),
+      plugin_formats_(ToSdpVideoFormats(plugins->GetSupportedFormats())) {}
+
+std::vector<webrtc::SdpVideoFormat>
+PluginVideoDecoderFactory::GetSupportedFormats() const {
+  return MergeFormats(plugin_formats_, builtin_->GetSupportedFormats());
+}
+
+std::unique_ptr<webrtc::VideoDecoder>
+PluginVideoDecoderFactory::CreateVideoDecoder(
+    const webrtc::SdpVideoFormat& format) {
+  std::unique_ptr<webrtc::VideoDecoder> builtin;
+  if (format.IsCodecInList(builtin_->GetSupportedFormats())) {
+    builtin = builtin_->CreateVideoDecoder(format);
+  }
+  if (!format.IsCodecInList(plugin_formats_)) {
+    return builtin;
+  }
+
+  scoped_refptr<RTCVideoDecoderPlugin> plugin =
+      plugins_->Create(ToVideoCodecFormat(format));
+  if (!plugin) {
+    return builtin;
+  }
+  std::unique_ptr<webrtc::VideoDecoder> decoder =
+      std::make_unique<PluginVideoDecoder>(plugin);
+  if (!builtin) {
+    return decoder;
+  }
+  return webrtc::CreateVideoDecoderSoftwareFallbackWrapper(std::move(builtin),
+                                                           std::move(decoder));
+}
+
+}  // namespace libwebrtc
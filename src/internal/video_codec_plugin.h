@@ -0,0 +1,67 @@
+#ifndef LIB_WEBRTC_VIDEO_CODEC_PLUGIN_HXX
+#define LIB_WEBRTC_VIDEO_CODEC_PLUGIN_HXX
+
+#include <memory>
+#include <vector>
+
+#include "api/video_codecs/sdp_video_format.h"
+#include "api/video_codecs/video_decoder_factory.h"
+#include "api/video_codecs/video_encoder_factory.h"
+#include "rtc_video_codec.h"
+
+namespace libwebrtc {
+
+/**
+ * class PluginVideoEncoderFactory
+ *
+ * Offers the formats of an RTCVideoEncoderPluginFactory ahead of those of
+ * |builtin|. Plugin encoders of a format |builtin| supports as well are
+ * wrapped so that the builtin encoder takes over when they fail.
+ */
+class PluginVideoEncoderFactory : public webrtc::VideoEncoderFactory {
+ public:
+  PluginVideoEncoderFactory(
+      scoped_refptr<RTCVideoEncoderPluginFactory> plugins,
+      std::unique_ptr<webrtc::VideoEncoderFactory> builtin);
+
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+
+  std::unique_ptr<webrtc::VideoEncoder> CreateVideoEncoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  scoped_refptr<RTCVideoEncoderPluginFactory> plugins_;
+  std::unique_ptr<webrtc::VideoEncoderFactory> builtin_;
+  // Queried once: GetSupportedFormats() is called on several threads.
+  std::vector<webrtc::SdpVideoFormat> plugin_formats_;
+};
+
+/**
+ * class PluginVideoDecoderFactory
+ *
+ * Same as PluginVideoEncoderFactory, for the receiving side.
+ */
+class PluginVideoDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  PluginVideoDecoderFactory(
+      scoped_refptr<RTCVideoDecoderPluginFactory> plugins,
+      std::unique_ptr<webrtc::VideoDecoderFactory> builtin);
+
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+
+  std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  scoped_refptr<RTCVideoDecoderPluginFactory> plugins_;
+  std::unique_ptr<webrtc::VideoDecoderFactory> builtin_;
+  std::vector<webrtc::SdpVideoFormat> plugin_formats_;
+};
+
+// Conversions between the SDP formats of the library and of WebRTC.
+webrtc::SdpVideoFormat ToSdpVideoFormat(const RTCVideoCodecFormat& format);
+RTCVideoCodecFormat ToVideoCodecFormat(const webrtc::SdpVideoFormat& format);
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_VIDEO_CODEC_PLUGIN_HXX
@@ -31,6 +31,14 @@ void LIB_WEBRTC_CALL LibWebRTC_Terminate() noexcept
     LibWebRTC::Terminate();
 }
 
+void LIB_WEBRTC_CALL LibWebRTC_SetParallelConversion(
+    int threads,
+    int min_pixels
+) noexcept
+{
+    LibWebRTC::SetParallelConversion(threads, min_pixels);
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 LibWebRTC_GetErrorMessage(
     rtcResultU4 code,
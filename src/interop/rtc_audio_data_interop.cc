@@ -59,7 +59,7 @@ RTCAudioData_GetData(
   CHECK_POINTER(ppRetVal);
   CHECK_NATIVE_HANDLE(handle);
 
-  scoped_refptr<RTCAudioData> p = static_cast<RTCAudioData*>(handle);
+  RTCAudioData* p = static_cast<RTCAudioData*>(handle);
   *ppRetVal = static_cast<const unsigned char*>(p->data());
   return rtcResultU4::kSuccess;
 }
@@ -119,8 +119,8 @@ RTCAudioData_ScaleFrom(
   CHECK_NATIVE_HANDLE(handle);
   CHECK_POINTER_EX(source_data, rtcResultU4::kInvalidParameter);
 
-  scoped_refptr<RTCAudioData> p = static_cast<RTCAudioData*>(handle);
-  scoped_refptr<RTCAudioData> pSourceData = static_cast<RTCAudioData*>(source_data);
+  RTCAudioData* p = static_cast<RTCAudioData*>(handle);
+  RTCAudioData* pSourceData = static_cast<RTCAudioData*>(source_data);
   int retVal = p->ScaleFrom(pSourceData);
   if (pRetVal) { *pRetVal = retVal; }
   return rtcResultU4::kSuccess;
@@ -135,7 +135,7 @@ RTCAudioData_Clear(
 {
   CHECK_NATIVE_HANDLE(handle);
 
-  scoped_refptr<RTCAudioData> p = static_cast<RTCAudioData*>(handle);
+  RTCAudioData* p = static_cast<RTCAudioData*>(handle);
   int retVal = p->Clear(static_cast<RTCAudioDataToneFrequency>(frequency));
   if (pRetVal) { *pRetVal = retVal; }
   return rtcResultU4::kSuccess;
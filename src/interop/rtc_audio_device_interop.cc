@@ -21,7 +21,7 @@ RTCAudioDevice_PlayoutDevices(
 ) noexcept
 {
     CHECK_POINTER_EX(audiDevice, 0);    
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<int>(pAudioDevice->PlayoutDevices());
 } // end RTCAudioDevice_PlayoutDevices
 
@@ -31,7 +31,7 @@ RTCAudioDevice_RecordingDevices(
 ) noexcept
 {
     CHECK_POINTER_EX(audiDevice, 0);
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<int>(pAudioDevice->RecordingDevices());
 } // end RTCAudioDevice_RecordingDevices
 
@@ -56,7 +56,7 @@ RTCAudioDevice_PlayoutDeviceName(
 
     char szName[RTCAudioDevice::kAdmMaxDeviceNameSize] = {0};
     char szGuid[RTCAudioDevice::kAdmMaxGuidSize] = {0};
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
 
     rtcResultU4 result = (rtcResultU4)pAudioDevice->PlayoutDeviceName((uint16_t)index, szName, szGuid);
     if (result != rtcResultU4::kSuccess) {
@@ -101,7 +101,7 @@ RTCAudioDevice_RecordingDeviceName(
 
     char szName[RTCAudioDevice::kAdmMaxDeviceNameSize] = {0};
     char szGuid[RTCAudioDevice::kAdmMaxGuidSize] = {0};
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
 
     rtcResultU4 result = (rtcResultU4)pAudioDevice->RecordingDeviceName((uint16_t)index, szName, szGuid);
     if (result != rtcResultU4::kSuccess) {
@@ -136,7 +136,7 @@ RTCAudioDevice_SetPlayoutDevice(
         return rtcResultU4::kOutOfRange;
     }
 
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     int nCount = (int)pAudioDevice->PlayoutDevices();
     if (index >= nCount) {
         return rtcResultU4::kOutOfRange;
@@ -155,7 +155,7 @@ RTCAudioDevice_SetRecordingDevice(
         return rtcResultU4::kOutOfRange;
     }
 
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     int nCount = (int)pAudioDevice->RecordingDevices();
     if (index >= nCount) {
         return rtcResultU4::kOutOfRange;
@@ -172,7 +172,7 @@ RTCAudioDevice_RegisterDeviceChangeCallback(
 {
     CHECK_NATIVE_HANDLE(audiDevice);
 
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     RTCAudioDevice::OnDeviceChangeCallback cb;
     if (callback == nullptr) {
         cb = nullptr;
@@ -207,7 +207,7 @@ RTCAudioDevice_SetMicrophoneVolume(
 ) noexcept
 {
     CHECK_NATIVE_HANDLE(audiDevice);
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<rtcResultU4>(pAudioDevice->SetMicrophoneVolume(volume));
 } // end RTCAudioDevice_SetMicrophoneVolume
 
@@ -218,7 +218,7 @@ RTCAudioDevice_GetMicrophoneVolume(
 ) noexcept
 {
     CHECK_NATIVE_HANDLE(audiDevice);
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<rtcResultU4>(pAudioDevice->MicrophoneVolume(*volume));
 } // end RTCAudioDevice_GetMicrophoneVolume
 
@@ -229,7 +229,7 @@ RTCAudioDevice_SetSpeakerVolume(
 ) noexcept
 {
     CHECK_NATIVE_HANDLE(audiDevice);
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<rtcResultU4>(pAudioDevice->SetSpeakerVolume(volume));
 } // end RTCAudioDevice_SetSpeakerVolume
 
@@ -240,6 +240,6 @@ RTCAudioDevice_GetSpeakerVolume(
 ) noexcept
 {
     CHECK_NATIVE_HANDLE(audiDevice);
-    scoped_refptr<RTCAudioDevice> pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
+    RTCAudioDevice* pAudioDevice = static_cast<RTCAudioDevice*>(audiDevice);
     return static_cast<rtcResultU4>(pAudioDevice->SpeakerVolume(*volume));
 } // end RTCAudioDevice_GetSpeakerVolume
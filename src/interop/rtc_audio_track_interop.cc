@@ -19,7 +19,7 @@ RTCAudioTrack_SetVolume(
 
     if (volume < 0) volume = 0;
     if (volume > 10) volume = 10;
-    scoped_refptr<RTCAudioTrack> pAudioTrack = static_cast<RTCAudioTrack*>(audioTrack);
+    RTCAudioTrack* pAudioTrack = static_cast<RTCAudioTrack*>(audioTrack);
     pAudioTrack->SetVolume(volume);
     return rtcResultU4::kSuccess;
 }
@@ -20,7 +20,7 @@ RTCDataChannel_Send(
 {
     CHECK_NATIVE_HANDLE(dataChannel);
 
-    scoped_refptr<RTCDataChannel> pDataChannel = static_cast<RTCDataChannel*>(dataChannel);
+    RTCDataChannel* pDataChannel = static_cast<RTCDataChannel*>(dataChannel);
     pDataChannel->Send(
         static_cast<const uint8_t*>(data),
         data_size,
@@ -58,7 +58,7 @@ RTCDataChannel_RegisterObserver(
     RTCDataChannel_UnregisterObserver(dataChannel);
 
     RTCDataChannelObserver* pObserver = static_cast<RTCDataChannelObserver*>(new RTCDataChannelObserverImpl(callbacks));
-    scoped_refptr<RTCDataChannel> pDataChannel = static_cast<RTCDataChannel*>(dataChannel);
+    RTCDataChannel* pDataChannel = static_cast<RTCDataChannel*>(dataChannel);
     pDataChannel->RegisterObserver(pObserver);
     return rtcResultU4::kSuccess;
 }
@@ -89,6 +89,16 @@ RTCDataChannel_GetLabel(
     DECLARE_GET_STRING(dataChannel, label, label_size, RTCDataChannel, label);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCDataChannel_GetLabelView(
+    rtcDataChannelHandle dataChannel,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(dataChannel, pOutData, pOutLength, RTCDataChannel, label_view);
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCDataChannel_GetId(
     rtcDataChannelHandle dataChannel,
@@ -25,7 +25,7 @@ RTCDesktopCapturer_RegisterObserver(
     RTCDesktopCapturer_UnregisterObserver(handle);
     
     DesktopCapturerObserver* pObserver = static_cast<DesktopCapturerObserver*>(new DesktopCapturerObserverImpl(callbacks));
-    scoped_refptr<RTCDesktopCapturer> p = static_cast<RTCDesktopCapturer*>(handle);
+    RTCDesktopCapturer* p = static_cast<RTCDesktopCapturer*>(handle);
     p->RegisterDesktopCapturerObserver(pObserver);
     return rtcResultU4::kSuccess;
 }
@@ -57,7 +57,7 @@ RTCDesktopCapturer_Start1(
     CHECK_POINTER(pOutRetVal);
     *pOutRetVal = rtcCaptureState::CS_FAILED;
 
-    scoped_refptr<RTCDesktopCapturer> p = static_cast<RTCDesktopCapturer*>(handle);
+    RTCDesktopCapturer* p = static_cast<RTCDesktopCapturer*>(handle);
     *pOutRetVal = static_cast<rtcCaptureState>(p->Start(static_cast<uint32_t>(fps)));
     return rtcResultU4::kSuccess;
 }
@@ -77,7 +77,7 @@ RTCDesktopCapturer_Start2(
     CHECK_POINTER(pOutRetVal);
     *pOutRetVal = rtcCaptureState::CS_FAILED;
 
-    scoped_refptr<RTCDesktopCapturer> p = static_cast<RTCDesktopCapturer*>(handle);
+    RTCDesktopCapturer* p = static_cast<RTCDesktopCapturer*>(handle);
     *pOutRetVal = static_cast<rtcCaptureState>(p->Start(
         static_cast<uint32_t>(fps),
         static_cast<uint32_t>(x),
@@ -24,8 +24,8 @@ RTCDesktopDevice_CreateDesktopCapturer(
     CHECK_NATIVE_HANDLE(desktopDevice);
     CHECK_POINTER_EX(source, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCDesktopDevice> pDesktopDevice = static_cast<RTCDesktopDevice*>(desktopDevice);
-    scoped_refptr<MediaSource> pSource = static_cast<MediaSource*>(source);
+    RTCDesktopDevice* pDesktopDevice = static_cast<RTCDesktopDevice*>(desktopDevice);
+    MediaSource* pSource = static_cast<MediaSource*>(source);
     scoped_refptr<RTCDesktopCapturer> pDesktopCapturer = pDesktopDevice->CreateDesktopCapturer(pSource);
     if (pDesktopCapturer == nullptr) {
         return rtcResultU4::kUnknownError;
@@ -44,7 +44,7 @@ RTCDesktopDevice_GetDesktopMediaList(
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(desktopDevice);
 
-    scoped_refptr<RTCDesktopDevice> pDesktopDevice = static_cast<RTCDesktopDevice*>(desktopDevice);
+    RTCDesktopDevice* pDesktopDevice = static_cast<RTCDesktopDevice*>(desktopDevice);
     scoped_refptr<RTCDesktopMediaList> pMediaList = pDesktopDevice->GetDesktopMediaList(type);
     if (pMediaList == nullptr) {
         return rtcResultU4::kUnknownError;
@@ -12,6 +12,16 @@ using namespace libwebrtc;
 
 #ifdef RTC_DESKTOP_DEVICE
 
+static ThumbnailOptions ToThumbnailOptions(const rtcThumbnailOptions* options)
+{
+    ThumbnailOptions result;
+    result.max_width = options->max_width;
+    result.max_height = options->max_height;
+    result.format = options->format;
+    result.jpeg_quality = options->jpeg_quality;
+    return result;
+}
+
 /*
  * ---------------------------------------------------------------------- 
  * RTCDesktopMediaList interop methods
@@ -31,7 +41,7 @@ RTCDesktopMediaList_RegisterMediaListObserver(
     RTCDesktopMediaList_DeRegisterMediaListObserver(hMediaList);
     
     MediaListObserver* pObserver = static_cast<MediaListObserver*>(new MediaListObserverImpl(callbacks));
-    scoped_refptr<RTCDesktopMediaList> pMediaList = static_cast<RTCDesktopMediaList*>(hMediaList);
+    RTCDesktopMediaList* pMediaList = static_cast<RTCDesktopMediaList*>(hMediaList);
     pMediaList->RegisterMediaListObserver(pObserver);
     return rtcResultU4::kSuccess;
 }
@@ -60,7 +70,7 @@ RTCDesktopMediaList_GetType(
 {
     CHECK_POINTER_EX(hMediaList, static_cast<rtcDesktopType>(-1));
 
-    scoped_refptr<RTCDesktopMediaListImpl> pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
     rtcDesktopType desktopType = static_cast<rtcDesktopType>(pMediaList->type());
     return desktopType;
 }
@@ -74,7 +84,7 @@ RTCDesktopMediaList_UpdateSourceList(
 {
     CHECK_POINTER_EX(hMediaList, -1);
     
-    scoped_refptr<RTCDesktopMediaListImpl> pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
     int result = (int)pMediaList->UpdateSourceList(
         force_reload != rtcBool32::kFalse,
         get_thumbnail != rtcBool32::kFalse
@@ -82,6 +92,23 @@ RTCDesktopMediaList_UpdateSourceList(
     return result;
 }
 
+int LIB_WEBRTC_CALL
+RTCDesktopMediaList_UpdateSourceListWithOptions(
+    rtcDesktopMediaListHandle hMediaList,
+    rtcBool32 force_reload,
+    const rtcThumbnailOptions* options
+) noexcept
+{
+    CHECK_POINTER_EX(hMediaList, -1);
+    CHECK_POINTER_EX(options, -1);
+
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    return (int)pMediaList->UpdateSourceListWithOptions(
+        force_reload != rtcBool32::kFalse,
+        ToThumbnailOptions(options)
+    );
+}
+
 int LIB_WEBRTC_CALL
 RTCDesktopMediaList_GetSourceCount(
     rtcDesktopMediaListHandle hMediaList
@@ -89,7 +116,7 @@ RTCDesktopMediaList_GetSourceCount(
 {
     CHECK_POINTER_EX(hMediaList, -1);
 
-    scoped_refptr<RTCDesktopMediaListImpl> pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
     return pMediaList->GetSourceCount();
 }
 
@@ -102,7 +129,7 @@ RTCDesktopMediaList_GetSource(
 {
     CHECK_NATIVE_HANDLE(hMediaList);
 
-    scoped_refptr<RTCDesktopMediaListImpl> pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
     scoped_refptr<MediaSource> source = pMediaList->GetSource(index);
     *pOutRetVal = static_cast<rtcDesktopMediaSourceHandle>(source.release());
     return rtcResultU4::kSuccess;
@@ -118,13 +145,41 @@ RTCDesktopMediaList_GetThumbnail(
     CHECK_POINTER_EX(hMediaList, rtcBool32::kFalse);
     CHECK_POINTER_EX(hSource, rtcBool32::kFalse);
 
-    scoped_refptr<RTCDesktopMediaListImpl> pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
-    scoped_refptr<MediaSource> pSource = static_cast<MediaSource*>(hSource);
+    RTCDesktopMediaListImpl* pMediaList = static_cast<RTCDesktopMediaListImpl*>(hMediaList);
+    MediaSource* pSource = static_cast<MediaSource*>(hSource);
     return pMediaList->GetThumbnail(pSource, notify != rtcBool32::kFalse)
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCDesktopMediaList_StartThumbnailRefresh(
+    rtcDesktopMediaListHandle hMediaList,
+    int interval_ms,
+    const rtcThumbnailOptions* options
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(hMediaList);
+    CHECK_POINTER_EX(options, rtcResultU4::kInvalidParameter);
+
+    RTCDesktopMediaList* pMediaList = static_cast<RTCDesktopMediaList*>(hMediaList);
+    pMediaList->StartThumbnailRefresh(
+        interval_ms, ToThumbnailOptions(options));
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCDesktopMediaList_StopThumbnailRefresh(
+    rtcDesktopMediaListHandle hMediaList
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(hMediaList);
+
+    RTCDesktopMediaList* pMediaList = static_cast<RTCDesktopMediaList*>(hMediaList);
+    pMediaList->StopThumbnailRefresh();
+    return rtcResultU4::kSuccess;
+}
+
 /*
  * ---------------------------------------------------------------------- 
  * MediaSource interop methods
@@ -147,7 +202,7 @@ MediaSource_GetInfo(
     rtcResultU4 result = rtcResultU4::kSuccess;
     size_t cchLen;
     string szTmp;
-    scoped_refptr<MediaSource> pMediaSource = static_cast<MediaSource*>(mediaSource);
+    MediaSource* pMediaSource = static_cast<MediaSource*>(mediaSource);
 
     if (pOutId && cchOutId > 0) {
         szTmp = pMediaSource->id();
@@ -178,12 +233,53 @@ MediaSource_UpdateThumbnail(
 ) noexcept
 {
     CHECK_POINTER_EX(mediaSource, rtcBool32::kFalse);
-    scoped_refptr<MediaSource> pMediaSource = static_cast<MediaSource*>(mediaSource);
+    MediaSource* pMediaSource = static_cast<MediaSource*>(mediaSource);
     return pMediaSource->UpdateThumbnail()
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
 }
 
+rtcBool32 LIB_WEBRTC_CALL
+MediaSource_UpdateThumbnailWithOptions(
+    rtcDesktopMediaSourceHandle mediaSource,
+    const rtcThumbnailOptions* options
+) noexcept
+{
+    CHECK_POINTER_EX(mediaSource, rtcBool32::kFalse);
+    CHECK_POINTER_EX(options, rtcBool32::kFalse);
+    MediaSource* pMediaSource = static_cast<MediaSource*>(mediaSource);
+    return pMediaSource->UpdateThumbnailWithOptions(
+            ToThumbnailOptions(options))
+        ? rtcBool32::kTrue
+        : rtcBool32::kFalse;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+MediaSource_GetThumbnailInfo(
+    rtcDesktopMediaSourceHandle mediaSource,
+    int* pOutWidth,
+    int* pOutHeight,
+    rtcThumbnailFormat* pOutFormat
+) noexcept
+{
+    RESET_OUT_POINTER_EX(pOutWidth, 0);
+    RESET_OUT_POINTER_EX(pOutHeight, 0);
+    RESET_OUT_POINTER_EX(pOutFormat, rtcThumbnailFormat::kJpeg);
+    CHECK_NATIVE_HANDLE(mediaSource);
+
+    MediaSource* pMediaSource = static_cast<MediaSource*>(mediaSource);
+    if (pOutWidth) {
+        *pOutWidth = pMediaSource->thumbnail_width();
+    }
+    if (pOutHeight) {
+        *pOutHeight = pMediaSource->thumbnail_height();
+    }
+    if (pOutFormat) {
+        *pOutFormat = pMediaSource->thumbnail_format();
+    }
+    return rtcResultU4::kSuccess;
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 MediaSource_GetThumbnail(
     rtcDesktopMediaSourceHandle mediaSource,
@@ -196,7 +292,7 @@ MediaSource_GetThumbnail(
     size_t sizeOfBuffer = static_cast<size_t>(*refSizeOfBuffer);
     RESET_OUT_POINTER_EX(refSizeOfBuffer, 0);
 
-    scoped_refptr<MediaSource> pMediaSource = static_cast<MediaSource*>(mediaSource);
+    MediaSource* pMediaSource = static_cast<MediaSource*>(mediaSource);
     portable::vector<unsigned char> buffer = pMediaSource->thumbnail();
 
     size_t szSrcSize = buffer.size();
@@ -70,7 +70,7 @@ RTCDtlsTransport_RegisterObserver (
     // unregistered
     RTCDtlsTransport_UnregisterObserver(handle);
 
-    scoped_refptr<RTCDtlsTransport> p = static_cast<RTCDtlsTransport*>(handle);
+    RTCDtlsTransport* p = static_cast<RTCDtlsTransport*>(handle);
     RTCDtlsTransportObserver* pObserver = static_cast<RTCDtlsTransportObserver*>
     (
         new RTCDtlsTransportObserverImpl(static_cast<void*>(callbacks))
@@ -22,7 +22,7 @@ RTCDtmfSender_RegisterObserver (
     // unregistered
     RTCDtmfSender_UnregisterObserver(handle);
 
-    scoped_refptr<RTCDtmfSender> p = static_cast<RTCDtmfSender*>(handle);
+    RTCDtmfSender* p = static_cast<RTCDtmfSender*>(handle);
     RTCDtmfSenderObserver* pObserver = static_cast<RTCDtmfSenderObserver*>
     (
         new RTCDtmfSenderObserverImpl(static_cast<void*>(callbacks))
@@ -58,7 +58,7 @@ RTCDtmfSender_InsertDtmf (
 {
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCDtmfSender> p = static_cast<RTCDtmfSender*>(handle);
+    RTCDtmfSender* p = static_cast<RTCDtmfSender*>(handle);
     if (comma_delay) {
         p->InsertDtmf(string(tones), duration, inter_tone_gap, *comma_delay);
     }
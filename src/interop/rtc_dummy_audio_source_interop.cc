@@ -21,7 +21,7 @@ RTCDummyAudioSource_RegisterAudioDataObserver(
   // unregistered
   RTCDummyAudioSource_DeRegisterAudioDataObserver(handle);
   
-  scoped_refptr<RTCDummyAudioSource> p = static_cast<RTCDummyAudioSource*>(handle);
+  RTCDummyAudioSource* p = static_cast<RTCDummyAudioSource*>(handle);
   DummyAudioSourceObserver* pObserver = static_cast<DummyAudioSourceObserver*>(
     new DummyAudioSourceObserverImpl(static_cast<void*>(callbacks))
   );
@@ -21,7 +21,7 @@ RTCDummyVideoCapturer_RegisterObserver(
   // unregistered
   RTCDummyVideoCapturer_UnregisterObserver(handle);
   
-  scoped_refptr<RTCDummyVideoCapturer> p = static_cast<RTCDummyVideoCapturer*>(handle);
+  RTCDummyVideoCapturer* p = static_cast<RTCDummyVideoCapturer*>(handle);
   DummyVideoCapturerObserver* pObserver = static_cast<DummyVideoCapturerObserver*>(
     new DummyVideoCapturerObserverImpl(static_cast<void*>(callbacks))
   );
@@ -68,7 +68,7 @@ RTCDummyVideoCapturer_Start2(
     return rtcResultU4::kInvalidParameter;
   }
 
-  scoped_refptr<RTCDummyVideoCapturer> p = static_cast<RTCDummyVideoCapturer*>(handle);
+  RTCDummyVideoCapturer* p = static_cast<RTCDummyVideoCapturer*>(handle);
   *pOutRetVal = static_cast<rtcCaptureState>(p->Start(
     static_cast<uint32_t>(fps)
   ));
@@ -91,7 +91,7 @@ RTCDummyVideoCapturer_Start3(
     return rtcResultU4::kInvalidParameter;
   }
 
-  scoped_refptr<RTCDummyVideoCapturer> p = static_cast<RTCDummyVideoCapturer*>(handle);
+  RTCDummyVideoCapturer* p = static_cast<RTCDummyVideoCapturer*>(handle);
   *pOutRetVal = static_cast<rtcCaptureState>(p->Start(
     static_cast<uint32_t>(fps),
     static_cast<uint32_t>(width),
@@ -128,3 +128,21 @@ RTCDummyVideoCapturer_GetState(
 {
     DECLARE_GET_VALUE(handle, pOutRetVal, rtcCaptureState, RTCDummyVideoCapturer, state);
 }
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCDummyVideoCapturer_SetLatencyWatermark(
+    rtcDummyVideoCapturerHandle handle,
+    rtcBool32 enable
+) noexcept
+{
+    DECLARE_SET_VALUE(handle, enable, bool, RTCDummyVideoCapturer, SetLatencyWatermark);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCDummyVideoCapturer_GetLatencyWatermark(
+    rtcDummyVideoCapturerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept
+{
+    DECLARE_GET_VALUE(handle, pOutRetVal, rtcBool32, RTCDummyVideoCapturer, GetLatencyWatermark);
+}
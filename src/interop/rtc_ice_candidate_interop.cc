@@ -57,6 +57,26 @@ RTCIceCandidate_GetSdpMid(
     DECLARE_GET_STRING(iceCandidate, value, sz_value, RTCIceCandidate, sdp_mid);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCIceCandidate_GetCandidateView(
+    rtcIceCandidateHandle iceCandidate,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(iceCandidate, pOutData, pOutLength, RTCIceCandidate, candidate_view);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCIceCandidate_GetSdpMidView(
+    rtcIceCandidateHandle iceCandidate,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(iceCandidate, pOutData, pOutLength, RTCIceCandidate, sdp_mid_view);
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCIceCandidate_GetSdpMlineIndex(
     rtcIceCandidateHandle iceCandidate,
@@ -18,8 +18,8 @@ RTCMediaStream_AddAudioTrack(
     CHECK_POINTER_EX(mediaStream, rtcBool32::kFalse);
     CHECK_POINTER_EX(audioTrack, rtcBool32::kFalse);
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
-    scoped_refptr<RTCAudioTrack> pAudioTrack = static_cast<RTCAudioTrack*>(audioTrack);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCAudioTrack* pAudioTrack = static_cast<RTCAudioTrack*>(audioTrack);
     return pMediaStream->AddTrack(pAudioTrack)
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
@@ -34,8 +34,8 @@ RTCMediaStream_AddVideoTrack(
     CHECK_POINTER_EX(mediaStream, rtcBool32::kFalse);
     CHECK_POINTER_EX(videoTrack, rtcBool32::kFalse);
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
-    scoped_refptr<RTCVideoTrack> pVideoTrack = static_cast<RTCVideoTrack*>(videoTrack);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCVideoTrack* pVideoTrack = static_cast<RTCVideoTrack*>(videoTrack);
     return pMediaStream->AddTrack(pVideoTrack)
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
@@ -79,7 +79,7 @@ RTCMediaStream_NumberOfAudioTracks(
 ) noexcept
 {
     CHECK_POINTER_EX(mediaStream, 0);
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     vector<scoped_refptr<RTCAudioTrack>> audio_tracks = pMediaStream->audio_tracks();
     return static_cast<int>(audio_tracks.size());
 }
@@ -90,7 +90,7 @@ RTCMediaStream_NumberOfVideoTracks(
 ) noexcept
 {
     CHECK_POINTER_EX(mediaStream, 0);
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     vector<scoped_refptr<RTCVideoTrack>> video_tracks = pMediaStream->video_tracks();
     return static_cast<int>(video_tracks.size());
 }
@@ -108,7 +108,7 @@ RTCMediaStream_GetAudioTrack (
         return rtcResultU4::kOutOfRange;
     }
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     vector<scoped_refptr<RTCAudioTrack>> audio_tracks = pMediaStream->audio_tracks();
     size_t ndx = static_cast<size_t>(index);
     if (ndx >= audio_tracks.size()) {
@@ -132,7 +132,7 @@ RTCMediaStream_GetVideoTrack (
         return rtcResultU4::kOutOfRange;
     }
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     vector<scoped_refptr<RTCVideoTrack>> video_tracks = pMediaStream->video_tracks();
     size_t ndx = static_cast<size_t>(index);
     if (ndx >= video_tracks.size()) {
@@ -154,7 +154,7 @@ RTCMediaStream_FindAudioTrack (
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_POINTER_EX(track_id, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     scoped_refptr<RTCAudioTrack> audio_track = pMediaStream->FindAudioTrack(string(track_id));
     *pOutRetVal = static_cast<rtcAudioTrackHandle>(audio_track.release());
     return rtcResultU4::kSuccess;
@@ -171,7 +171,7 @@ RTCMediaStream_FindVideoTrack (
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_POINTER_EX(track_id, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCMediaStream> pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
+    RTCMediaStream* pMediaStream = static_cast<RTCMediaStream*>(mediaStream);
     scoped_refptr<RTCVideoTrack> video_track = pMediaStream->FindVideoTrack(string(track_id));
     *pOutRetVal = static_cast<rtcVideoTrackHandle>(video_track.release());
     return rtcResultU4::kSuccess;
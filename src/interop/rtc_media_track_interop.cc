@@ -15,7 +15,7 @@ RTCMediaTrack_GetState(
 ) noexcept
 {
     CHECK_POINTER_EX(mediaTrack, rtcTrackState::kUnknown);
-    scoped_refptr<RTCMediaTrack> pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
+    RTCMediaTrack* pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
     return static_cast<rtcTrackState>(pMediaTrack->state());
 }
 
@@ -39,13 +39,33 @@ RTCMediaTrack_GetId(
     DECLARE_GET_STRING(mediaTrack, pOutId, cchOutId, RTCMediaTrack, id);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCMediaTrack_GetKindView(
+    rtcMediaTrackHandle mediaTrack,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(mediaTrack, pOutData, pOutLength, RTCMediaTrack, kind_view);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCMediaTrack_GetIdView(
+    rtcMediaTrackHandle mediaTrack,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(mediaTrack, pOutData, pOutLength, RTCMediaTrack, id_view);
+}
+
 rtcBool32 LIB_WEBRTC_CALL
 RTCMediaTrack_GetEnabled(
     rtcMediaTrackHandle mediaTrack
 ) noexcept
 {
     CHECK_POINTER_EX(mediaTrack, rtcBool32::kFalse);
-    scoped_refptr<RTCMediaTrack> pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
+    RTCMediaTrack* pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
     return pMediaTrack->enabled()
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
@@ -58,7 +78,7 @@ RTCMediaTrack_SetEnabled(
 ) noexcept
 {
     CHECK_POINTER_EX(mediaTrack, rtcBool32::kFalse);
-    scoped_refptr<RTCMediaTrack> pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
+    RTCMediaTrack* pMediaTrack = static_cast<RTCMediaTrack*>(mediaTrack);
     return pMediaTrack->set_enabled(enabled != rtcBool32::kFalse)
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
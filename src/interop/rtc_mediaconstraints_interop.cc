@@ -27,7 +27,7 @@ MediaConstraints_AddMandatoryConstraint(
     CHECK_POINTER_EX(key, rtcResultU4::kInvalidParameter);
     CHECK_POINTER_EX(value, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCMediaConstraints> media_constraints = static_cast<RTCMediaConstraints*>(handle);
+    RTCMediaConstraints* media_constraints = static_cast<RTCMediaConstraints*>(handle);
     media_constraints->AddMandatoryConstraint(string(key), string(value));
 
     return rtcResultU4::kSuccess;
@@ -43,7 +43,7 @@ MediaConstraints_AddOptionalConstraint(
     CHECK_POINTER_EX(key, rtcResultU4::kInvalidParameter);
     CHECK_POINTER_EX(value, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCMediaConstraints> media_constraints = static_cast<RTCMediaConstraints*>(handle);
+    RTCMediaConstraints* media_constraints = static_cast<RTCMediaConstraints*>(handle);
     media_constraints->AddOptionalConstraint(string(key), string(value));
 
     return rtcResultU4::kSuccess;
@@ -36,6 +36,20 @@ RTCConfiguration CreateRtcConfiguration(const rtcPeerConnectionConfiguration* co
     result.max_ipv6_networks = configuration->max_ipv6_networks;
     result.disable_link_local_networks = configuration->disable_link_local_networks != rtcBool32::kFalse;
     result.screencast_min_bitrate = configuration->screencast_min_bitrate;
+    result.continual_gathering_policy = configuration->continual_gathering_policy;
+    result.ice_check_interval_strong_connectivity = configuration->ice_check_interval_strong_connectivity;
+    result.ice_check_interval_weak_connectivity = configuration->ice_check_interval_weak_connectivity;
+    result.ice_check_min_interval = configuration->ice_check_min_interval;
+    result.ice_connection_receiving_timeout = configuration->ice_connection_receiving_timeout;
+    result.ice_backup_candidate_pair_ping_interval = configuration->ice_backup_candidate_pair_ping_interval;
+    result.min_port = configuration->min_port;
+    result.max_port = configuration->max_port;
+    result.audio_jitter_buffer_max_packets = configuration->audio_jitter_buffer_max_packets;
+    result.audio_jitter_buffer_fast_accelerate = configuration->audio_jitter_buffer_fast_accelerate != rtcBool32::kFalse;
+    result.audio_jitter_buffer_min_delay_ms = configuration->audio_jitter_buffer_min_delay_ms;
+    result.ice_candidate_filter = configuration->ice_candidate_filter;
+    result.ice_candidate_batch_size = configuration->ice_candidate_batch_size;
+    result.ice_candidate_batch_window_ms = configuration->ice_candidate_batch_window_ms;
     result.use_rtp_mux = configuration->use_rtp_mux != rtcBool32::kFalse;
     result.local_audio_bandwidth = configuration->local_audio_bandwidth;
     result.local_video_bandwidth = configuration->local_video_bandwidth;
@@ -90,7 +104,7 @@ RTCPeerConnectionFactory_CreatePeerConnection(
     CHECK_NATIVE_HANDLE(factory);
 
     RTCConfiguration rtcConfig = CreateRtcConfiguration(configuration);
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCMediaConstraints> media_constraints = (constraints == nullptr)
         ? RTCMediaConstraints::Create()
         : scoped_refptr<RTCMediaConstraints>(static_cast<RTCMediaConstraints*>(constraints));
@@ -126,7 +140,7 @@ RTCPeerConnectionFactory_GetAudioDevice(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCAudioDevice> audio_device = pFactory->GetAudioDevice();
     
     /// The 'release' operation preserves the pointer.
@@ -143,7 +157,7 @@ RTCPeerConnectionFactory_GetVideoDevice(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCVideoDevice> video_device = pFactory->GetVideoDevice();
     
     *pRetVal = static_cast<rtcVideoDeviceHandle>(video_device.release());
@@ -160,7 +174,7 @@ RTCPeerConnectionFactory_GetDesktopDevice(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCDesktopDevice> desktop_device = pFactory->GetDesktopDevice();
     
     *pRetVal = static_cast<rtcDesktopDeviceHandle>(desktop_device.release());
@@ -178,7 +192,7 @@ RTCPeerConnectionFactory_CreateAudioSource(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCAudioSource> audio_source = pFactory->CreateAudioSource(string(audio_source_label));
 
     *pRetVal = static_cast<rtcAudioSourceHandle>(audio_source.release());
@@ -197,7 +211,7 @@ RTCPeerConnectionFactory_CreateDummyAudioSource(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     if (!pFactory->GetUseDummyAudio()) {
         return rtcResultU4::kDummyAudioSourceNotSupported;
     }
@@ -224,10 +238,10 @@ RTCPeerConnectionFactory_CreateVideoSource(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(capturer, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
-    scoped_refptr<RTCVideoCapturer> video_capturer = static_cast<RTCVideoCapturer*>(capturer);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCVideoCapturer* video_capturer = static_cast<RTCVideoCapturer*>(capturer);
     /// A null value is accepted for 'constraints'.
-    scoped_refptr<RTCMediaConstraints> media_constraints = static_cast<RTCMediaConstraints*>(constraints);
+    RTCMediaConstraints* media_constraints = static_cast<RTCMediaConstraints*>(constraints);
     scoped_refptr<RTCVideoSource> video_source = pFactory->CreateVideoSource(video_capturer, string(video_source_label), media_constraints);
 
     *pRetVal = static_cast<rtcVideoSourceHandle>(video_source.release());
@@ -248,10 +262,10 @@ RTCPeerConnectionFactory_CreateDesktopSource(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(capturer, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
-    scoped_refptr<RTCDesktopCapturer> desktop_capturer = static_cast<RTCDesktopCapturer*>(capturer);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCDesktopCapturer* desktop_capturer = static_cast<RTCDesktopCapturer*>(capturer);
     /// A null value is accepted for 'constraints'.
-    scoped_refptr<RTCMediaConstraints> media_constraints = static_cast<RTCMediaConstraints*>(constraints);
+    RTCMediaConstraints* media_constraints = static_cast<RTCMediaConstraints*>(constraints);
     scoped_refptr<RTCVideoSource> video_source = pFactory->CreateDesktopSource(desktop_capturer, string(video_source_label), media_constraints);
     
     *pRetVal = static_cast<rtcVideoSourceHandle>(video_source.release());
@@ -273,7 +287,7 @@ RTCPeerConnectionFactory_CreateDummyVideoCapturer(
         return rtcResultU4::kInvalidParameter;
     }
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCDummyVideoCapturer> pDummyVideoCapturer = pFactory->CreateDummyVideoCapturer(
         fps, width, height
     );
@@ -292,8 +306,8 @@ RTCPeerConnectionFactory_CreateDummyVideoSource(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(capturer, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
-    scoped_refptr<RTCDummyVideoCapturer> pDummyVideoCapturer = static_cast<RTCDummyVideoCapturer*>(capturer);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCDummyVideoCapturer* pDummyVideoCapturer = static_cast<RTCDummyVideoCapturer*>(capturer);
     scoped_refptr<RTCVideoSource> pVideoSource = pFactory->CreateDummyVideoSource(
         pDummyVideoCapturer,
         string(video_source_label)
@@ -314,8 +328,8 @@ RTCPeerConnectionFactory_CreateAudioTrack(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(source, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
-    scoped_refptr<RTCAudioSource> audio_source = static_cast<RTCAudioSource*>(source);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCAudioSource* audio_source = static_cast<RTCAudioSource*>(source);
     scoped_refptr<RTCAudioTrack> audio_track = pFactory->CreateAudioTrack(audio_source, string(track_id));
 
     *pRetVal = static_cast<rtcAudioTrackHandle>(audio_track.release());
@@ -334,11 +348,11 @@ RTCPeerConnectionFactory_CreateDummyAudioTrack(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(source, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     if (!pFactory->GetUseDummyAudio()) {
         return rtcResultU4::kDummyAudioSourceNotSupported;
     }
-    scoped_refptr<RTCDummyAudioSource> audio_source = static_cast<RTCDummyAudioSource*>(source);
+    RTCDummyAudioSource* audio_source = static_cast<RTCDummyAudioSource*>(source);
     scoped_refptr<RTCAudioTrack> audio_track = pFactory->CreateAudioTrack(audio_source, string(track_id));
 
     *pRetVal = static_cast<rtcAudioTrackHandle>(audio_track.release());
@@ -357,8 +371,8 @@ RTCPeerConnectionFactory_CreateVideoTrack(
     CHECK_NATIVE_HANDLE(factory);
     CHECK_POINTER_EX(source, rtcResultU4::kInvalidParameter);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
-    scoped_refptr<RTCVideoSource> video_source = static_cast<RTCVideoSource*>(source);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCVideoSource* video_source = static_cast<RTCVideoSource*>(source);
     scoped_refptr<RTCVideoTrack> video_track = pFactory->CreateVideoTrack(video_source, string(track_id));
 
     *pRetVal = static_cast<rtcVideoTrackHandle>(video_track.release());
@@ -375,7 +389,7 @@ RTCPeerConnectionFactory_CreateStream(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCMediaStream> media_stream = pFactory->CreateStream(string(stream_id));
 
     *pRetVal = static_cast<rtcMediaStreamHandle>(media_stream.release());
@@ -392,7 +406,7 @@ RTCPeerConnectionFactory_GetRtpSenderCapabilities(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCRtpCapabilities> rtp_capabilities = pFactory->GetRtpSenderCapabilities(media_type);
 
     *pRetVal = static_cast<rtcRtpCapabilitiesHandle>(rtp_capabilities.release());
@@ -409,7 +423,7 @@ RTCPeerConnectionFactory_GetRtpReceiverCapabilities(
     CHECK_OUT_POINTER(pRetVal);
     CHECK_NATIVE_HANDLE(factory);
 
-    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
     scoped_refptr<RTCRtpCapabilities> rtp_capabilities = pFactory->GetRtpReceiverCapabilities(media_type);
 
     *pRetVal = static_cast<rtcRtpCapabilitiesHandle>(rtp_capabilities.release());
@@ -424,3 +438,16 @@ RTCPeerConnectionFactory_GetUseDummyAudio(
 {
     DECLARE_GET_VALUE(factory, pRetVal, rtcBool32, RTCPeerConnectionFactory, GetUseDummyAudio);
 }
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnectionFactory_SetObserverThread(
+    rtcPeerConnectionFactoryHandle factory,
+    rtcObserverThread thread
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(factory);
+
+    RTCPeerConnectionFactory* pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    pFactory->SetObserverThread(thread);
+    return rtcResultU4::kSuccess;
+} // end RTCPeerConnectionFactory_SetObserverThread
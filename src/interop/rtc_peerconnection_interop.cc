@@ -51,8 +51,8 @@ RTCPeerConnection_AddStream (
   CHECK_POINTER_EX(stream, rtcResultU4::kInvalidParameter);
   CHECK_NATIVE_HANDLE(handle);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCMediaStream> pStream = static_cast<RTCMediaStream*>(stream);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCMediaStream* pStream = static_cast<RTCMediaStream*>(stream);
   int retVal = p->AddStream(pStream);
   if (pOutRetVal) {
     *pOutRetVal = retVal;
@@ -92,7 +92,7 @@ RTCPeerConnection_CreateLocalMediaStream (
   CHECK_OUT_POINTER(pOutRetVal);
   CHECK_NATIVE_HANDLE(handle);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   scoped_refptr<RTCMediaStream> pStream = p->CreateLocalMediaStream(string(stream_id));
   *pOutRetVal = static_cast<rtcMediaStreamHandle>(pStream.release());
   return rtcResultU4::kSuccess;
@@ -120,7 +120,7 @@ RTCPeerConnection_CreateDataChannel (
     initDict.id = dataChannelDict->id;
   }
 
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   scoped_refptr<RTCDataChannel> pDataChannel = p->CreateDataChannel(string(label), &initDict);
   *pOutRetVal = static_cast<rtcDataChannelHandle>(pDataChannel.release());
   return rtcResultU4::kSuccess;
@@ -140,7 +140,7 @@ RTCPeerConnection_CreateOffer (
   CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(constraints, rtcResultU4::kInvalidParameter);
 
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   OnSdpCreateSuccess fn_success = [success, user_data](const string sdp, const string type) {
     success(user_data, sdp.c_string(), type.c_string());
   };
@@ -166,7 +166,7 @@ RTCPeerConnection_CreateAnswer (
   CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(constraints, rtcResultU4::kInvalidParameter);
 
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   OnSdpCreateSuccess fn_success = [success, user_data](const string sdp, const string type) {
     success(user_data, sdp.c_string(), type.c_string());
   };
@@ -184,7 +184,7 @@ RTCPeerConnection_RestartIce (
 ) noexcept
 {
   CHECK_NATIVE_HANDLE(handle);
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->RestartIce();
   return rtcResultU4::kSuccess;
 }
@@ -224,7 +224,7 @@ RTCPeerConnection_SetLocalDescription (
   OnSetSdpFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->SetLocalDescription(string(sdp), string(type), fn_success, fn_failure);
   return rtcResultU4::kSuccess;
 }
@@ -249,7 +249,7 @@ RTCPeerConnection_SetRemoteDescription (
   OnSetSdpFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->SetRemoteDescription(string(sdp), string(type), fn_success, fn_failure);
   return rtcResultU4::kSuccess;
 }
@@ -272,7 +272,7 @@ RTCPeerConnection_GetLocalDescription (
   OnGetSdpFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->GetLocalDescription(fn_success, fn_failure);
   return rtcResultU4::kSuccess;
 }
@@ -295,7 +295,7 @@ RTCPeerConnection_GetRemoteDescription (
   OnGetSdpFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->GetRemoteDescription(fn_success, fn_failure);
   return rtcResultU4::kSuccess;
 }
@@ -310,7 +310,7 @@ RTCPeerConnection_AddCandidate (
 {
   CHECK_NATIVE_HANDLE(handle);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->AddCandidate(
     string(mid),
     mid_mline_index,
@@ -331,7 +331,7 @@ RTCPeerConnection_RegisterObserver (
   // unregistered
   RTCPeerConnection_UnregisterObserver(handle);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   RTCPeerConnectionObserver* pObserver = static_cast<RTCPeerConnectionObserver*>(
     new RTCPeerConnectionObserverImpl(static_cast<void*>(callbacks))
   );
@@ -391,8 +391,8 @@ RTCPeerConnection_GetSenderStats (
   CHECK_POINTER_EX(success, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
 
-  OnStatsCollectorSuccess fn_success = [success, user_data](const vector<scoped_refptr<MediaRTCStats>> reports) {
-    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(reports);
+  OnStatsCollectorSuccess fn_success = [success, user_data](vector<scoped_refptr<MediaRTCStats>> reports) {
+    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(std::move(reports));
     success(
       user_data,
       static_cast<rtcMediaRTCStatsListHandle>(pList.release())
@@ -401,8 +401,8 @@ RTCPeerConnection_GetSenderStats (
   OnStatsCollectorFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCRtpSender> pSender = static_cast<RTCRtpSender*>(sender);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCRtpSender* pSender = static_cast<RTCRtpSender*>(sender);
   bool retVal = p->GetStats(pSender, fn_success, fn_failure);
   if (pOutRetVal) {
     *pOutRetVal = static_cast<rtcBool32>(retVal);
@@ -428,8 +428,8 @@ RTCPeerConnection_GetReceiverStats (
   CHECK_POINTER_EX(success, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
 
-  OnStatsCollectorSuccess fn_success = [success, user_data](const vector<scoped_refptr<MediaRTCStats>> reports) {
-    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(reports);
+  OnStatsCollectorSuccess fn_success = [success, user_data](vector<scoped_refptr<MediaRTCStats>> reports) {
+    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(std::move(reports));
     success(
       user_data,
       static_cast<rtcMediaRTCStatsListHandle>(pList.release())
@@ -438,8 +438,8 @@ RTCPeerConnection_GetReceiverStats (
   OnStatsCollectorFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCRtpReceiver> pReceiver = static_cast<RTCRtpReceiver*>(receiver);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCRtpReceiver* pReceiver = static_cast<RTCRtpReceiver*>(receiver);
   bool retVal = p->GetStats(pReceiver, fn_success, fn_failure);
   if (pOutRetVal) {
     *pOutRetVal = static_cast<rtcBool32>(retVal);
@@ -459,8 +459,8 @@ RTCPeerConnection_GetStats (
   CHECK_POINTER_EX(success, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
 
-  OnStatsCollectorSuccess fn_success = [success, user_data](const vector<scoped_refptr<MediaRTCStats>> reports) {
-    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(reports);
+  OnStatsCollectorSuccess fn_success = [success, user_data](vector<scoped_refptr<MediaRTCStats>> reports) {
+    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(std::move(reports));
     success(
       user_data,
       static_cast<rtcMediaRTCStatsListHandle>(pList.release())
@@ -469,11 +469,91 @@ RTCPeerConnection_GetStats (
   OnStatsCollectorFailure fn_failure = [failure, user_data](const char* error) {
     failure(user_data, error);
   };
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   p->GetStats(fn_success, fn_failure);
   return rtcResultU4::kSuccess;
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnection_GetFilteredStats (
+    rtcPeerConnectionHandle handle,
+    const char* stats_types,
+    const char* member_names,
+    rtcBool32 delta,
+    rtcObjectHandle user_data,
+    rtcOnStatsCollectorSuccessDelegate success,
+    rtcOnFailureDelegate failure
+) noexcept
+{
+  CHECK_NATIVE_HANDLE(handle);
+  CHECK_POINTER_EX(success, rtcResultU4::kInvalidParameter);
+  CHECK_POINTER_EX(failure, rtcResultU4::kInvalidParameter);
+
+  RTCStatsFilter filter;
+  filter.types = string(stats_types).split("\n");
+  filter.members = string(member_names).split("\n");
+  filter.delta = delta != rtcBool32::kFalse;
+
+  OnStatsCollectorSuccess fn_success = [success, user_data](vector<scoped_refptr<MediaRTCStats>> reports) {
+    scoped_refptr<MediaRTCStatsList> pList = MediaRTCStatsList::Create(std::move(reports));
+    success(
+      user_data,
+      static_cast<rtcMediaRTCStatsListHandle>(pList.release())
+    );
+  };
+  OnStatsCollectorFailure fn_failure = [failure, user_data](const char* error) {
+    failure(user_data, error);
+  };
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  p->GetFilteredStats(filter, fn_success, fn_failure);
+  return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCPeerConnection_CreateStatsSampler (
+    rtcPeerConnectionHandle handle,
+    int interval_ms,
+    int history_size,
+    const char* fields,
+    rtcStatsSamplerHandle* pOutRetVal
+) noexcept
+{
+  CHECK_OUT_POINTER(pOutRetVal);
+  CHECK_NATIVE_HANDLE(handle);
+  CHECK_POINTER_EX(fields, rtcResultU4::kInvalidParameter);
+
+  std::vector<RTCStatsSamplerField> sampler_fields;
+  for (const string& item : string(fields).split("\n")) {
+    std::string field = item.std_string();
+    size_t dot = field.find('.');
+    if (dot == std::string::npos || dot == 0 || dot + 1 == field.size()) {
+      return rtcResultU4::kInvalidParameter;
+    }
+    RTCStatsSamplerField sampler_field;
+    std::string member = field.substr(dot + 1);
+    if (member.size() > 2 && member.compare(member.size() - 2, 2, "/s") == 0) {
+      member.resize(member.size() - 2);
+      sampler_field.rate = true;
+    }
+    sampler_field.type = field.substr(0, dot);
+    sampler_field.member = member;
+    sampler_fields.push_back(sampler_field);
+  }
+
+  RTCStatsSamplerConfig config;
+  config.interval_ms = interval_ms;
+  config.history_size = history_size;
+  config.fields = sampler_fields;
+
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  scoped_refptr<RTCStatsSampler> pSampler = p->CreateStatsSampler(config);
+  if (pSampler == nullptr) {
+    return rtcResultU4::kInvalidParameter;
+  }
+  *pOutRetVal = static_cast<rtcStatsSamplerHandle>(pSampler.release());
+  return rtcResultU4::kSuccess;
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCPeerConnection_AddTransceiver1 (
     rtcPeerConnectionHandle handle,
@@ -484,7 +564,7 @@ RTCPeerConnection_AddTransceiver1 (
   CHECK_OUT_POINTER(pOutRetVal);
   CHECK_NATIVE_HANDLE(handle);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
   scoped_refptr<RTCRtpTransceiver> pTransceiver = p->AddTransceiver(static_cast<RTCMediaType>(media_type));
   *pOutRetVal = static_cast<rtcRtpTransceiverHandle>(pTransceiver.release());
   return rtcResultU4::kSuccess;
@@ -501,8 +581,8 @@ RTCPeerConnection_AddTransceiver2 (
   CHECK_NATIVE_HANDLE(handle);
   CHECK_POINTER_EX(track, rtcResultU4::kInvalidParameter);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCMediaTrack> pTrack = static_cast<RTCMediaTrack*>(track);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCMediaTrack* pTrack = static_cast<RTCMediaTrack*>(track);
   scoped_refptr<RTCRtpTransceiver> pTransceiver = p->AddTransceiver(pTrack);
   *pOutRetVal = static_cast<rtcRtpTransceiverHandle>(pTransceiver.release());
   return rtcResultU4::kSuccess;
@@ -521,9 +601,9 @@ RTCPeerConnection_AddTransceiver3 (
   CHECK_POINTER_EX(track, rtcResultU4::kInvalidParameter);
   CHECK_POINTER_EX(init, rtcResultU4::kInvalidParameter);
   
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCMediaTrack> pTrack = static_cast<RTCMediaTrack*>(track);
-  scoped_refptr<RTCRtpTransceiverInit> pInit = static_cast<RTCRtpTransceiverInit*>(init);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCMediaTrack* pTrack = static_cast<RTCMediaTrack*>(track);
+  RTCRtpTransceiverInit* pInit = static_cast<RTCRtpTransceiverInit*>(init);
   scoped_refptr<RTCRtpTransceiver> pTransceiver = p->AddTransceiver(pTrack, pInit);
   *pOutRetVal = static_cast<rtcRtpTransceiverHandle>(pTransceiver.release());
   return rtcResultU4::kSuccess;
@@ -542,8 +622,8 @@ RTCPeerConnection_AddTrack (
   CHECK_POINTER_EX(track, rtcResultU4::kInvalidParameter);
 
   vector<string> streamIds = string(stream_ids).split("\n");
-  scoped_refptr<RTCPeerConnection> p = static_cast<RTCPeerConnection*>(handle);
-  scoped_refptr<RTCMediaTrack> pTrack = static_cast<RTCMediaTrack*>(track);
+  RTCPeerConnection* p = static_cast<RTCPeerConnection*>(handle);
+  RTCMediaTrack* pTrack = static_cast<RTCMediaTrack*>(track);
   scoped_refptr<RTCRtpSender> pSender = p->AddTrack(pTrack, streamIds);
   *pOutRetVal = static_cast<rtcRtpSenderHandle>(pSender.release());
   return rtcResultU4::kSuccess;
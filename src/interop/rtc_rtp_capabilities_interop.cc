@@ -40,6 +40,16 @@ RTCRtpCodecCapability_GetMimeType(
     DECLARE_GET_STRING(handle, value, sz_value, RTCRtpCodecCapability, mime_type);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpCodecCapability_GetMimeTypeView(
+    rtcRtpCodecCapabilityHandle handle,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(handle, pOutData, pOutLength, RTCRtpCodecCapability, mime_type_view);
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpCodecCapability_SetMimeType(
     rtcRtpCodecCapabilityHandle handle,
@@ -95,6 +105,16 @@ RTCRtpCodecCapability_GetSdpFmtpLine(
     DECLARE_GET_STRING(handle, value, sz_value, RTCRtpCodecCapability, sdp_fmtp_line);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpCodecCapability_GetSdpFmtpLineView(
+    rtcRtpCodecCapabilityHandle handle,
+    const char** pOutData,
+    int* pOutLength
+) noexcept
+{
+    DECLARE_GET_STRING_VIEW(handle, pOutData, pOutLength, RTCRtpCodecCapability, sdp_fmtp_line_view);
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpCodecCapability_SetSdpFmtpLine(
     rtcRtpCodecCapabilityHandle handle,
@@ -123,12 +143,12 @@ RTCRtpCodecCapabilityList_Create (
         return rtcResultU4::kInvalidParameter;
     }
 
-    std::vector<scoped_refptr<RTCRtpCodecCapability>> vecItems;
+    vector<scoped_refptr<RTCRtpCodecCapability>> vecItems;
+    vecItems.reserve(static_cast<size_t>(count));
     for (int i = 0; i < count; i++) {
-        scoped_refptr<RTCRtpCodecCapability> pItem = static_cast<RTCRtpCodecCapability*>(items[i]);
-        vecItems.push_back(pItem);
+        vecItems.push_back(static_cast<RTCRtpCodecCapability*>(items[i]));
     }
-    scoped_refptr<RTCRtpCodecCapabilityList> p = RTCRtpCodecCapabilityList::Create(vecItems);
+    scoped_refptr<RTCRtpCodecCapabilityList> p = RTCRtpCodecCapabilityList::Create(std::move(vecItems));
     *pOutRetVal = static_cast<rtcRtpCodecCapabilityListHandle>(p.release());
     return rtcResultU4::kSuccess;
 }
@@ -440,7 +440,7 @@ RTCRtpCodecParameters_GetParameters (
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpCodecParameters> p = static_cast<RTCRtpCodecParameters*>(handle);
+    RTCRtpCodecParameters* p = static_cast<RTCRtpCodecParameters*>(handle);
     std::vector<std::pair<string, string>> parameters = p->parameters().std_vector();
     std::vector<scoped_refptr<RTCRtpCodecParametersPair>> pParameters;
     for (auto item : parameters) {
@@ -462,10 +462,10 @@ RTCRtpCodecParameters_SetParameters (
 {
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpCodecParameters> p = static_cast<RTCRtpCodecParameters*>(handle);
+    RTCRtpCodecParameters* p = static_cast<RTCRtpCodecParameters*>(handle);
     vector<std::pair<string, string>> parameters;
     if (value) {
-        scoped_refptr<RTCRtpCodecParametersMap> pMap = static_cast<RTCRtpCodecParametersMap*>(value);
+        RTCRtpCodecParametersMap* pMap = static_cast<RTCRtpCodecParametersMap*>(value);
         parameters = pMap->to_parameters();
     }
     p->set_parameters(parameters);
@@ -617,6 +617,32 @@ RTCRtpEncodingParameters_Create (
     return rtcResultU4::kSuccess;
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpEncodingParameters_GetAll (
+    rtcRtpEncodingParametersHandle handle,
+    rtcRtpEncodingParametersInfo* pOutInfo
+) noexcept
+{
+    CHECK_POINTER(pOutInfo);
+    *pOutInfo = rtcRtpEncodingParametersInfo();
+    CHECK_NATIVE_HANDLE(handle);
+
+    RTCRtpEncodingParameters* p = static_cast<RTCRtpEncodingParameters*>(handle);
+    pOutInfo->ssrc = p->ssrc();
+    pOutInfo->bitrate_priority = p->bitrate_priority();
+    pOutInfo->network_priority = static_cast<rtcNetworkPriority>(p->network_priority());
+    pOutInfo->max_bitrate_bps = p->max_bitrate_bps();
+    pOutInfo->min_bitrate_bps = p->min_bitrate_bps();
+    pOutInfo->max_framerate = p->max_framerate();
+    pOutInfo->num_temporal_layers = p->num_temporal_layers();
+    pOutInfo->scale_resolution_down_by = p->scale_resolution_down_by();
+    pOutInfo->active = p->active() ? rtcBool32::kTrue : rtcBool32::kFalse;
+    pOutInfo->adaptive_ptime = p->adaptive_ptime() ? rtcBool32::kTrue : rtcBool32::kFalse;
+    p->rid().copy_to(pOutInfo->rid, sizeof(pOutInfo->rid));
+    p->scalability_mode().copy_to(pOutInfo->scalability_mode, sizeof(pOutInfo->scalability_mode));
+    return rtcResultU4::kSuccess;
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpEncodingParameters_GetSSRC (
     rtcRtpEncodingParametersHandle handle,
@@ -854,12 +880,12 @@ RTCRtpEncodingParametersList_Create (
         return rtcResultU4::kInvalidParameter;
     }
 
-    std::vector<scoped_refptr<RTCRtpEncodingParameters>> vecItems;
+    vector<scoped_refptr<RTCRtpEncodingParameters>> vecItems;
+    vecItems.reserve(static_cast<size_t>(count));
     for (int i = 0; i < count; i++) {
-        scoped_refptr<RTCRtpEncodingParameters> pItem = static_cast<RTCRtpEncodingParameters*>(items[i]);
-        vecItems.push_back(pItem);
+        vecItems.push_back(static_cast<RTCRtpEncodingParameters*>(items[i]));
     }
-    scoped_refptr<RTCRtpEncodingParametersList> p = RTCRtpEncodingParametersList::Create(vecItems);
+    scoped_refptr<RTCRtpEncodingParametersList> p = RTCRtpEncodingParametersList::Create(std::move(vecItems));
     *pOutRetVal = static_cast<rtcRtpEncodingParametersListHandle>(p.release());
     return rtcResultU4::kSuccess;
 }
@@ -44,7 +44,7 @@ RTCRtpReceiver_GetStreamIds (
     ZERO_MEMORY(value, sz_value);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpReceiver> p = static_cast<RTCRtpReceiver*>(handle);
+    RTCRtpReceiver* p = static_cast<RTCRtpReceiver*>(handle);
     string strValue = string::join("\n", p->stream_ids());
     size_t len = strValue.copy_to(value, sz_value);
     return strValue.size() > len
@@ -110,7 +110,7 @@ RTCRtpReceiver_RegisterObserver (
     // unregistered
     RTCRtpReceiver_UnregisterObserver(handle);
 
-    scoped_refptr<RTCRtpReceiver> p = static_cast<RTCRtpReceiver*>(handle);
+    RTCRtpReceiver* p = static_cast<RTCRtpReceiver*>(handle);
     RTCRtpReceiverObserver* pObserver = static_cast<RTCRtpReceiverObserver*>
     (
         new RTCRtpReceiverObserverImpl(static_cast<void*>(callbacks))
@@ -81,7 +81,7 @@ RTCRtpSender_GetStreamIds (
     ZERO_MEMORY(value, sz_value);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpSender> p = static_cast<RTCRtpSender*>(handle);
+    RTCRtpSender* p = static_cast<RTCRtpSender*>(handle);
     string strValue = string::join("\n", p->stream_ids());
     size_t len = strValue.copy_to(value, sz_value);
     return strValue.size() > len
@@ -97,7 +97,7 @@ RTCRtpSender_SetStreamIds (
 {
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpSender> p = static_cast<RTCRtpSender*>(handle);
+    RTCRtpSender* p = static_cast<RTCRtpSender*>(handle);
     vector<string> streamIds = string(value).split("\n");
     p->set_stream_ids(streamIds);
     return rtcResultU4::kSuccess;
@@ -121,6 +121,45 @@ RTCRtpSender_GetParameters (
     DECLARE_GET_VALUE(handle, pOutRetVal, rtcRtpParametersHandle, RTCRtpSender, parameters().release);
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCRtpSender_GetParametersSnapshot (
+    rtcRtpSenderHandle handle,
+    rtcRtpSenderParametersSnapshot* pOutSnapshot,
+    rtcRtpEncodingParametersInfo* encodings,
+    int max_encodings
+) noexcept
+{
+    CHECK_POINTER(pOutSnapshot);
+    *pOutSnapshot = rtcRtpSenderParametersSnapshot();
+    CHECK_NATIVE_HANDLE(handle);
+
+    RTCRtpSender* p = static_cast<RTCRtpSender*>(handle);
+    pOutSnapshot->ssrc = p->ssrc();
+    pOutSnapshot->media_type = static_cast<rtcMediaType>(p->media_type());
+
+    scoped_refptr<RTCRtpParameters> parameters = p->parameters();
+    if (parameters == nullptr) {
+        return rtcResultU4::kSuccess;
+    }
+    pOutSnapshot->degradation_preference =
+        static_cast<rtcDegradationPreference>(parameters->GetDegradationPreference());
+    pOutSnapshot->codec_count = static_cast<int>(parameters->codecs().size());
+    pOutSnapshot->header_extension_count =
+        static_cast<int>(parameters->header_extensions().size());
+    parameters->mid().copy_to(pOutSnapshot->mid, sizeof(pOutSnapshot->mid));
+    parameters->transaction_id().copy_to(pOutSnapshot->transaction_id,
+                                         sizeof(pOutSnapshot->transaction_id));
+
+    vector<scoped_refptr<RTCRtpEncodingParameters>> items = parameters->encodings();
+    pOutSnapshot->encoding_count = static_cast<int>(items.size());
+    if (encodings != nullptr) {
+        for (size_t i = 0; i < items.size() && static_cast<int>(i) < max_encodings; i++) {
+            RTCRtpEncodingParameters_GetAll(items[i].get(), &encodings[i]);
+        }
+    }
+    return rtcResultU4::kSuccess;
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCRtpSender_SetParameters (
     rtcRtpSenderHandle handle,
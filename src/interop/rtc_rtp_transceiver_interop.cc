@@ -29,7 +29,7 @@ RTCRtpTransceiverInit_Create (
 
     vector<string> streamIds = string(stream_ids).split("\n");
     vector<scoped_refptr<RTCRtpEncodingParameters>> vecEncoding;
-    scoped_refptr<RTCRtpEncodingParametersList> pList = static_cast<RTCRtpEncodingParametersList*>(encodings);
+    RTCRtpEncodingParametersList* pList = static_cast<RTCRtpEncodingParametersList*>(encodings);
     if (pList) {
         vecEncoding = pList->to_vector();
     }
@@ -74,7 +74,7 @@ RTCRtpTransceiverInit_GetStreamIds (
     ZERO_MEMORY(value, sz_value);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpTransceiverInit> p = static_cast<RTCRtpTransceiverInit*>(handle);
+    RTCRtpTransceiverInit* p = static_cast<RTCRtpTransceiverInit*>(handle);
     string strValue = string::join("\n", p->stream_ids());
     size_t len = strValue.copy_to(value, sz_value);
     return strValue.size() > len
@@ -90,7 +90,7 @@ RTCRtpTransceiverInit_SetStreamIds (
 {
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpTransceiverInit> p = static_cast<RTCRtpTransceiverInit*>(handle);
+    RTCRtpTransceiverInit* p = static_cast<RTCRtpTransceiverInit*>(handle);
     vector<string> streamIds = string(value).split("\n");
     p->set_stream_ids(streamIds);
     return rtcResultU4::kSuccess;
@@ -198,7 +198,7 @@ RTCRtpTransceiver_SetDirectionWithError (
     }
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCRtpTransceiver> p = static_cast<RTCRtpTransceiver*>(handle);
+    RTCRtpTransceiver* p = static_cast<RTCRtpTransceiver*>(handle);
     string strValue = p->SetDirectionWithError(static_cast<RTCRtpTransceiverDirection>(value));
     size_t len = strValue.copy_to(retVal, sz_retVal);
     return strValue.size() > len
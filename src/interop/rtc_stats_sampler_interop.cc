@@ -0,0 +1,170 @@
+/**
+ * File provided for Reference Use Only by isoft (c) 2025.
+ * Copyright (c) isoft. All rights reserved.
+ *
+ */
+
+#include "rtc_stats_sampler.h"
+#include "interop_api.h"
+
+#include <vector>
+
+using namespace libwebrtc;
+
+static void CopySummaries(const RTCStatsSummary* src, int count,
+                          rtcStatsSummary* dst)
+{
+  for (int i = 0; i < count; i++) {
+    dst[i].min = src[i].min;
+    dst[i].max = src[i].max;
+    dst[i].mean = src[i].mean;
+    dst[i].last = src[i].last;
+    dst[i].samples = src[i].samples;
+  }
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Start (
+    rtcStatsSamplerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept
+{
+  DECLARE_GET_VALUE(handle, pOutRetVal, rtcBool32, RTCStatsSampler, Start);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Stop (
+    rtcStatsSamplerHandle handle
+) noexcept
+{
+  CHECK_NATIVE_HANDLE(handle);
+
+  scoped_refptr<RTCStatsSampler> p = static_cast<RTCStatsSampler*>(handle);
+  p->Stop();
+  return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_IsRunning (
+    rtcStatsSamplerHandle handle,
+    rtcBool32* pOutRetVal
+) noexcept
+{
+  DECLARE_GET_VALUE(handle, pOutRetVal, rtcBool32, RTCStatsSampler, IsRunning);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_Clear (
+    rtcStatsSamplerHandle handle
+) noexcept
+{
+  CHECK_NATIVE_HANDLE(handle);
+
+  RTCStatsSampler* p = static_cast<RTCStatsSampler*>(handle);
+  p->Clear();
+  return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetFieldCount (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept
+{
+  DECLARE_GET_VALUE(handle, pOutRetVal, int, RTCStatsSampler, field_count);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetCapacity (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept
+{
+  DECLARE_GET_VALUE(handle, pOutRetVal, int, RTCStatsSampler, capacity);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetSampleCount (
+    rtcStatsSamplerHandle handle,
+    int* pOutRetVal
+) noexcept
+{
+  DECLARE_GET_VALUE(handle, pOutRetVal, int, RTCStatsSampler, sample_count);
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetHistory (
+    rtcStatsSamplerHandle handle,
+    rtcTimestamp* timestamps,
+    double* values,
+    int max_samples,
+    int* pOutRetVal
+) noexcept
+{
+  CHECK_POINTER(pOutRetVal);
+  *pOutRetVal = 0;
+  CHECK_NATIVE_HANDLE(handle);
+
+  RTCStatsSampler* p = static_cast<RTCStatsSampler*>(handle);
+  if (timestamps == nullptr || max_samples <= 0) {
+    *pOutRetVal = p->GetHistory(nullptr, values, max_samples);
+    return rtcResultU4::kSuccess;
+  }
+  std::vector<int64_t> timestamps_us(max_samples);
+  int count = p->GetHistory(timestamps_us.data(), values, max_samples);
+  for (int i = 0; i < count; i++) {
+    timestamps[i] = timestamps_us[i];
+  }
+  *pOutRetVal = count;
+  return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_GetSummary (
+    rtcStatsSamplerHandle handle,
+    rtcStatsSummary* summaries,
+    int max_fields,
+    int* pOutRetVal
+) noexcept
+{
+  CHECK_POINTER(pOutRetVal);
+  *pOutRetVal = 0;
+  CHECK_NATIVE_HANDLE(handle);
+  CHECK_POINTER_EX(summaries, rtcResultU4::kInvalidParameter);
+
+  RTCStatsSampler* p = static_cast<RTCStatsSampler*>(handle);
+  if (max_fields <= 0) {
+    return rtcResultU4::kSuccess;
+  }
+  std::vector<RTCStatsSummary> native(max_fields);
+  int count = p->GetSummary(native.data(), max_fields);
+  CopySummaries(native.data(), count, summaries);
+  *pOutRetVal = count;
+  return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCStatsSampler_SetSummaryCallback (
+    rtcStatsSamplerHandle handle,
+    int every_samples,
+    rtcObjectHandle user_data,
+    rtcStatsSamplerSummaryDelegate callback
+) noexcept
+{
+  CHECK_NATIVE_HANDLE(handle);
+
+  RTCStatsSampler* p = static_cast<RTCStatsSampler*>(handle);
+  if (callback == nullptr) {
+    p->SetSummaryCallback(0, nullptr);
+    return rtcResultU4::kSuccess;
+  }
+
+  OnStatsSamplerSummary fn_summary =
+      [callback, user_data](const RTCStatsSummary* summaries, int count) {
+        std::vector<rtcStatsSummary> copy(count > 0 ? count : 0);
+        CopySummaries(summaries, count, copy.data());
+        callback(user_data, copy.data(), count);
+      };
+  p->SetSummaryCallback(every_samples, fn_summary);
+  return rtcResultU4::kSuccess;
+}
@@ -0,0 +1,438 @@
+/**
+ * File provided for Reference Use Only by isoft (c) 2025.
+ * Copyright (c) isoft. All rights reserved.
+ *
+ */
+
+#include "rtc_peerconnection_factory.h"
+#include "rtc_video_codec.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "interop_api.h"
+
+#include <vector>
+
+using namespace libwebrtc;
+
+static RTCVideoCodecStatus ToVideoCodecStatus(rtcVideoCodecStatus status)
+{
+    switch (status) {
+        case rtcVideoCodecStatus::kOk:
+            return RTCVideoCodecStatus::kOk;
+        case rtcVideoCodecStatus::kFallbackToBuiltin:
+            return RTCVideoCodecStatus::kFallbackToBuiltin;
+        default:
+            return RTCVideoCodecStatus::kError;
+    }
+}
+
+static rtcVideoCodecFormat ToInteropFormat(const RTCVideoCodecFormat& format)
+{
+    rtcVideoCodecFormat result;
+    format.name.copy_to(result.name, sizeof(result.name));
+    format.parameters.copy_to(result.parameters, sizeof(result.parameters));
+    return result;
+}
+
+static vector<RTCVideoCodecFormat> GetInteropFormats(
+    rtcVideoCodecGetSupportedFormatsDelegate get_supported_formats,
+    rtcObjectHandle user_data)
+{
+    const int kMaxFormats = 32;
+    std::vector<RTCVideoCodecFormat> result;
+    if (!get_supported_formats) {
+        return vector<RTCVideoCodecFormat>(result);
+    }
+
+    std::vector<rtcVideoCodecFormat> formats(kMaxFormats);
+    int count = get_supported_formats(user_data, formats.data(), kMaxFormats);
+    for (int i = 0; i < count && i < kMaxFormats; i++) {
+        rtcVideoCodecFormat& format = formats[i];
+        format.name[sizeof(format.name) - 1] = '\0';
+        format.parameters[sizeof(format.parameters) - 1] = '\0';
+        RTCVideoCodecFormat item;
+        item.name = string(format.name);
+        item.parameters = string(format.parameters);
+        result.push_back(item);
+    }
+    return vector<RTCVideoCodecFormat>(result);
+}
+
+/**
+ * class VideoEncoderPluginInterop
+ *
+ * Runs the delegates of an rtcVideoEncoderPluginFactoryCallbacks structure
+ * as an RTCVideoEncoderPlugin. The object itself is the
+ * rtcVideoEncoderPluginHandle of the codec.
+ */
+class VideoEncoderPluginInterop : public RTCVideoEncoderPlugin
+{
+public:
+    VideoEncoderPluginInterop(
+        const rtcVideoEncoderPluginFactoryCallbacks& callbacks,
+        const string& implementation_name)
+        : callbacks_(callbacks),
+          implementation_name_(implementation_name) {}
+
+    ~VideoEncoderPluginInterop()
+    {
+        if (codec_ && callbacks_.Destroy) {
+            callbacks_.Destroy(codec_);
+        }
+    }
+
+    void set_codec(rtcObjectHandle codec) { codec_ = codec; }
+
+    RTCVideoCodecStatus InitEncode(
+        const RTCVideoEncoderSettings& settings) override
+    {
+        if (!callbacks_.InitEncode) {
+            return RTCVideoCodecStatus::kFallbackToBuiltin;
+        }
+        rtcVideoEncoderSettings interop_settings;
+        interop_settings.width = settings.width;
+        interop_settings.height = settings.height;
+        interop_settings.max_framerate = settings.max_framerate;
+        interop_settings.start_bitrate_kbps = settings.start_bitrate_kbps;
+        interop_settings.min_bitrate_kbps = settings.min_bitrate_kbps;
+        interop_settings.max_bitrate_kbps = settings.max_bitrate_kbps;
+        interop_settings.number_of_cores = settings.number_of_cores;
+        interop_settings.mode =
+            settings.mode == RTCVideoCodecMode::kScreensharing
+                ? rtcVideoCodecMode::kScreensharing
+                : rtcVideoCodecMode::kRealtimeVideo;
+        return ToVideoCodecStatus(
+            callbacks_.InitEncode(codec_, &interop_settings));
+    }
+
+    void RegisterCallback(RTCVideoEncoderCallback* callback) override
+    {
+        webrtc::MutexLock lock(&mutex_);
+        callback_ = callback;
+    }
+
+    RTCVideoCodecStatus Encode(scoped_refptr<RTCVideoFrame> frame,
+                               uint32_t rtp_timestamp,
+                               bool key_frame) override
+    {
+        if (!callbacks_.Encode) {
+            return RTCVideoCodecStatus::kError;
+        }
+        return ToVideoCodecStatus(callbacks_.Encode(
+            codec_,
+            static_cast<rtcVideoFrameHandle>(frame.get()),
+            static_cast<unsigned int>(rtp_timestamp),
+            key_frame ? rtcBool32::kTrue : rtcBool32::kFalse));
+    }
+
+    void SetRates(uint32_t bitrate_bps, double framerate_fps) override
+    {
+        if (callbacks_.SetRates) {
+            callbacks_.SetRates(codec_,
+                                static_cast<unsigned int>(bitrate_bps),
+                                framerate_fps);
+        }
+    }
+
+    void Shutdown() override
+    {
+        if (callbacks_.Shutdown) {
+            callbacks_.Shutdown(codec_);
+        }
+    }
+
+    string ImplementationName() const override { return implementation_name_; }
+
+    bool IsHardwareAccelerated() const override
+    {
+        return callbacks_.HardwareAccelerated != rtcBool32::kFalse;
+    }
+
+    void Deliver(const RTCEncodedVideoImage& image)
+    {
+        webrtc::MutexLock lock(&mutex_);
+        if (callback_) {
+            callback_->OnEncodedImage(image);
+        }
+    }
+
+private:
+    const rtcVideoEncoderPluginFactoryCallbacks callbacks_;
+    const string implementation_name_;
+    rtcObjectHandle codec_ = nullptr;
+
+    // Guards the member below.
+    webrtc::Mutex mutex_;
+    RTCVideoEncoderCallback* callback_ = nullptr;
+}; // end class VideoEncoderPluginInterop
+
+/**
+ * class VideoDecoderPluginInterop
+ *
+ * Same as VideoEncoderPluginInterop, for an
+ * rtcVideoDecoderPluginFactoryCallbacks structure.
+ */
+class VideoDecoderPluginInterop : public RTCVideoDecoderPlugin
+{
+public:
+    VideoDecoderPluginInterop(
+        const rtcVideoDecoderPluginFactoryCallbacks& callbacks,
+        const string& implementation_name)
+        : callbacks_(callbacks),
+          implementation_name_(implementation_name) {}
+
+    ~VideoDecoderPluginInterop()
+    {
+        if (codec_ && callbacks_.Destroy) {
+            callbacks_.Destroy(codec_);
+        }
+    }
+
+    void set_codec(rtcObjectHandle codec) { codec_ = codec; }
+
+    RTCVideoCodecStatus InitDecode(
+        const RTCVideoDecoderSettings& settings) override
+    {
+        if (!callbacks_.InitDecode) {
+            return RTCVideoCodecStatus::kFallbackToBuiltin;
+        }
+        rtcVideoDecoderSettings interop_settings;
+        interop_settings.max_width = settings.max_width;
+        interop_settings.max_height = settings.max_height;
+        interop_settings.number_of_cores = settings.number_of_cores;
+        return ToVideoCodecStatus(
+            callbacks_.InitDecode(codec_, &interop_settings));
+    }
+
+    void RegisterCallback(RTCVideoDecoderCallback* callback) override
+    {
+        webrtc::MutexLock lock(&mutex_);
+        callback_ = callback;
+    }
+
+    RTCVideoCodecStatus Decode(const RTCEncodedVideoImage& image) override
+    {
+        if (!callbacks_.Decode) {
+            return RTCVideoCodecStatus::kError;
+        }
+        rtcEncodedVideoImage interop_image;
+        interop_image.data = image.data;
+        interop_image.size = static_cast<int>(image.size);
+        interop_image.width = image.width;
+        interop_image.height = image.height;
+        interop_image.rtp_timestamp =
+            static_cast<unsigned int>(image.rtp_timestamp);
+        interop_image.capture_time_ms =
+            static_cast<rtcTimestamp>(image.capture_time_ms);
+        interop_image.key_frame =
+            image.key_frame ? rtcBool32::kTrue : rtcBool32::kFalse;
+        interop_image.qp = image.qp;
+        return ToVideoCodecStatus(callbacks_.Decode(codec_, &interop_image));
+    }
+
+    void Shutdown() override
+    {
+        if (callbacks_.Shutdown) {
+            callbacks_.Shutdown(codec_);
+        }
+    }
+
+    string ImplementationName() const override { return implementation_name_; }
+
+    bool IsHardwareAccelerated() const override
+    {
+        return callbacks_.HardwareAccelerated != rtcBool32::kFalse;
+    }
+
+    void Deliver(scoped_refptr<RTCVideoFrame> frame, uint32_t rtp_timestamp)
+    {
+        webrtc::MutexLock lock(&mutex_);
+        if (callback_) {
+            callback_->OnDecodedFrame(frame, rtp_timestamp);
+        }
+    }
+
+private:
+    const rtcVideoDecoderPluginFactoryCallbacks callbacks_;
+    const string implementation_name_;
+    rtcObjectHandle codec_ = nullptr;
+
+    // Guards the member below.
+    webrtc::Mutex mutex_;
+    RTCVideoDecoderCallback* callback_ = nullptr;
+}; // end class VideoDecoderPluginInterop
+
+/**
+ * class VideoEncoderPluginFactoryInterop
+ */
+class VideoEncoderPluginFactoryInterop : public RTCVideoEncoderPluginFactory
+{
+public:
+    explicit VideoEncoderPluginFactoryInterop(
+        const rtcVideoEncoderPluginFactoryCallbacks& callbacks)
+        : callbacks_(callbacks),
+          implementation_name_(callbacks.ImplementationName
+                                   ? callbacks.ImplementationName
+                                   : "external") {}
+
+    vector<RTCVideoCodecFormat> GetSupportedFormats() override
+    {
+        return GetInteropFormats(callbacks_.GetSupportedFormats,
+                                 callbacks_.UserData);
+    }
+
+    scoped_refptr<RTCVideoEncoderPlugin> Create(
+        const RTCVideoCodecFormat& format) override
+    {
+        if (!callbacks_.Create) {
+            return nullptr;
+        }
+        scoped_refptr<VideoEncoderPluginInterop> plugin =
+            scoped_refptr<VideoEncoderPluginInterop>(
+                new RefCountedObject<VideoEncoderPluginInterop>(
+                    callbacks_, implementation_name_));
+        rtcVideoCodecFormat interop_format = ToInteropFormat(format);
+        rtcObjectHandle codec = callbacks_.Create(
+            callbacks_.UserData, &interop_format,
+            static_cast<rtcVideoEncoderPluginHandle>(plugin.get()));
+        if (!codec) {
+            return nullptr;
+        }
+        plugin->set_codec(codec);
+        return plugin;
+    }
+
+private:
+    const rtcVideoEncoderPluginFactoryCallbacks callbacks_;
+    const string implementation_name_;
+}; // end class VideoEncoderPluginFactoryInterop
+
+/**
+ * class VideoDecoderPluginFactoryInterop
+ */
+class VideoDecoderPluginFactoryInterop : public RTCVideoDecoderPluginFactory
+{
+public:
+    explicit VideoDecoderPluginFactoryInterop(
+        const rtcVideoDecoderPluginFactoryCallbacks& callbacks)
+        : callbacks_(callbacks),
+          implementation_name_(callbacks.ImplementationName
+                                   ? callbacks.ImplementationName
+                                   : "external") {}
+
+    vector<RTCVideoCodecFormat> GetSupportedFormats() override
+    {
+        return GetInteropFormats(callbacks_.GetSupportedFormats,
+                                 callbacks_.UserData);
+    }
+
+    scoped_refptr<RTCVideoDecoderPlugin> Create(
+        const RTCVideoCodecFormat& format) override
+    {
+        if (!callbacks_.Create) {
+            return nullptr;
+        }
+        scoped_refptr<VideoDecoderPluginInterop> plugin =
+            scoped_refptr<VideoDecoderPluginInterop>(
+                new RefCountedObject<VideoDecoderPluginInterop>(
+                    callbacks_, implementation_name_));
+        rtcVideoCodecFormat interop_format = ToInteropFormat(format);
+        rtcObjectHandle codec = callbacks_.Create(
+            callbacks_.UserData, &interop_format,
+            static_cast<rtcVideoDecoderPluginHandle>(plugin.get()));
+        if (!codec) {
+            return nullptr;
+        }
+        plugin->set_codec(codec);
+        return plugin;
+    }
+
+private:
+    const rtcVideoDecoderPluginFactoryCallbacks callbacks_;
+    const string implementation_name_;
+}; // end class VideoDecoderPluginFactoryInterop
+
+/*
+ * ----------------------------------------------------------------------
+ * RTCPeerConnectionFactory interop methods
+ * ----------------------------------------------------------------------
+ */
+
+rtcBool32 LIB_WEBRTC_CALL
+RTCPeerConnectionFactory_InitializeWithOptions(
+    rtcPeerConnectionFactoryHandle factory,
+    rtcBool32 use_dummy_audio,
+    const rtcVideoEncoderPluginFactoryCallbacks* encoder_callbacks,
+    const rtcVideoDecoderPluginFactoryCallbacks* decoder_callbacks
+) noexcept
+{
+    CHECK_POINTER_EX(factory, rtcBool32::kFalse);
+
+    RTCPeerConnectionFactoryOptions options;
+    options.use_dummy_audio = use_dummy_audio != rtcBool32::kFalse;
+    if (encoder_callbacks) {
+        options.video_encoder_factory =
+            scoped_refptr<RTCVideoEncoderPluginFactory>(
+                new RefCountedObject<VideoEncoderPluginFactoryInterop>(
+                    *encoder_callbacks));
+    }
+    if (decoder_callbacks) {
+        options.video_decoder_factory =
+            scoped_refptr<RTCVideoDecoderPluginFactory>(
+                new RefCountedObject<VideoDecoderPluginFactoryInterop>(
+                    *decoder_callbacks));
+    }
+
+    scoped_refptr<RTCPeerConnectionFactory> pFactory = static_cast<RTCPeerConnectionFactory*>(factory);
+    return pFactory->InitializeWithOptions(options)
+        ? rtcBool32::kTrue
+        : rtcBool32::kFalse;
+} // end RTCPeerConnectionFactory_InitializeWithOptions
+
+/*
+ * ----------------------------------------------------------------------
+ * RTCVideoEncoderPlugin / RTCVideoDecoderPlugin interop methods
+ * ----------------------------------------------------------------------
+ */
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoEncoderPlugin_DeliverEncodedImage(
+    rtcVideoEncoderPluginHandle plugin,
+    const rtcEncodedVideoImage* image
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(plugin);
+    CHECK_POINTER(image);
+    if (!image->data || image->size <= 0) {
+        return rtcResultU4::kInvalidParameter;
+    }
+
+    RTCEncodedVideoImage native_image;
+    native_image.data = image->data;
+    native_image.size = static_cast<size_t>(image->size);
+    native_image.width = image->width;
+    native_image.height = image->height;
+    native_image.rtp_timestamp = static_cast<uint32_t>(image->rtp_timestamp);
+    native_image.capture_time_ms = static_cast<int64_t>(image->capture_time_ms);
+    native_image.key_frame = image->key_frame != rtcBool32::kFalse;
+    native_image.qp = image->qp;
+
+    VideoEncoderPluginInterop* p = static_cast<VideoEncoderPluginInterop*>(plugin);
+    p->Deliver(native_image);
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoDecoderPlugin_DeliverDecodedFrame(
+    rtcVideoDecoderPluginHandle plugin,
+    rtcVideoFrameHandle frame,
+    unsigned int rtp_timestamp
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(plugin);
+    CHECK_POINTER_EX(frame, rtcResultU4::kInvalidParameter);
+
+    scoped_refptr<RTCVideoFrame> pFrame = static_cast<RTCVideoFrame*>(frame);
+    VideoDecoderPluginInterop* p = static_cast<VideoDecoderPluginInterop*>(plugin);
+    p->Deliver(pFrame, static_cast<uint32_t>(rtp_timestamp));
+    return rtcResultU4::kSuccess;
+}
@@ -21,7 +21,7 @@ RTCVideoDevice_NumberOfDevices(
 ) noexcept
 {
     CHECK_POINTER_EX(videoDevice, 0);
-    scoped_refptr<RTCVideoDevice> pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
+    RTCVideoDevice* pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
     return (int)pVideoDevice->NumberOfDevices();
 }
 
@@ -42,7 +42,7 @@ RTCVideoDevice_GetDeviceName(
     ZERO_MEMORY(pOutDeviceUniqueIdUTF8, cchOutDeviceUniqueIdUTF8);
     ZERO_MEMORY(pOutProductUniqueIdUTF8, cchOutProductUniqueIdUTF8);
 
-    scoped_refptr<RTCVideoDevice> pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
+    RTCVideoDevice* pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
     rtcResultU4 result = static_cast<rtcResultU4>(pVideoDevice->GetDeviceName(
         static_cast<uint32_t>(index),
         pOutDeviceNameUTF8, static_cast<uint32_t>(cchOutDeviceNameUTF8),
@@ -64,7 +64,7 @@ RTCVideoDevice_CreateVideoCapturer(
 ) noexcept
 {
     CHECK_NATIVE_HANDLE(videoDevice);
-    scoped_refptr<RTCVideoDevice> pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
+    RTCVideoDevice* pVideoDevice = static_cast<RTCVideoDevice*>(videoDevice);
     scoped_refptr<RTCVideoCapturer> pVideoCapturer = pVideoDevice->Create(
         name,
         static_cast<uint32_t>(index),
@@ -91,7 +91,7 @@ RTCVideoCapturer_StartCapture(
 ) noexcept
 {
     CHECK_POINTER_EX(videoCapturer, rtcBool32::kFalse);
-    scoped_refptr<RTCVideoCapturer> pVideoCapturer = static_cast<RTCVideoCapturer*>(videoCapturer);
+    RTCVideoCapturer* pVideoCapturer = static_cast<RTCVideoCapturer*>(videoCapturer);
     return pVideoCapturer->StartCapture()
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
@@ -103,7 +103,7 @@ RTCVideoCapturer_CaptureStarted(
 ) noexcept
 {
     CHECK_POINTER_EX(videoCapturer, rtcBool32::kFalse);
-    scoped_refptr<RTCVideoCapturer> pVideoCapturer = static_cast<RTCVideoCapturer*>(videoCapturer);
+    RTCVideoCapturer* pVideoCapturer = static_cast<RTCVideoCapturer*>(videoCapturer);
     return pVideoCapturer->CaptureStarted()
         ? rtcBool32::kTrue
         : rtcBool32::kFalse;
@@ -116,7 +116,7 @@ RTCVideoFrame_Copy(
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(videoFrame);
 
-    scoped_refptr<RTCVideoFrame> pvf = static_cast<RTCVideoFrame*>(videoFrame);
+    RTCVideoFrame* pvf = static_cast<RTCVideoFrame*>(videoFrame);
     scoped_refptr<RTCVideoFrame> pvfCopy = pvf->Copy();
     CHECK_POINTER_EX(pvfCopy, rtcResultU4::kUnknownError);
     *pOutRetVal = static_cast<rtcVideoFrameHandle>(pvfCopy.release());
@@ -159,7 +159,7 @@ RTCVideoFrame_GetDataY(
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCVideoFrame> p = static_cast<RTCVideoFrame*>(handle);
+    RTCVideoFrame* p = static_cast<RTCVideoFrame*>(handle);
     *pOutRetVal = static_cast<const unsigned char*>(p->DataY());
     return rtcResultU4::kSuccess;
 }
@@ -173,7 +173,7 @@ RTCVideoFrame_GetDataU(
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCVideoFrame> p = static_cast<RTCVideoFrame*>(handle);
+    RTCVideoFrame* p = static_cast<RTCVideoFrame*>(handle);
     *pOutRetVal = static_cast<const unsigned char*>(p->DataU());
     return rtcResultU4::kSuccess;
 }
@@ -187,7 +187,7 @@ RTCVideoFrame_GetDataV(
     CHECK_OUT_POINTER(pOutRetVal);
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCVideoFrame> p = static_cast<RTCVideoFrame*>(handle);
+    RTCVideoFrame* p = static_cast<RTCVideoFrame*>(handle);
     *pOutRetVal = static_cast<const unsigned char*>(p->DataV());
     return rtcResultU4::kSuccess;
 }
@@ -235,11 +235,36 @@ RTCVideoFrame_GetTimestampInMicroseconds(
 {
     CHECK_POINTER_EX(videoFrame, static_cast<rtcTimestamp>(0LL));
 
-    scoped_refptr<RTCVideoFrame> pvf = static_cast<RTCVideoFrame*>(videoFrame);
+    RTCVideoFrame* pvf = static_cast<RTCVideoFrame*>(videoFrame);
     rtcTimestamp retVal = static_cast<rtcTimestamp>(pvf->timestamp_us());
     return retVal;
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrame_GetInfo(
+    rtcVideoFrameHandle videoFrame,
+    rtcVideoFrameInfo* pOutInfo
+) noexcept
+{
+    CHECK_POINTER(pOutInfo);
+    *pOutInfo = rtcVideoFrameInfo();
+    CHECK_NATIVE_HANDLE(videoFrame);
+
+    RTCVideoFrame* pvf = static_cast<RTCVideoFrame*>(videoFrame);
+    pOutInfo->width = pvf->width();
+    pOutInfo->height = pvf->height();
+    pOutInfo->size = pvf->size();
+    pOutInfo->rotation = static_cast<rtcVideoRotation>(pvf->rotation());
+    pOutInfo->timestamp_us = static_cast<rtcTimestamp>(pvf->timestamp_us());
+    pOutInfo->data_y = pvf->DataY();
+    pOutInfo->data_u = pvf->DataU();
+    pOutInfo->data_v = pvf->DataV();
+    pOutInfo->stride_y = pvf->StrideY();
+    pOutInfo->stride_u = pvf->StrideU();
+    pOutInfo->stride_v = pvf->StrideV();
+    return rtcResultU4::kSuccess;
+}
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCVideoFrame_SetTimestampInMicroseconds(
     rtcVideoFrameHandle videoFrame,
@@ -265,7 +290,7 @@ RTCVideoFrame_ConvertToARGB(
         return 0;
     }
 
-    scoped_refptr<RTCVideoFrame> pvf = static_cast<RTCVideoFrame*>(videoFrame);
+    RTCVideoFrame* pvf = static_cast<RTCVideoFrame*>(videoFrame);
     return pvf->ConvertToARGB(
         reinterpret_cast<rtcVideoFrameARGB*>(dest)
     );
@@ -281,8 +306,8 @@ RTCVideoFrame_ScaleFrom(
     CHECK_NATIVE_HANDLE(dest);
     CHECK_NATIVE_HANDLE(source);
 
-    scoped_refptr<RTCVideoFrame> pDst = static_cast<RTCVideoFrame*>(dest);
-    scoped_refptr<RTCVideoFrame> pSrc = static_cast<RTCVideoFrame*>(source);
+    RTCVideoFrame* pDst = static_cast<RTCVideoFrame*>(dest);
+    RTCVideoFrame* pSrc = static_cast<RTCVideoFrame*>(source);
     int buffer_size = pDst->ScaleFrom(pSrc);
     if (pOutRetVal) {
         *pOutRetVal = buffer_size;
@@ -319,7 +344,7 @@ RTCVideoFrame_ScaleFromARGB(
         return rtcResultU4::kInvalidParameter;
     }
     
-    scoped_refptr<RTCVideoFrame> pDst = static_cast<RTCVideoFrame*>(dest);
+    RTCVideoFrame* pDst = static_cast<RTCVideoFrame*>(dest);
     int buffer_size = pDst->ScaleFrom(reinterpret_cast<RTCVideoFrameARGB*>(source));
     if (pOutRetVal) {
         *pOutRetVal = buffer_size;
@@ -358,7 +383,7 @@ RTCVideoFrame_ScaleFromYUV(
         return rtcResultU4::kInvalidParameter;
     }
     
-    scoped_refptr<RTCVideoFrame> pDst = static_cast<RTCVideoFrame*>(dest);
+    RTCVideoFrame* pDst = static_cast<RTCVideoFrame*>(dest);
     int buffer_size = pDst->ScaleFrom(reinterpret_cast<RTCVideoFrameYUV*>(source));
     if (pOutRetVal) {
         *pOutRetVal = buffer_size;
@@ -378,7 +403,7 @@ RTCVideoFrame_Clear(
     }
     CHECK_NATIVE_HANDLE(handle);
 
-    scoped_refptr<RTCVideoFrame> p = static_cast<RTCVideoFrame*>(handle);
+    RTCVideoFrame* p = static_cast<RTCVideoFrame*>(handle);
     int result = p->Clear(static_cast<RTCVideoFrameClearType>(clearType));
     if (pRetVal) {
         *pRetVal = result;
@@ -6,10 +6,14 @@
 
 #include "rtc_video_renderer.h"
 #include "rtc_video_frame.h"
+#include "rtc_video_frame_export.h"
 #include "interop_api.h"
 
+#include <vector>
+
 using namespace libwebrtc;
 
+
 rtcResultU4 LIB_WEBRTC_CALL
 RTCVideoRenderer_Create(
     rtcVideoRendererHandle* pOutRetVal
@@ -54,6 +58,93 @@ RTCVideoRenderer_UnRegisterFrameCallback(
     return rtcResultU4::kSuccess;
 }
 
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_SetLatencyMeasurement(
+    rtcVideoRendererHandle videoRenderer,
+    rtcBool32 enable
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(videoRenderer);
+
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* p =
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
+    p->SetLatencyMeasurement(enable != rtcBool32::kFalse);
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_GetLatencyStats(
+    rtcVideoRendererHandle videoRenderer,
+    rtcVideoLatencyStats* stats,
+    rtcBool32* pOutRetVal
+) noexcept
+{
+    CHECK_POINTER(pOutRetVal);
+    *pOutRetVal = rtcBool32::kFalse;
+    CHECK_NATIVE_HANDLE(videoRenderer);
+    CHECK_POINTER_EX(stats, rtcResultU4::kInvalidParameter);
+
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* p =
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
+    RTCVideoLatencyStats native;
+    if (!p->GetLatencyStats(&native)) {
+        return rtcResultU4::kSuccess;
+    }
+    stats->frames_rendered = native.frames_rendered;
+    stats->frames_marked = native.frames_marked;
+    stats->frames_lost = native.frames_lost;
+    stats->freeze_count = native.freeze_count;
+    stats->total_freeze_ms = native.total_freeze_ms;
+    stats->latency_last_ms = native.latency_last_ms;
+    stats->latency_min_ms = native.latency_min_ms;
+    stats->latency_mean_ms = native.latency_mean_ms;
+    stats->latency_max_ms = native.latency_max_ms;
+    stats->latency_p50_ms = native.latency_p50_ms;
+    stats->latency_p95_ms = native.latency_p95_ms;
+    stats->latency_p99_ms = native.latency_p99_ms;
+    *pOutRetVal = rtcBool32::kTrue;
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_GetFrameLatencies(
+    rtcVideoRendererHandle videoRenderer,
+    long long* latencies,
+    int max_frames,
+    int* pOutRetVal
+) noexcept
+{
+    CHECK_POINTER(pOutRetVal);
+    *pOutRetVal = 0;
+    CHECK_NATIVE_HANDLE(videoRenderer);
+
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* p =
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
+    if (latencies == nullptr || max_frames <= 0) {
+        return rtcResultU4::kSuccess;
+    }
+    std::vector<int64_t> native(max_frames);
+    int count = p->GetFrameLatencies(native.data(), max_frames);
+    for (int i = 0; i < count; i++) {
+        latencies[i] = native[i];
+    }
+    *pOutRetVal = count;
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoRenderer_ResetLatencyStats(
+    rtcVideoRendererHandle videoRenderer
+) noexcept
+{
+    CHECK_NATIVE_HANDLE(videoRenderer);
+
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* p =
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
+    p->ResetLatencyStats();
+    return rtcResultU4::kSuccess;
+}
+
 #if defined(DEBUG) || defined(_DEBUG)
 rtcResultU4 LIB_WEBRTC_CALL
 RTCVideoRenderer_FireOnFrame(
@@ -66,8 +157,69 @@ RTCVideoRenderer_FireOnFrame(
 
     scoped_refptr<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>> vr =
         static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
-    scoped_refptr<RTCVideoFrame> vf = static_cast<RTCVideoFrame*>(videoFrame);
+    RTCVideoFrame* vf = static_cast<RTCVideoFrame*>(videoFrame);
     vr->OnFrame(vf);
     return rtcResultU4::kSuccess;
 }
 #endif // DEBUG or _DEBUG
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_Create(
+    const char* name,
+    rtcVideoFrameExportFormat format,
+    int max_width,
+    int max_height,
+    int slot_count,
+    rtcVideoFrameExportHandle* pOutRetVal
+) noexcept
+{
+    CHECK_OUT_POINTER(pOutRetVal);
+    CHECK_POINTER_EX(name, rtcResultU4::kInvalidParameter);
+
+    RTCVideoFrameExportConfig config;
+    config.name = string(name);
+    config.format = format;
+    config.max_width = max_width;
+    config.max_height = max_height;
+    config.slot_count = slot_count;
+    scoped_refptr<RTCVideoFrameExport> p = RTCVideoFrameExport::Create(config);
+    if (p == nullptr) {
+        return rtcResultU4::kInvalidParameter;
+    }
+    // Handed out as a renderer, so the handle works with the renderer API.
+    RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* renderer = p.release();
+    *pOutRetVal = static_cast<rtcVideoFrameExportHandle>(renderer);
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_GetMappingSize(
+    rtcVideoFrameExportHandle handle,
+    unsigned long long* pOutRetVal
+) noexcept
+{
+    CHECK_POINTER(pOutRetVal);
+    *pOutRetVal = 0;
+    CHECK_NATIVE_HANDLE(handle);
+
+    RTCVideoFrameExport* p = static_cast<RTCVideoFrameExport*>(
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(handle));
+    *pOutRetVal = static_cast<unsigned long long>(p->mapping_size());
+    return rtcResultU4::kSuccess;
+}
+
+rtcResultU4 LIB_WEBRTC_CALL
+RTCVideoFrameExport_GetFramesWritten(
+    rtcVideoFrameExportHandle handle,
+    unsigned long long* pOutRetVal
+) noexcept
+{
+    CHECK_POINTER(pOutRetVal);
+    *pOutRetVal = 0;
+    CHECK_NATIVE_HANDLE(handle);
+
+    RTCVideoFrameExport* p = static_cast<RTCVideoFrameExport*>(
+        static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(handle));
+    *pOutRetVal = static_cast<unsigned long long>(p->frames_written());
+    return rtcResultU4::kSuccess;
+}
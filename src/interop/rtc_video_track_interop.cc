@@ -20,7 +20,7 @@ RTCVideoTrack_AddRenderer(
     CHECK_NATIVE_HANDLE(videoTrack);
     CHECK_NATIVE_HANDLE(videoRenderer);
 
-    scoped_refptr<RTCVideoTrack> pVideoTrack = static_cast<RTCVideoTrack*>(videoTrack);
+    RTCVideoTrack* pVideoTrack = static_cast<RTCVideoTrack*>(videoTrack);
     RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>* pVideoRenderer =
         static_cast<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>*>(videoRenderer);
     pVideoTrack->AddRenderer(pVideoRenderer);
@@ -4,6 +4,7 @@
 #include "rtc_base/ssl_adapter.h"
 #include "rtc_base/thread.h"
 #include "rtc_peerconnection_factory_impl.h"
+#include "src/internal/parallel_convert.h"
 
 namespace libwebrtc {
 
@@ -23,11 +24,17 @@ bool LibWebRTC::Initialize() {
 void LibWebRTC::Terminate() {
   rtc::ThreadManager::Instance()->SetCurrentThread(NULL);
   rtc::CleanupSSL();
+  libwebrtc::SetParallelConversion(1, kParallelConversionMinPixels);
 
   // Resets the static variable g_is_initialized to false.
   g_is_initialized = false;
 }
 
+// Configures the worker pool of the frame conversions.
+void LibWebRTC::SetParallelConversion(int threads, int min_pixels) {
+  libwebrtc::SetParallelConversion(threads, min_pixels);
+}
+
 // Creates and returns an instance of RTCPeerConnectionFactory.
 scoped_refptr<RTCPeerConnectionFactory>
 LibWebRTC::CreateRTCPeerConnectionFactory(bool use_dummy_audio /*= false*/) {
@@ -38,4 +45,15 @@ LibWebRTC::CreateRTCPeerConnectionFactory(bool use_dummy_audio /*= false*/) {
   return rtc_peerconnection_factory;
 }
 
+// Creates and returns an instance of RTCPeerConnectionFactory with options.
+scoped_refptr<RTCPeerConnectionFactory>
+LibWebRTC::CreateRTCPeerConnectionFactory(
+    const RTCPeerConnectionFactoryOptions& options) {
+  scoped_refptr<RTCPeerConnectionFactory> rtc_peerconnection_factory =
+      scoped_refptr<RTCPeerConnectionFactory>(
+          new RefCountedObject<RTCPeerConnectionFactoryImpl>());
+  rtc_peerconnection_factory->InitializeWithOptions(options);
+  return rtc_peerconnection_factory;
+}
+
 }  // namespace libwebrtc
@@ -25,7 +25,7 @@ scoped_refptr<RTCAudioData> RTCAudioData::Create(
 ) {
     scoped_refptr<RTCAudioData> audio_data =
         scoped_refptr<RTCAudioData>(
-            new RefCountedObject<RTCAudioDataImpl>(
+            new RTCAudioDataImpl(
                 index,
                 data,
                 bits_per_sample,
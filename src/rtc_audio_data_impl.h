@@ -10,12 +10,13 @@
 #include <stdint.h>
 #include <memory>
 
+#include "base/refcountedobject.h"
 #include "rtc_base/memory/aligned_malloc.h"
 #include "rtc_audio_data.h"
 
 namespace libwebrtc {
 
-class RTCAudioDataImpl : public RTCAudioData {
+class RTCAudioDataImpl final : public RefCountedFinal<RTCAudioData> {
  public:
   RTCAudioDataImpl(
     uint32_t index,
@@ -38,6 +38,8 @@ class RTCDataChannelImpl : public RTCDataChannel,
 
   virtual const string label() const override;
 
+  virtual string_view label_view() const override { return label_; }
+
   virtual int id() const override;
 
   virtual RTCDataChannelState state() override;
@@ -16,8 +16,12 @@
 
 #include "rtc_desktop_capturer_impl.h"
 
+#include <algorithm>
+
 #include "api/sequence_checker.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/ref_counted_object.h"
+#include "src/internal/parallel_convert.h"
 #include "third_party/libyuv/include/libyuv.h"
 #ifdef WEBRTC_WIN
 #include "modules/desktop_capture/win/window_capture_utils.h"
@@ -89,10 +93,11 @@ void DesktopCapturerObserverImpl::OnError(scoped_refptr<RTCDesktopCapturer> capt
 
 RTCDesktopCapturerImpl::RTCDesktopCapturerImpl(
     DesktopType type, webrtc::DesktopCapturer::SourceId source_id,
-    rtc::Thread* signaling_thread, scoped_refptr<MediaSource> source)
+    rtc::Thread* observer_thread, scoped_refptr<MediaSource> source)
     : thread_(rtc::Thread::Create()),
       source_id_(source_id),
-      signaling_thread_(signaling_thread),
+      dispatcher_(
+          new rtc::RefCountedObject<ObserverDispatcher>(observer_thread)),
       source_(source) {
   RTC_DCHECK(thread_);
   type_ = type;
@@ -119,6 +124,7 @@ RTCDesktopCapturerImpl::RTCDesktopCapturerImpl(
 }
 
 RTCDesktopCapturerImpl::~RTCDesktopCapturerImpl() {
+  dispatcher_->Detach();
   thread_->Stop();
   capturer_.reset();
 }
@@ -167,27 +173,21 @@ RTCCaptureState RTCDesktopCapturerImpl::Start(
   }
 
   thread_->BlockingCall([this] { capturer_->Start(this); });
+  // The capture thread posts events that hold a reference; the caller holds
+  // one now, and this one keeps the capturer alive until Stop().
+  running_ref_ = scoped_refptr<RTCDesktopCapturer>(this);
   capture_state_ = RTCCaptureState::CS_RUNNING;
   thread_->PostTask([this] { CaptureFrame(); });
-  if (observer_) {
-    signaling_thread_->BlockingCall([&, this]() { 
-      if (observer_) { observer_->OnStart(this); }
-    });
-  }
+  PostEvent(&DesktopCapturerObserver::OnStart);
   return capture_state_;
 }
 
 void RTCDesktopCapturerImpl::Stop() {
-  if (observer_) {
-    if (!signaling_thread_->IsCurrent()) {
-      signaling_thread_->BlockingCall([&, this]() { 
-        if (observer_) { observer_->OnStop(this); }
-      });
-    } else {
-      observer_->OnStop(this);
-    }
-  }
-  capture_state_ = RTCCaptureState::CS_STOPPED;
+  // Ends the capture loop before the reference it relies on is dropped.
+  thread_->BlockingCall(
+      [this] { capture_state_ = RTCCaptureState::CS_STOPPED; });
+  PostEvent(&DesktopCapturerObserver::OnStop);
+  running_ref_ = nullptr;
 }
 
 bool RTCDesktopCapturerImpl::IsRunning() {
@@ -205,32 +205,20 @@ void RTCDesktopCapturerImpl::OnCaptureResult(
     std::unique_ptr<webrtc::DesktopFrame> frame) {
   if (result != result_) {
     if (result == webrtc::DesktopCapturer::Result::ERROR_PERMANENT) {
-      if (observer_) {
-        signaling_thread_->BlockingCall([&, this]() {
-          if (observer_) { observer_->OnError(this); }
-        });
-      }
+      PostEvent(&DesktopCapturerObserver::OnError);
       capture_state_ = RTCCaptureState::CS_FAILED;
       return;
     }
 
     if (result == webrtc::DesktopCapturer::Result::ERROR_TEMPORARY) {
       result_ = result;
-      if (observer_) {
-        signaling_thread_->BlockingCall([&, this]() {
-          if (observer_) { observer_->OnPaused(this); }
-        });
-      }
+      PostEvent(&DesktopCapturerObserver::OnPaused);
       return;
     }
 
     if (result == webrtc::DesktopCapturer::Result::SUCCESS) {
       result_ = result;
-      if (observer_) {
-        signaling_thread_->BlockingCall([&, this]() {
-          if (observer_) { observer_->OnStart(this); }
-        });
-      }
+      PostEvent(&DesktopCapturerObserver::OnStart);
     }
   }
 
@@ -252,24 +240,107 @@ void RTCDesktopCapturerImpl::OnCaptureResult(
   {
     width = w_ > 0 ? w_ : width;
     height = h_ > 0 ? h_ : height;
-    if (!i420_buffer_ || !i420_buffer_.get() ||
-        i420_buffer_->width() * i420_buffer_->height() != width * height) {
-      i420_buffer_ = webrtc::I420Buffer::Create(width, height);
-    }
-
-    libyuv::ConvertToI420(frame->data(), 0, i420_buffer_->MutableDataY(),
-                          i420_buffer_->StrideY(), i420_buffer_->MutableDataU(),
-                          i420_buffer_->StrideU(), i420_buffer_->MutableDataV(),
-                          i420_buffer_->StrideV(), x_, y_,
 #ifdef WEBRTC_WIN
-                          rect_.width(), rect_.height(),
+    const int src_width = rect_.width();
 #else
-                          width, height,
+    const int src_width = width;
 #endif
-                          width, height, libyuv::kRotate0, libyuv::FOURCC_ARGB);
+    const int src_stride = src_width * 4;
+    const uint8_t* src =
+        frame->data() + (static_cast<size_t>(src_width) * y_ + x_) * 4;
+    const int64_t now_ms = rtc::TimeMillis();
+
+    // Only the updated region is converted, on top of a copy of the last
+    // frame, while the capture geometry is unchanged.
+    bool full = !i420_buffer_ || i420_buffer_->width() != width ||
+                i420_buffer_->height() != height ||
+                !frame->size().equals(last_frame_size_) ||
+                !last_origin_.equals(webrtc::DesktopVector(x_, y_));
+    webrtc::DesktopRegion damage;
+    if (!full) {
+      const webrtc::DesktopRect crop =
+          webrtc::DesktopRect::MakeXYWH(x_, y_, width, height);
+      for (webrtc::DesktopRegion::Iterator it(frame->updated_region());
+           !it.IsAtEnd(); it.Advance()) {
+        webrtc::DesktopRect rect = it.rect();
+        rect.IntersectWith(crop);
+        if (rect.is_empty()) {
+          continue;
+        }
+        rect.Translate(-static_cast<int>(x_), -static_cast<int>(y_));
+        // Chroma is subsampled 2x2, so round out to even coordinates.
+        damage.AddRect(webrtc::DesktopRect::MakeLTRB(
+            rect.left() & ~1, rect.top() & ~1,
+            std::min(width, (rect.right() + 1) & ~1),
+            std::min(height, (rect.bottom() + 1) & ~1)));
+      }
+      if (damage.is_empty()) {
+        // Nothing changed: repeat the last frame now and then, without
+        // converting or copying it, so the encoder can refine it.
+        if (now_ms - last_frame_ms_ >= kRepeatFrameIntervalMs) {
+          last_frame_ms_ = now_ms;
+          OnFrame(webrtc::VideoFrame::Builder()
+                      .set_video_frame_buffer(i420_buffer_)
+                      .set_timestamp_ms(now_ms)
+                      .set_rotation(webrtc::kVideoRotation_0)
+                      .set_update_rect(webrtc::VideoFrame::UpdateRect{0, 0,
+                                                                      0, 0})
+                      .build());
+        }
+        return;
+      }
+    }
 
-    OnFrame(webrtc::VideoFrame(i420_buffer_, 0, rtc::TimeMillis(),
-                               webrtc::kVideoRotation_0));
+    // The last frame may still be in the encoder, so write a pooled one.
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+        buffer_pool_.CreateI420Buffer(width, height);
+    if (!buffer) {
+      return;  // Every buffer is still queued downstream; drop the frame.
+    }
+
+    webrtc::VideoFrame::UpdateRect update_rect{0, 0, width, height};
+    if (full) {
+      ParallelARGBToI420(RTCVideoFrameTypeARGB::kARGB, src, src_stride,
+                         buffer.get());
+    } else {
+      libyuv::I420Copy(i420_buffer_->DataY(), i420_buffer_->StrideY(),
+                       i420_buffer_->DataU(), i420_buffer_->StrideU(),
+                       i420_buffer_->DataV(), i420_buffer_->StrideV(),
+                       buffer->MutableDataY(), buffer->StrideY(),
+                       buffer->MutableDataU(), buffer->StrideU(),
+                       buffer->MutableDataV(), buffer->StrideV(), width,
+                       height);
+      webrtc::DesktopRect bounds;
+      for (webrtc::DesktopRegion::Iterator it(damage); !it.IsAtEnd();
+           it.Advance()) {
+        const webrtc::DesktopRect& rect = it.rect();
+        libyuv::ARGBToI420(
+            src + rect.top() * src_stride + rect.left() * 4, src_stride,
+            buffer->MutableDataY() + rect.top() * buffer->StrideY() +
+                rect.left(),
+            buffer->StrideY(),
+            buffer->MutableDataU() + rect.top() / 2 * buffer->StrideU() +
+                rect.left() / 2,
+            buffer->StrideU(),
+            buffer->MutableDataV() + rect.top() / 2 * buffer->StrideV() +
+                rect.left() / 2,
+            buffer->StrideV(), rect.width(), rect.height());
+        bounds.UnionWith(rect);
+      }
+      update_rect = {bounds.left(), bounds.top(), bounds.width(),
+                     bounds.height()};
+    }
+
+    i420_buffer_ = buffer;
+    last_frame_size_ = frame->size();
+    last_origin_.set(x_, y_);
+    last_frame_ms_ = now_ms;
+    OnFrame(webrtc::VideoFrame::Builder()
+                .set_video_frame_buffer(buffer)
+                .set_timestamp_ms(now_ms)
+                .set_rotation(webrtc::kVideoRotation_0)
+                .set_update_rect(update_rect)
+                .build());
   }
 #ifdef WEBRTC_WIN
   __except (filterException(GetExceptionCode(), GetExceptionInformation())) {
@@ -277,6 +348,21 @@ void RTCDesktopCapturerImpl::OnCaptureResult(
 #endif
 }
 
+void RTCDesktopCapturerImpl::PostEvent(
+    void (DesktopCapturerObserver::*event)(scoped_refptr<RTCDesktopCapturer>)) {
+  if (!observer_) {
+    return;
+  }
+  // The event carries its own reference: it may run after the caller's
+  // last one is gone, and the capturer must not be revived from |this|.
+  scoped_refptr<RTCDesktopCapturer> self(this);
+  dispatcher_->Post([this, self, event] {
+    if (observer_) {
+      (observer_->*event)(self);
+    }
+  });
+}
+
 void RTCDesktopCapturerImpl::CaptureFrame() {
   RTC_DCHECK_RUN_ON(thread_.get());
   if (capture_state_ == RTCCaptureState::CS_RUNNING) {
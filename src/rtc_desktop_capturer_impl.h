@@ -19,6 +19,7 @@
 
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame.h"
+#include "common_video/include/video_frame_buffer_pool.h"
 #include "include/rtc_desktop_capturer.h"
 #include "include/rtc_types.h"
 #include "modules/desktop_capture/desktop_and_cursor_composer.h"
@@ -26,6 +27,7 @@
 #include "modules/desktop_capture/desktop_capturer.h"
 #include "modules/desktop_capture/desktop_frame.h"
 #include "rtc_base/thread.h"
+#include "src/internal/observer_dispatcher.h"
 #include "src/internal/vcm_capturer.h"
 #include "src/internal/video_capturer.h"
 
@@ -55,7 +57,7 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
  public:
   RTCDesktopCapturerImpl(DesktopType type,
                          webrtc::DesktopCapturer::SourceId source_id,
-                         rtc::Thread* signaling_thread,
+                         rtc::Thread* observer_thread,
                          scoped_refptr<MediaSource> source);
   ~RTCDesktopCapturerImpl();
 
@@ -84,11 +86,26 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
       std::unique_ptr<webrtc::DesktopFrame> frame) override;
 
  private:
+  // Interval of the repeated frames sent while the screen does not change.
+  static const int64_t kRepeatFrameIntervalMs = 500;
+  // Frames that may be waiting downstream before a capture is dropped.
+  static const size_t kMaxQueuedFrames = 4;
+
   void CaptureFrame();
+  // Posts |event| to the observer with a reference to this capturer. Only
+  // called while a reference is held: by the caller of Start() and Stop(),
+  // or by |running_ref_| on the capture thread.
+  void PostEvent(void (DesktopCapturerObserver::*event)(
+      scoped_refptr<RTCDesktopCapturer>));
   webrtc::DesktopCaptureOptions options_;
   std::unique_ptr<webrtc::DesktopCapturer> capturer_;
   std::unique_ptr<rtc::Thread> thread_;
+  // Last frame handed to the sinks, and the capture geometry it came from.
   rtc::scoped_refptr<webrtc::I420Buffer> i420_buffer_;
+  webrtc::DesktopSize last_frame_size_;
+  webrtc::DesktopVector last_origin_;
+  int64_t last_frame_ms_ = 0;
+  webrtc::VideoFrameBufferPool buffer_pool_{false, kMaxQueuedFrames};
   RTCCaptureState capture_state_ = RTCCaptureState::CS_STOPPED;
   DesktopType type_;
   webrtc::DesktopCapturer::SourceId source_id_;
@@ -96,7 +113,9 @@ class RTCDesktopCapturerImpl : public RTCDesktopCapturer,
   uint32_t capture_delay_ = 1000;  // 1s
   webrtc::DesktopCapturer::Result result_ =
       webrtc::DesktopCapturer::Result::SUCCESS;
-  rtc::Thread* signaling_thread_ = nullptr;
+  rtc::scoped_refptr<ObserverDispatcher> dispatcher_;
+  // Set from Start() until Stop().
+  scoped_refptr<RTCDesktopCapturer> running_ref_;
   scoped_refptr<MediaSource> source_;
   uint32_t x_ = 0;
   uint32_t y_ = 0;
@@ -7,23 +7,30 @@
 
 namespace libwebrtc {
 
-RTCDesktopDeviceImpl::RTCDesktopDeviceImpl(rtc::Thread* signaling_thread)
-    : signaling_thread_(signaling_thread) {}
+RTCDesktopDeviceImpl::RTCDesktopDeviceImpl(rtc::Thread* observer_thread)
+    : observer_thread_(observer_thread) {}
 
 RTCDesktopDeviceImpl::~RTCDesktopDeviceImpl() {}
 
+void RTCDesktopDeviceImpl::SetObserverThread(rtc::Thread* observer_thread) {
+  observer_thread_ = observer_thread;
+  for (auto& media_list : desktop_media_lists_) {
+    media_list.second->SetObserverThread(observer_thread);
+  }
+}
+
 scoped_refptr<RTCDesktopCapturer> RTCDesktopDeviceImpl::CreateDesktopCapturer(
     scoped_refptr<MediaSource> source) {
   MediaSourceImpl* source_impl = static_cast<MediaSourceImpl*>(source.get());
   return new RefCountedObject<RTCDesktopCapturerImpl>(
-      source_impl->type(), source_impl->source_id(), signaling_thread_, source);
+      source_impl->type(), source_impl->source_id(), observer_thread_, source);
 }
 
 scoped_refptr<RTCDesktopMediaList> RTCDesktopDeviceImpl::GetDesktopMediaList(
     DesktopType type) {
   if (desktop_media_lists_.find(type) == desktop_media_lists_.end()) {
     desktop_media_lists_[type] =
-        new RefCountedObject<RTCDesktopMediaListImpl>(type, signaling_thread_);
+        new RefCountedObject<RTCDesktopMediaListImpl>(type, observer_thread_);
   }
   return desktop_media_lists_[type];
 }
@@ -16,7 +16,7 @@ namespace libwebrtc {
 
 class RTCDesktopDeviceImpl : public RTCDesktopDevice {
  public:
-  RTCDesktopDeviceImpl(rtc::Thread* signaling_thread);
+  RTCDesktopDeviceImpl(rtc::Thread* observer_thread);
   ~RTCDesktopDeviceImpl();
 
   scoped_refptr<RTCDesktopCapturer> CreateDesktopCapturer(
@@ -25,8 +25,12 @@ class RTCDesktopDeviceImpl : public RTCDesktopDevice {
   scoped_refptr<RTCDesktopMediaList> GetDesktopMediaList(
       DesktopType type) override;
 
+  // Thread that calls the observers of the capturers created afterwards and
+  // of the media lists.
+  void SetObserverThread(rtc::Thread* observer_thread);
+
  private:
-  rtc::Thread* signaling_thread_ = nullptr;
+  rtc::Thread* observer_thread_ = nullptr;
   std::map<DesktopType, scoped_refptr<RTCDesktopMediaListImpl>>
       desktop_media_lists_;
 };
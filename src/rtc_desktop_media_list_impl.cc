@@ -17,26 +17,43 @@
 #include "rtc_desktop_media_list_impl.h"
 #include "interop_api.h"
 
+#include "api/sequence_checker.h"
 #include "internal/jpeg_util.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/ref_counted_object.h"
 #include "third_party/libyuv/include/libyuv.h"
 
 #ifdef WEBRTC_WIN
 #include "modules/desktop_capture/win/window_capture_utils.h"
 #endif
 
+#include <string.h>
+
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 namespace libwebrtc {
 
 RTCDesktopMediaListImpl::RTCDesktopMediaListImpl(DesktopType type,
-                                                 rtc::Thread* signaling_thread)
+                                                 rtc::Thread* observer_thread)
     : thread_(rtc::Thread::Create()),
-      type_(type),
-      signaling_thread_(signaling_thread) {
+      dispatcher_(
+          new rtc::RefCountedObject<ObserverDispatcher>(observer_thread)),
+      type_(type) {
   RTC_DCHECK(thread_);
   thread_->Start();
+  const int encode_threads = std::min(
+      kMaxThumbnailThreads,
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2));
+  for (int i = 0; i < encode_threads; i++) {
+    std::unique_ptr<rtc::Thread> thread = rtc::Thread::Create();
+    thread->SetName("thumbnail_encode_thread", nullptr);
+    thread->Start();
+    encode_threads_.push_back(std::move(thread));
+  }
   options_ = webrtc::DesktopCaptureOptions::CreateDefault();
   options_.set_detect_updated_region(true);
 #ifdef WEBRTC_WIN
@@ -58,16 +75,37 @@ RTCDesktopMediaListImpl::RTCDesktopMediaListImpl(DesktopType type,
   });
 }
 
-RTCDesktopMediaListImpl::~RTCDesktopMediaListImpl() { thread_->Stop(); }
+RTCDesktopMediaListImpl::~RTCDesktopMediaListImpl() {
+  dispatcher_->Detach();
+  ++refresh_generation_;
+  thread_->Stop();
+  for (auto& thread : encode_threads_) {
+    thread->Stop();
+  }
+}
+
+void RTCDesktopMediaListImpl::SetObserverThread(rtc::Thread* observer_thread) {
+  dispatcher_->SetThread(observer_thread);
+}
 
 int32_t RTCDesktopMediaListImpl::UpdateSourceList(bool force_reload,
                                                   bool get_thumbnail) {
+  return UpdateSources(force_reload, get_thumbnail, ThumbnailOptions());
+}
+
+int32_t RTCDesktopMediaListImpl::UpdateSourceListWithOptions(
+    bool force_reload, const ThumbnailOptions& options) {
+  return UpdateSources(force_reload, true, options);
+}
+
+int32_t RTCDesktopMediaListImpl::UpdateSources(
+    bool force_reload, bool get_thumbnail, const ThumbnailOptions& options) {
   if (force_reload) {
     for (auto source : sources_) {
       if (observer_) {
-        auto source_ptr = source.get();
-        signaling_thread_->BlockingCall(
-            [&, source_ptr]() { if (observer_) { observer_->OnMediaSourceRemoved(source_ptr); } });
+        dispatcher_->Post([this, source] {
+          if (observer_) { observer_->OnMediaSourceRemoved(source); }
+        });
       }
     }
     sources_.clear();
@@ -89,9 +127,10 @@ int32_t RTCDesktopMediaListImpl::UpdateSourceList(bool force_reload,
   for (size_t i = 0; i < sources_.size(); ++i) {
     if (new_source_set.find(sources_[i]->source_id()) == new_source_set.end()) {
       if (observer_) {
-        auto source = (*(sources_.begin() + i)).get();
-        signaling_thread_->BlockingCall(
-            [&, source]() { if (observer_) { observer_->OnMediaSourceRemoved(source); } });
+        scoped_refptr<MediaSourceImpl> source = sources_[i];
+        dispatcher_->Post([this, source] {
+          if (observer_) { observer_->OnMediaSourceRemoved(source); }
+        });
       }
       sources_.erase(sources_.begin() + i);
       --i;
@@ -105,13 +144,14 @@ int32_t RTCDesktopMediaListImpl::UpdateSourceList(bool force_reload,
     }
     for (size_t i = 0; i < new_sources.size(); ++i) {
       if (old_source_set.find(new_sources[i].id) == old_source_set.end()) {
-        auto source =
+        scoped_refptr<MediaSourceImpl> source =
             new RefCountedObject<MediaSourceImpl>(this, new_sources[i], type_);
         sources_.insert(sources_.begin() + i, source);
-        GetThumbnail(source, true);
+        GetThumbnailWithOptions(source, options, true);
         if (observer_) {
-          signaling_thread_->BlockingCall(
-              [&, source]() { if (observer_) { observer_->OnMediaSourceAdded(source); }});
+          dispatcher_->Post([this, source] {
+            if (observer_) { observer_->OnMediaSourceAdded(source); }
+          });
         }
       }
     }
@@ -141,17 +181,23 @@ int32_t RTCDesktopMediaListImpl::UpdateSourceList(bool force_reload,
     if (sources_[pos]->source.title != new_sources[pos].title) {
       sources_[pos]->source.title = new_sources[pos].title;
       if (observer_) {
-        auto source = sources_[pos].get();
-        signaling_thread_->BlockingCall(
-            [&, source]() { if (observer_) { observer_->OnMediaSourceNameChanged(source); }});
+        scoped_refptr<MediaSourceImpl> source = sources_[pos];
+        dispatcher_->Post([this, source] {
+          if (observer_) { observer_->OnMediaSourceNameChanged(source); }
+        });
       }
     }
     ++pos;
   }
 
+  {
+    webrtc::MutexLock lock(&sources_mutex_);
+    listed_sources_ = sources_;
+  }
+
   if (get_thumbnail) {
     for (auto source : sources_) {
-      GetThumbnail(source.get(), true);
+      GetThumbnailWithOptions(source.get(), options, true);
     }
   }
   return sources_.size();
@@ -159,23 +205,106 @@ int32_t RTCDesktopMediaListImpl::UpdateSourceList(bool force_reload,
 
 bool RTCDesktopMediaListImpl::GetThumbnail(scoped_refptr<MediaSource> source,
                                            bool notify) {
-  thread_->PostTask([this, source, notify] {
-    MediaSourceImpl* source_impl = static_cast<MediaSourceImpl*>(source.get());
-    if (capturer_->SelectSource(source_impl->source_id())) {
-      callback_->SetCallback([&](webrtc::DesktopCapturer::Result result,
-                                 std::unique_ptr<webrtc::DesktopFrame> frame) {
-        auto old_thumbnail = source_impl->thumbnail();
-        source_impl->SaveCaptureResult(result, std::move(frame));
-        if (observer_ && notify) {
-          signaling_thread_->BlockingCall([&, source_impl]() { if (observer_) { observer_->OnMediaSourceThumbnailChanged(source_impl); }});
-        }
-      });
-      capturer_->CaptureFrame();
-    }
+  return GetThumbnailWithOptions(source, ThumbnailOptions(), notify);
+}
+
+bool RTCDesktopMediaListImpl::GetThumbnailWithOptions(
+    scoped_refptr<MediaSource> source, const ThumbnailOptions& options,
+    bool notify) {
+  scoped_refptr<MediaSourceImpl> source_impl =
+      static_cast<MediaSourceImpl*>(source.get());
+  if (!source_impl || !source_impl->BeginRefresh()) {
+    return false;
+  }
+  thread_->PostTask([this, source_impl, options, notify] {
+    CaptureThumbnail(source_impl, options, notify);
   });
   return true;
 }
 
+void RTCDesktopMediaListImpl::StartThumbnailRefresh(
+    int interval_ms, const ThumbnailOptions& options) {
+  int generation = ++refresh_generation_;
+  int interval = std::max(interval_ms, kMinThumbnailRefreshMs);
+  thread_->PostTask([this, generation, interval, options] {
+    RefreshThumbnails(generation, interval, options);
+  });
+}
+
+void RTCDesktopMediaListImpl::StopThumbnailRefresh() {
+  ++refresh_generation_;
+}
+
+void RTCDesktopMediaListImpl::RefreshThumbnails(
+    int generation, int interval_ms, const ThumbnailOptions& options) {
+  RTC_DCHECK_RUN_ON(thread_.get());
+  if (generation != refresh_generation_) {
+    return;
+  }
+
+  std::vector<scoped_refptr<MediaSourceImpl>> sources;
+  {
+    webrtc::MutexLock lock(&sources_mutex_);
+    sources = listed_sources_;
+  }
+  for (auto& source : sources) {
+    // A source whose last thumbnail is still being encoded is skipped.
+    if (source->BeginRefresh()) {
+      CaptureThumbnail(source, options, true);
+    }
+  }
+
+  thread_->PostDelayedHighPrecisionTask(
+      [this, generation, interval_ms, options] {
+        RefreshThumbnails(generation, interval_ms, options);
+      },
+      webrtc::TimeDelta::Millis(interval_ms));
+}
+
+void RTCDesktopMediaListImpl::CaptureThumbnail(
+    scoped_refptr<MediaSourceImpl> source, const ThumbnailOptions& options,
+    bool notify) {
+  RTC_DCHECK_RUN_ON(thread_.get());
+  std::unique_ptr<MediaSourceImpl::ScaledCapture> capture;
+  if (capturer_->SelectSource(source->source_id())) {
+    callback_->SetCallback([&](webrtc::DesktopCapturer::Result result,
+                               std::unique_ptr<webrtc::DesktopFrame> frame) {
+      capture = source->ScaleCapture(result, std::move(frame), options);
+    });
+    capturer_->CaptureFrame();
+    callback_->SetCallback(nullptr);
+  }
+  if (!capture) {
+    source->EndRefresh();
+    return;
+  }
+
+  // Only the capture needs the capturer; encoding runs on the pool. A
+  // source always uses the same encoder thread, so its thumbnails are
+  // saved in capture order.
+  rtc::Thread* encoder =
+      encode_threads_[static_cast<size_t>(source->source_id()) %
+                      encode_threads_.size()]
+          .get();
+  // The dispatcher drops the notification once the list is destroyed, so
+  // the raw |media_list| is only used while the list is alive.
+  rtc::scoped_refptr<ObserverDispatcher> dispatcher = dispatcher_;
+  RTCDesktopMediaListImpl* media_list = this;
+  encoder->PostTask([dispatcher, media_list, source, options, notify,
+                     capture = std::move(capture)] {
+    bool changed = source->SaveThumbnail(*capture, options);
+    source->EndRefresh();
+    if (!changed || !notify) {
+      return;
+    }
+    dispatcher->Post([media_list, source] {
+      if (media_list->GetObserver()) {
+        media_list->GetObserver()->OnMediaSourceThumbnailChanged(source);
+      }
+    });
+  });
+}
+
 int RTCDesktopMediaListImpl::GetSourceCount() const { return sources_.size(); }
 
 scoped_refptr<MediaSource> RTCDesktopMediaListImpl::GetSource(int index) {
@@ -186,69 +315,115 @@ bool MediaSourceImpl::UpdateThumbnail() {
   return mediaList_->GetThumbnail(this);
 }
 
+bool MediaSourceImpl::UpdateThumbnailWithOptions(
+    const ThumbnailOptions& options) {
+  return mediaList_->GetThumbnailWithOptions(this, options);
+}
+
 #ifdef WEBRTC_WIN
 extern int filterException(int code, PEXCEPTION_POINTERS ex);
 #endif
 
-void MediaSourceImpl::SaveCaptureResult(
+std::unique_ptr<MediaSourceImpl::ScaledCapture> MediaSourceImpl::ScaleCapture(
     webrtc::DesktopCapturer::Result result,
-    std::unique_ptr<webrtc::DesktopFrame> frame) {
-  if (result != webrtc::DesktopCapturer::Result::SUCCESS) {
-    return;
+    std::unique_ptr<webrtc::DesktopFrame> frame,
+    const ThumbnailOptions& options) {
+  if (result != webrtc::DesktopCapturer::Result::SUCCESS || !frame) {
+    return nullptr;
   }
 
-  int width = frame->size().width();
-  int height = frame->size().height();
-#ifdef WEBRTC_WIN
-  webrtc::DesktopRect rect_ = webrtc::DesktopRect::MakeWH(width, height);
-
-  if (type_ != kScreen) {
-    webrtc::GetWindowRect(reinterpret_cast<HWND>(source_id()), &rect_);
+  const int width = frame->size().width();
+  const int height = frame->size().height();
+  std::unique_ptr<ScaledCapture> capture(new ScaledCapture());
+  capture->width = width;
+  capture->height = height;
+  if (options.max_width > 0 && options.max_height > 0 &&
+      (width > options.max_width || height > options.max_height)) {
+    double scale = std::min(static_cast<double>(options.max_width) / width,
+                            static_cast<double>(options.max_height) / height);
+    capture->width = std::max(1, static_cast<int>(width * scale));
+    capture->height = std::max(1, static_cast<int>(height * scale));
   }
+  capture->pixels.resize(static_cast<size_t>(capture->width) * 4 *
+                         capture->height);
 
+  int scaled = -1;
+#ifdef WEBRTC_WIN
   __try
 #endif
   {
-
-    if (!i420_buffer_ || !i420_buffer_.get() ||
-        i420_buffer_->width() * i420_buffer_->height() != width * height) {
-      i420_buffer_ = webrtc::I420Buffer::Create(width, height);
-    }
-
-    libyuv::ConvertToI420(frame->data(), 0, i420_buffer_->MutableDataY(),
-                          i420_buffer_->StrideY(), i420_buffer_->MutableDataU(),
-                          i420_buffer_->StrideU(), i420_buffer_->MutableDataV(),
-                          i420_buffer_->StrideV(), 0, 0,
+    // Scale the BGRA capture first, so that hashing, conversion and the
+    // encoder only see thumbnail-sized pixels.
+    scaled = libyuv::ARGBScale(frame->data(), frame->stride(), width, height,
+                               capture->pixels.data(), capture->width * 4,
+                               capture->width, capture->height,
+                               libyuv::kFilterBox);
+  }
 #ifdef WEBRTC_WIN
-                          rect_.width(), rect_.height(),
-#else
-                          width, height,
+  __except (filterException(GetExceptionCode(), GetExceptionInformation())) {
+  }
 #endif
-                          width, height, libyuv::kRotate0, libyuv::FOURCC_ARGB);
-
-    webrtc::VideoFrame input_frame(i420_buffer_, 0, 0,
-                                   webrtc::kVideoRotation_0);
+  if (scaled != 0) {
+    RTC_LOG(LS_ERROR) << "Could not scale the captured frame.";
+    return nullptr;
+  }
+  return capture;
+}
 
-    const int kColorPlanes = 3;  // R, G and B.
-    size_t rgb_len = input_frame.height() * input_frame.width() * kColorPlanes;
-    std::unique_ptr<uint8_t[]> rgb_buf(new uint8_t[rgb_len]);
+// Hashes eight bytes at a time; thumbnails are tightly packed 4-byte
+// pixels, so only the last few bytes take the slow path.
+static uint64_t HashThumbnail(const std::vector<uint8_t>& pixels,
+                              uint64_t seed) {
+  const uint64_t kMul = 0x9e3779b97f4a7c15ull;
+  uint64_t hash = seed ^ (pixels.size() * kMul);
+  size_t i = 0;
+  for (; i + 8 <= pixels.size(); i += 8) {
+    uint64_t word;
+    memcpy(&word, pixels.data() + i, sizeof(word));
+    hash = (hash ^ word) * kMul;
+    hash ^= hash >> 29;
+  }
+  for (; i < pixels.size(); i++) {
+    hash = (hash ^ pixels[i]) * kMul;
+  }
+  return hash ^ (hash >> 32);
+}
 
-    // kRGB24 actually corresponds to FourCC 24BG which is 24-bit BGR.
-    if (ConvertFromI420(input_frame, webrtc::VideoType::kRGB24, 0,
-                        rgb_buf.get()) < 0) {
-      RTC_LOG(LS_ERROR) << "Could not convert input frame to RGB.";
-      return;
+bool MediaSourceImpl::SaveThumbnail(const ScaledCapture& capture,
+                                    const ThumbnailOptions& options) {
+  const int quality = std::min(std::max(options.jpeg_quality, 1), 100);
+  const uint64_t hash = HashThumbnail(
+      capture.pixels,
+      (static_cast<uint64_t>(capture.width) << 40) ^
+          (static_cast<uint64_t>(capture.height) << 16) ^
+          (static_cast<uint64_t>(options.format) << 8) ^ quality);
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (has_thumbnail_ && hash == thumbnail_hash_) {
+      return false;  // Same image: neither re-encoded nor re-notified.
     }
-
-    // Create a thumbnail image from the captured frame.
-    thumbnail_ = EncodeRGBToJpeg((const unsigned char*)rgb_buf.get(),
-                                 input_frame.width(), input_frame.height(),
-                                 kColorPlanes, 75);
   }
-#ifdef WEBRTC_WIN
-  __except (filterException(GetExceptionCode(), GetExceptionInformation())) {
+
+  std::vector<unsigned char> thumbnail;
+  if (options.format == ThumbnailFormat::kRGBA) {
+    // libyuv ABGR is R, G, B, A in memory.
+    thumbnail.resize(capture.pixels.size());
+    libyuv::ARGBToABGR(capture.pixels.data(), capture.width * 4,
+                       thumbnail.data(), capture.width * 4, capture.width,
+                       capture.height);
+  } else {
+    thumbnail = EncodeRGBToJpeg(capture.pixels.data(), capture.width,
+                                capture.height, 4, quality);
   }
-#endif
+
+  webrtc::MutexLock lock(&mutex_);
+  thumbnail_.swap(thumbnail);
+  thumbnail_width_ = capture.width;
+  thumbnail_height_ = capture.height;
+  thumbnail_format_ = options.format;
+  thumbnail_hash_ = hash;
+  has_thumbnail_ = true;
+  return true;
 }
 
 /**
@@ -17,14 +17,20 @@
 #ifndef LIBWEBRTC_RTC_DESKTOP_MEDIA_LIST_IMPL_HXX
 #define LIBWEBRTC_RTC_DESKTOP_MEDIA_LIST_IMPL_HXX
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame.h"
 #include "modules/desktop_capture/desktop_capture_options.h"
 #include "modules/desktop_capture/desktop_capturer.h"
 #include "modules/desktop_capture/desktop_frame.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread.h"
 #include "rtc_desktop_capturer_impl.h"
 #include "rtc_desktop_media_list.h"
+#include "src/internal/observer_dispatcher.h"
 
 namespace libwebrtc {
 
@@ -49,23 +55,69 @@ class MediaSourceImpl : public MediaSource {
   // source name
   string name() const override { return string(source.title); }
 
-  // Returns the thumbnail of the source, jpeg format.
+  // Returns the thumbnail of the source, in thumbnail_format().
   portable::vector<unsigned char> thumbnail() const override {
+    webrtc::MutexLock lock(&mutex_);
     return thumbnail_;
   }
 
+  int thumbnail_width() const override {
+    webrtc::MutexLock lock(&mutex_);
+    return thumbnail_width_;
+  }
+
+  int thumbnail_height() const override {
+    webrtc::MutexLock lock(&mutex_);
+    return thumbnail_height_;
+  }
+
+  ThumbnailFormat thumbnail_format() const override {
+    webrtc::MutexLock lock(&mutex_);
+    return thumbnail_format_;
+  }
+
   DesktopType type() const override { return type_; }
 
   bool UpdateThumbnail() override;
 
-  void SaveCaptureResult(webrtc::DesktopCapturer::Result result,
-                         std::unique_ptr<webrtc::DesktopFrame> frame);
+  bool UpdateThumbnailWithOptions(const ThumbnailOptions& options) override;
+
+ public:
+  // Capture scaled down to the thumbnail size, tightly packed BGRA.
+  struct ScaledCapture {
+    std::vector<uint8_t> pixels;
+    int width = 0;
+    int height = 0;
+  };
+
+  // Scales |frame| down as |options| ask. Called on the capture thread.
+  std::unique_ptr<ScaledCapture> ScaleCapture(
+      webrtc::DesktopCapturer::Result result,
+      std::unique_ptr<webrtc::DesktopFrame> frame,
+      const ThumbnailOptions& options);
+
+  // Encodes |capture| as the thumbnail, unless it hashes the same as the
+  // current one. Returns true if the thumbnail changed.
+  bool SaveThumbnail(const ScaledCapture& capture,
+                     const ThumbnailOptions& options);
+
+  // Marks a thumbnail refresh as in flight; false if one already is.
+  bool BeginRefresh() { return !refreshing_.exchange(true); }
+  void EndRefresh() { refreshing_ = false; }
 
  private:
-  std::vector<unsigned char> thumbnail_;
-  rtc::scoped_refptr<webrtc::I420Buffer> i420_buffer_;
   RTCDesktopMediaListImpl* mediaList_;
   DesktopType type_;
+  std::atomic<bool> refreshing_{false};
+
+  // Guards the members below.
+  mutable webrtc::Mutex mutex_;
+  std::vector<unsigned char> thumbnail_;
+  int thumbnail_width_ = 0;
+  int thumbnail_height_ = 0;
+  ThumbnailFormat thumbnail_format_ = ThumbnailFormat::kJpeg;
+  uint64_t thumbnail_hash_ = 0;
+  bool has_thumbnail_ = false;
 };
 
 class MediaListObserverImpl : public MediaListObserver
@@ -91,7 +143,7 @@ class RTCDesktopMediaListImpl : public RTCDesktopMediaList {
   enum CaptureState { CS_RUNNING, CS_STOPPED, CS_FAILED };
 
  public:
-  RTCDesktopMediaListImpl(DesktopType type, rtc::Thread* signaling_thread);
+  RTCDesktopMediaListImpl(DesktopType type, rtc::Thread* observer_thread);
 
   virtual ~RTCDesktopMediaListImpl();
 
@@ -106,6 +158,9 @@ class RTCDesktopMediaListImpl : public RTCDesktopMediaList {
   int32_t UpdateSourceList(bool force_reload = false,
                            bool get_thumbnail = true) override;
 
+  int32_t UpdateSourceListWithOptions(bool force_reload,
+                                      const ThumbnailOptions& options) override;
+
   int GetSourceCount() const override;
 
   scoped_refptr<MediaSource> GetSource(int index) override;
@@ -113,8 +168,35 @@ class RTCDesktopMediaListImpl : public RTCDesktopMediaList {
   bool GetThumbnail(scoped_refptr<MediaSource> source,
                     bool notify = false) override;
 
+  bool GetThumbnailWithOptions(scoped_refptr<MediaSource> source,
+                               const ThumbnailOptions& options,
+                               bool notify = false) override;
+
+  void StartThumbnailRefresh(int interval_ms,
+                             const ThumbnailOptions& options) override;
+
+  void StopThumbnailRefresh() override;
+
   MediaListObserver* GetObserver() { return observer_; }
 
+  // Delivers the observer events not yet running on |observer_thread|.
+  void SetObserverThread(rtc::Thread* observer_thread);
+
+ private:
+  // Shortest interval of the periodic thumbnail refresh.
+  static const int kMinThumbnailRefreshMs = 250;
+  // Upper bound of the threads encoding thumbnails.
+  static const int kMaxThumbnailThreads = 4;
+
+  int32_t UpdateSources(bool force_reload, bool get_thumbnail,
+                        const ThumbnailOptions& options);
+  // Captures |source| and hands the scaled capture to an encoder thread.
+  // Called on |thread_|.
+  void CaptureThumbnail(scoped_refptr<MediaSourceImpl> source,
+                        const ThumbnailOptions& options, bool notify);
+  void RefreshThumbnails(int generation, int interval_ms,
+                         const ThumbnailOptions& options);
+
  private:
   class CallbackProxy : public webrtc::DesktopCapturer::Callback {
    public:
@@ -141,10 +223,15 @@ class RTCDesktopMediaListImpl : public RTCDesktopMediaList {
   webrtc::DesktopCaptureOptions options_;
   std::unique_ptr<webrtc::DesktopCapturer> capturer_;
   std::unique_ptr<rtc::Thread> thread_;
+  std::vector<std::unique_ptr<rtc::Thread>> encode_threads_;
+  rtc::scoped_refptr<ObserverDispatcher> dispatcher_;
+  std::atomic<int> refresh_generation_{0};
   std::vector<scoped_refptr<MediaSourceImpl>> sources_;
+  // Copy of |sources_| for the periodic refresh on |thread_|.
+  webrtc::Mutex sources_mutex_;
+  std::vector<scoped_refptr<MediaSourceImpl>> listed_sources_;
   MediaListObserver* observer_ = nullptr;
   DesktopType type_;
-  rtc::Thread* signaling_thread_ = nullptr;
 };
 
 }  // namespace libwebrtc
@@ -5,6 +5,9 @@
  */
 
 #include "src/rtc_dummy_video_capturer_impl.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/time_utils.h"
+#include "src/internal/frame_watermark.h"
 #include "rtc_video_frame.h"
 #include "third_party/libyuv/include/libyuv.h"
 
@@ -81,10 +84,11 @@ void DummyVideoCapturerObserverImpl::OnFillBuffer(
  */
 
 RTCDummyVideoCapturerImpl::RTCDummyVideoCapturerImpl(
-    rtc::Thread* signaling_thread, uint32_t fps, uint32_t width,
+    rtc::Thread* observer_thread, uint32_t fps, uint32_t width,
     uint32_t height)
     : thread_(rtc::Thread::Create()),
-      signaling_thread_(signaling_thread),
+      dispatcher_(new rtc::RefCountedObject<ObserverDispatcher>(
+          observer_thread)),
       fps_(fps),
       width_(width),
       height_(height),
@@ -94,6 +98,7 @@ RTCDummyVideoCapturerImpl::RTCDummyVideoCapturerImpl(
 }
 
 RTCDummyVideoCapturerImpl::~RTCDummyVideoCapturerImpl() {
+  dispatcher_->Detach();
   observer_ = nullptr;
   thread_->Stop();
 }
@@ -129,27 +134,18 @@ RTCCaptureState RTCDummyVideoCapturerImpl::Start(uint32_t fps, uint32_t width,
   height_ = height;
   thread_->PostTask([this] { CaptureFrame(); });
   if (observer_) {
-    if (!signaling_thread_->IsCurrent()) {
-      signaling_thread_->BlockingCall([&, this]() { 
-        if (observer_) { observer_->OnStart(); }
-      });
-    }
-    else {
-      observer_->OnStart();
-    }
+    dispatcher_->Post([this] {
+      if (observer_) { observer_->OnStart(); }
+    });
   }
   return capture_state_;
 }
 
 void RTCDummyVideoCapturerImpl::Stop() {
   if (observer_) {
-    if (!signaling_thread_->IsCurrent()) {
-      signaling_thread_->BlockingCall([&, this]() { 
-        if (observer_) { observer_->OnStop(); }
-      });
-    } else {
-      observer_->OnStop();
-    }
+    dispatcher_->Post([this] {
+      if (observer_) { observer_->OnStop(); }
+    });
   }
   capture_state_ = RTCCaptureState::CS_STOPPED;
 }
@@ -195,6 +191,19 @@ void RTCDummyVideoCapturerImpl::FillBuffer() {
   if (observer_ != nullptr) {
     observer_->OnFillBuffer(frame_buffer_);
   }
+  if (watermark_) {
+    FrameWatermark mark;
+    mark.sequence = watermark_sequence_++;
+    mark.timestamp_us = static_cast<uint32_t>(rtc::TimeMicros());
+    WriteFrameWatermark(const_cast<uint8_t*>(frame_buffer_->DataY()),
+                        frame_buffer_->StrideY(), frame_buffer_->width(),
+                        frame_buffer_->height(), mark);
+    watermark_written_ = true;
+  } else if (watermark_written_) {
+    // Leave no stale mark behind for the renderers to read.
+    frame_buffer_->Clear(RTCVideoFrameClearType::kNone);
+    watermark_written_ = false;
+  }
   OnFrameReady(frame_buffer_);
 }
 
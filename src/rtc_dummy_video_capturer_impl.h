@@ -7,11 +7,14 @@
 #ifndef LIB_WEBRTC_RTC_DUMMY_VIDEO_CAPTURER_IMPL_HXX
 #define LIB_WEBRTC_RTC_DUMMY_VIDEO_CAPTURER_IMPL_HXX
 
+#include <atomic>
+
 #include "rtc_types.h"
 #include "rtc_video_frame.h"
 #include "rtc_dummy_video_capturer.h"
 #include "rtc_base/thread.h"
 #include "api/video/i420_buffer.h"
+#include "src/internal/observer_dispatcher.h"
 #include "src/internal/video_capturer.h"
 
 namespace libwebrtc {
@@ -41,7 +44,7 @@ class DummyVideoCapturerObserverImpl : public DummyVideoCapturerObserver
 class RTCDummyVideoCapturerImpl : public RTCDummyVideoCapturer,
                                   public webrtc::internal::VideoCapturer {
 public:
-  RTCDummyVideoCapturerImpl(rtc::Thread* signaling_thread,
+  RTCDummyVideoCapturerImpl(rtc::Thread* observer_thread,
                             uint32_t fps, 
                             uint32_t width,
                             uint32_t height);
@@ -58,6 +61,10 @@ public:
 
   DummyVideoCapturerObserver* GetObserver() override { return observer_; }
 
+  void SetLatencyWatermark(bool enable) override { watermark_ = enable; }
+
+  bool GetLatencyWatermark() const override { return watermark_; }
+
   RTCCaptureState Start() override;
 
   RTCCaptureState Start(uint32_t fps) override;
@@ -79,7 +86,7 @@ private:
 private:
   DummyVideoCapturerObserver* observer_ = nullptr;
   std::unique_ptr<rtc::Thread> thread_;
-  rtc::Thread* signaling_thread_ = nullptr;
+  rtc::scoped_refptr<ObserverDispatcher> dispatcher_;
   rtc::scoped_refptr<webrtc::I420Buffer> i420_buffer_;
   RTCCaptureState capture_state_ = RTCCaptureState::CS_STOPPED;
   uint32_t capture_delay_ = 1000;  // 1s
@@ -87,6 +94,9 @@ private:
   uint32_t width_ = 960;
   uint32_t height_ = 540;
   scoped_refptr<RTCVideoFrame> frame_buffer_;
+  std::atomic<bool> watermark_{false};
+  uint16_t watermark_sequence_ = 0;
+  bool watermark_written_ = false;
 }; // end class RTCDummyVideoCapturerImpl
 
 } // namespace libwebrtc
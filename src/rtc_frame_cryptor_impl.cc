@@ -21,6 +21,23 @@ scoped_refptr<RTCFrameCryptor> FrameCryptorFactory::frameCryptorFromRtpReceiver(
       factory, participant_id, algorithm, key_provider, receiver);
 }
 
+void FrameCryptorFactory::SetCryptoQueuePool(
+    scoped_refptr<RTCPeerConnectionFactory> factory,
+    const FrameCryptorPoolOptions& options) {
+  static_cast<RTCPeerConnectionFactoryImpl*>(factory.get())
+      ->SetCryptoQueuePool(options);
+}
+
+int FrameCryptorFactory::GetCryptoQueueStats(
+    scoped_refptr<RTCPeerConnectionFactory> factory,
+    FrameCryptorQueueStats* stats, int max_queues) {
+  // Asking for stats must not start the default pool's threads.
+  rtc::scoped_refptr<CryptoQueuePool> pool =
+      static_cast<RTCPeerConnectionFactoryImpl*>(factory.get())
+          ->existing_crypto_queue_pool();
+  return pool ? pool->GetStats(stats, max_queues) : 0;
+}
+
 webrtc::FrameCryptorTransformer::Algorithm AlgorithmToFrameCryptorAlgorithm(
     Algorithm algorithm) {
   switch (algorithm) {
@@ -44,6 +61,8 @@ RTCFrameCryptorImpl::RTCFrameCryptorImpl(
       sender_(sender),
       observer_(rtc::make_ref_counted<RTCFrameCryptorObserverAdapter>()) {
   auto factoryImpl = static_cast<RTCPeerConnectionFactoryImpl*>(factory.get());
+  crypto_queue_pool_ = factoryImpl->crypto_queue_pool();
+  crypto_queue_ = crypto_queue_pool_->Acquire(participant_id_.std_string());
   auto keyImpl = static_cast<DefaultKeyProviderImpl*>(key_provider.get());
   RTCRtpSenderImpl* impl = static_cast<RTCRtpSenderImpl*>(sender.get());
   auto mediaType =
@@ -52,12 +71,14 @@ RTCFrameCryptorImpl::RTCFrameCryptorImpl(
           : webrtc::FrameCryptorTransformer::MediaType::kVideoFrame;
   e2ee_transformer_ = rtc::scoped_refptr<webrtc::FrameCryptorTransformer>(
       new webrtc::FrameCryptorTransformer(
-          factoryImpl->signaling_thread(), participant_id_.std_string(),
+          crypto_queue_pool_->thread(crypto_queue_),
+          participant_id_.std_string(),
           mediaType, AlgorithmToFrameCryptorAlgorithm(algorithm),
           keyImpl->rtc_key_provider()));
   e2ee_transformer_->RegisterFrameCryptorTransformerObserver(observer_);
   impl->rtc_rtp_sender()->SetEncoderToPacketizerFrameTransformer(
-      e2ee_transformer_);
+      rtc::make_ref_counted<CryptoQueueTransformer>(
+          crypto_queue_pool_, crypto_queue_, e2ee_transformer_));
   e2ee_transformer_->SetEnabled(false);
 }
 
@@ -74,6 +95,8 @@ RTCFrameCryptorImpl::RTCFrameCryptorImpl(
       observer_(
           rtc::make_ref_counted<libwebrtc::RTCFrameCryptorObserverAdapter>()) {
   auto factoryImpl = static_cast<RTCPeerConnectionFactoryImpl*>(factory.get());
+  crypto_queue_pool_ = factoryImpl->crypto_queue_pool();
+  crypto_queue_ = crypto_queue_pool_->Acquire(participant_id_.std_string());
   auto keyImpl = static_cast<DefaultKeyProviderImpl*>(key_provider.get());
   RTCRtpReceiverImpl* impl = static_cast<RTCRtpReceiverImpl*>(receiver.get());
   auto mediaType =
@@ -82,16 +105,20 @@ RTCFrameCryptorImpl::RTCFrameCryptorImpl(
           : webrtc::FrameCryptorTransformer::MediaType::kVideoFrame;
   e2ee_transformer_ = rtc::scoped_refptr<webrtc::FrameCryptorTransformer>(
       new webrtc::FrameCryptorTransformer(
-          factoryImpl->signaling_thread(), participant_id_.std_string(),
+          crypto_queue_pool_->thread(crypto_queue_),
+          participant_id_.std_string(),
           mediaType, AlgorithmToFrameCryptorAlgorithm(algorithm),
           keyImpl->rtc_key_provider()));
   e2ee_transformer_->RegisterFrameCryptorTransformerObserver(observer_);
   impl->rtp_receiver()->SetDepacketizerToDecoderFrameTransformer(
-      e2ee_transformer_);
+      rtc::make_ref_counted<CryptoQueueTransformer>(
+          crypto_queue_pool_, crypto_queue_, e2ee_transformer_));
   e2ee_transformer_->SetEnabled(false);
 }
 
-RTCFrameCryptorImpl::~RTCFrameCryptorImpl() {}
+RTCFrameCryptorImpl::~RTCFrameCryptorImpl() {
+  crypto_queue_pool_->Release(crypto_queue_);
+}
 
 bool RTCFrameCryptorImpl::SetEnabled(bool enabled) {
   webrtc::MutexLock lock(&mutex_);
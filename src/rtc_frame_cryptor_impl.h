@@ -7,6 +7,8 @@
 #include "rtc_frame_cryptor.h"
 #include "rtc_rtp_receiver_impl.h"
 #include "rtc_rtp_sender_impl.h"
+#include "src/internal/crypto_queue_pool.h"
+#include "src/internal/snapshot_key_provider.h"
 
 namespace libwebrtc {
 class DefaultKeyProviderImpl : public KeyProvider {
@@ -22,8 +24,7 @@ class DefaultKeyProviderImpl : public KeyProvider {
     rtc_options.key_ring_size = options->key_ring_size;
     rtc_options.discard_frame_when_cryptor_not_ready =
         options->discard_frame_when_cryptor_not_ready;
-    impl_ =
-        new rtc::RefCountedObject<webrtc::DefaultKeyProviderImpl>(rtc_options);
+    impl_ = new rtc::RefCountedObject<SnapshotKeyProvider>(rtc_options);
   }
   ~DefaultKeyProviderImpl() {}
 
@@ -59,10 +60,26 @@ class DefaultKeyProviderImpl : public KeyProvider {
     impl_->SetSifTrailer(trailer.std_vector());
   }
 
+  int SetKeys(const KeyProviderEntry* entries, int count) override {
+    if (!entries || count <= 0) {
+      return 0;
+    }
+    std::vector<SnapshotKeyProvider::KeyEntry> keys(count);
+    for (int i = 0; i < count; i++) {
+      const KeyProviderEntry& entry = entries[i];
+      keys[i].participant_id = entry.participant_id ? entry.participant_id : "";
+      keys[i].index = entry.index;
+      if (entry.key && entry.key_size > 0) {
+        keys[i].key.assign(entry.key, entry.key + entry.key_size);
+      }
+    }
+    return impl_->SetKeys(keys);
+  }
+
   rtc::scoped_refptr<webrtc::KeyProvider> rtc_key_provider() { return impl_; }
 
  private:
-  rtc::scoped_refptr<webrtc::DefaultKeyProviderImpl> impl_;
+  rtc::scoped_refptr<SnapshotKeyProvider> impl_;
 };
 
 class RTCFrameCryptorObserverAdapter
@@ -116,6 +133,9 @@ class RTCFrameCryptorImpl : public RTCFrameCryptor {
   mutable webrtc::Mutex mutex_;
   bool enabled_;
   int key_index_;
+  // Declared before |e2ee_transformer_|, which runs on one of its threads.
+  rtc::scoped_refptr<CryptoQueuePool> crypto_queue_pool_;
+  int crypto_queue_ = 0;
   rtc::scoped_refptr<webrtc::FrameCryptorTransformer> e2ee_transformer_;
   scoped_refptr<KeyProvider> key_provider_;
   scoped_refptr<RTCRtpSender> sender_;
@@ -27,12 +27,12 @@ RTCIceCandidateImpl::RTCIceCandidateImpl(
     std::unique_ptr<webrtc::IceCandidateInterface> rtc_candidate)
     : candidate_(std::move(rtc_candidate)) {
   sdp_mid_ = candidate_->sdp_mid();
+  candidate_->ToString(&sdp_);
 }
 
-const string RTCIceCandidateImpl::candidate() const {
-  candidate_->ToString((std::string*)&sdp_);
-  return sdp_;
-}
+const string RTCIceCandidateImpl::candidate() const { return sdp_; }
+
+string_view RTCIceCandidateImpl::candidate_view() const { return sdp_; }
 
 const string RTCIceCandidateImpl::sdp_mid() const { return sdp_mid_; }
 
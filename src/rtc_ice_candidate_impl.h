@@ -15,6 +15,10 @@ class RTCIceCandidateImpl : public RTCIceCandidate {
 
   virtual const string sdp_mid() const override;
 
+  virtual string_view candidate_view() const override;
+
+  virtual string_view sdp_mid_view() const override { return sdp_mid_; }
+
   virtual int sdp_mline_index() const override;
 
   virtual bool ToString(string& out) override;
@@ -26,6 +30,7 @@ class RTCIceCandidateImpl : public RTCIceCandidate {
 
  private:
   std::unique_ptr<webrtc::IceCandidateInterface> candidate_;
+  // Serialized once so that candidate_view() can hand it out.
   std::string sdp_;
   std::string sdp_mid_;
 };
@@ -164,12 +164,23 @@ scoped_refptr<RTCMediaStreamList> RTCMediaStreamList::Create(
   return new RefCountedObject<RTCMediaStreamListImpl>(source);
 }
 
+scoped_refptr<RTCMediaStreamList> RTCMediaStreamList::Create(
+    vector<scoped_refptr<RTCMediaStream>>&& source) {
+  return new RefCountedObject<RTCMediaStreamListImpl>(std::move(source));
+}
+
 RTCMediaStreamListImpl::RTCMediaStreamListImpl(
     const vector<scoped_refptr<RTCMediaStream>>& source)
     : RTCMediaStreamList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCMediaStreamListImpl::RTCMediaStreamListImpl(
+    vector<scoped_refptr<RTCMediaStream>>&& source)
+    : RTCMediaStreamList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCMediaStreamListImpl::~RTCMediaStreamListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
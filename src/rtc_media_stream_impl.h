@@ -1,8 +1,12 @@
 #ifndef LIB_WEBRTC_MEDIA_STREAM_IMPL_HXX
 #define LIB_WEBRTC_MEDIA_STREAM_IMPL_HXX
 
+#include <set>
+#include <string>
+
 #include "api/media_stream_interface.h"
 #include "api/peer_connection_interface.h"
+#include "rtc_base/synchronization/mutex.h"
 
 #include "rtc_media_stream.h"
 #include "rtc_peerconnection.h"
@@ -11,11 +15,51 @@
 
 namespace libwebrtc {
 
+/**
+ * Keeps the last report delivered to a delta-mode GetStats() call, so the
+ * next one can tell which members changed and compute rates.
+ */
+class RTCStatsHistory : public rtc::RefCountInterface {
+ public:
+  // Stores |report| and returns the previously stored one (may be null).
+  rtc::scoped_refptr<const webrtc::RTCStatsReport> Exchange(
+      rtc::scoped_refptr<const webrtc::RTCStatsReport> report) {
+    webrtc::MutexLock lock(&mutex_);
+    std::swap(previous_, report);
+    return report;
+  }
+
+ private:
+  webrtc::Mutex mutex_;
+  rtc::scoped_refptr<const webrtc::RTCStatsReport> previous_;
+};
+
+// Reads the numeric attribute |name| of |stats| as a double. Returns false if
+// it is missing, undefined or not a number.
+bool GetStatsNumber(const webrtc::RTCStats& stats, const char* name,
+                    double* value);
+
 class WebRTCStatsCollectorCallback : public webrtc::RTCStatsCollectorCallback {
  public:
   WebRTCStatsCollectorCallback(OnStatsCollectorSuccess success,
                                OnStatsCollectorFailure failure)
       : success_(success), failure_(failure) {}
+
+  WebRTCStatsCollectorCallback(const RTCStatsFilter& filter,
+                               rtc::scoped_refptr<RTCStatsHistory> history,
+                               OnStatsCollectorSuccess success,
+                               OnStatsCollectorFailure failure)
+      : success_(success), failure_(failure), delta_(filter.delta) {
+    for (size_t i = 0; i < filter.types.size(); i++) {
+      types_.insert(filter.types[i].std_string());
+    }
+    for (size_t i = 0; i < filter.members.size(); i++) {
+      members_.insert(filter.members[i].std_string());
+    }
+    if (delta_) {
+      history_ = history;
+    }
+  }
   ~WebRTCStatsCollectorCallback() {}
 
   static rtc::scoped_refptr<WebRTCStatsCollectorCallback> Create(
@@ -28,12 +72,25 @@ class WebRTCStatsCollectorCallback : public webrtc::RTCStatsCollectorCallback {
     return rtc_stats_observer;
   }
 
+  static rtc::scoped_refptr<WebRTCStatsCollectorCallback> Create(
+      const RTCStatsFilter& filter,
+      rtc::scoped_refptr<RTCStatsHistory> history,
+      OnStatsCollectorSuccess success, OnStatsCollectorFailure failure) {
+    return rtc::scoped_refptr<WebRTCStatsCollectorCallback>(
+        new rtc::RefCountedObject<WebRTCStatsCollectorCallback>(
+            filter, history, success, failure));
+  }
+
   virtual void OnStatsDelivered(
       const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) override;
 
  private:
   OnStatsCollectorSuccess success_;
   OnStatsCollectorFailure failure_;
+  std::set<std::string> types_;
+  std::set<std::string> members_;
+  bool delta_ = false;
+  rtc::scoped_refptr<RTCStatsHistory> history_;
 };
 
 class RTCStatsMemberImpl : public RTCStatsMember {
@@ -156,6 +213,62 @@ class RTCStatsMemberImpl : public RTCStatsMember {
   const webrtc::Attribute attr_;
 };
 
+/**
+ * Stats member computed by the library (e.g. a bitrate in delta mode) rather
+ * than read from the native report.
+ */
+class RTCStatsComputedMemberImpl : public RTCStatsMember {
+ public:
+  RTCStatsComputedMemberImpl(const std::string& name, double value)
+      : name_(name), value_(value) {}
+  ~RTCStatsComputedMemberImpl() {}
+
+  string GetName() const override { return name_; }
+  Type GetType() const override { return Type::kDouble; }
+  bool IsDefined() const override { return true; }
+
+  bool ValueBool() const override { return value_ != 0; }
+  int32_t ValueInt32() const override { return static_cast<int32_t>(value_); }
+  uint32_t ValueUint32() const override {
+    return static_cast<uint32_t>(value_);
+  }
+  int64_t ValueInt64() const override { return static_cast<int64_t>(value_); }
+  uint64_t ValueUint64() const override {
+    return static_cast<uint64_t>(value_);
+  }
+  double ValueDouble() const override { return value_; }
+  string ValueString() const override { return std::to_string(value_); }
+  vector<bool> ValueSequenceBool() const override { return vector<bool>(); }
+  vector<int32_t> ValueSequenceInt32() const override {
+    return vector<int32_t>();
+  }
+  vector<uint32_t> ValueSequenceUint32() const override {
+    return vector<uint32_t>();
+  }
+  vector<int64_t> ValueSequenceInt64() const override {
+    return vector<int64_t>();
+  }
+  vector<uint64_t> ValueSequenceUint64() const override {
+    return vector<uint64_t>();
+  }
+  vector<double> ValueSequenceDouble() const override {
+    return vector<double>();
+  }
+  vector<string> ValueSequenceString() const override {
+    return vector<string>();
+  }
+  map<string, uint64_t> ValueMapStringUint64() const override {
+    return map<string, uint64_t>();
+  }
+  map<string, double> ValueMapStringDouble() const override {
+    return map<string, double>();
+  }
+
+ private:
+  const std::string name_;
+  const double value_;
+};
+
 class MediaRTCStatsImpl : public MediaRTCStats {
  public:
   MediaRTCStatsImpl(std::unique_ptr<webrtc::RTCStats> stats);
@@ -168,7 +281,12 @@ class MediaRTCStatsImpl : public MediaRTCStats {
 
   virtual const string ToJson() override;
 
-  virtual const vector<scoped_refptr<RTCStatsMember>> Members() override {
+  virtual string_view ToJsonView() override;
+
+  virtual vector<scoped_refptr<RTCStatsMember>> Members() override {
+    if (members_selected_) {
+      return members_;
+    }
     members_.clear();
     for (const webrtc::Attribute attr : stats_->Attributes()) {
       if (!attr.has_value()) continue;
@@ -177,9 +295,25 @@ class MediaRTCStatsImpl : public MediaRTCStats {
     return members_;
   }
 
+  // Fixes the result of Members() to the attributes named in |names| (all if
+  // empty). With |delta| set, attributes equal to those of |previous| are
+  // dropped and rate members computed against |previous| are appended.
+  // Returns false if no member was selected.
+  bool SelectMembers(const std::set<std::string>& names,
+                     const webrtc::RTCStats* previous, bool delta);
+
+ private:
+  void AppendRates(const webrtc::RTCStats& previous,
+                   const std::set<std::string>& names);
+
  private:
   std::unique_ptr<webrtc::RTCStats> stats_;
   std::vector<scoped_refptr<RTCStatsMember>> members_;
+  bool members_selected_ = false;
+  // Guards the members below.
+  webrtc::Mutex json_mutex_;
+  std::string json_;
+  bool json_ready_ = false;
 };
 
 class MediaStreamImpl : public RTCMediaStream,
@@ -237,6 +371,7 @@ class MediaStreamImpl : public RTCMediaStream,
 class RTCMediaStreamListImpl : public RTCMediaStreamList {
  public:
   RTCMediaStreamListImpl(const vector<scoped_refptr<RTCMediaStream>>& source);
+  RTCMediaStreamListImpl(vector<scoped_refptr<RTCMediaStream>>&& source);
   ~RTCMediaStreamListImpl();
 };
 
@@ -16,8 +16,10 @@
 #include "rtc_video_source_impl.h"
 #include "rtc_dummy_video_capturer_impl.h"
 #include "rtc_dummy_audio_source_impl.h"
+#include "rtc_frame_cryptor.h"
 #include "src/internal/dummy_capturer.h"
 #include "src/internal/dummy_audio_capturer.h"
+#include "src/internal/video_codec_plugin.h"
 #if defined(USE_INTEL_MEDIA_SDK)
 #include "src/win/mediacapabilities.h"
 #include "src/win/msdkvideodecoderfactory.h"
@@ -46,12 +48,52 @@ std::unique_ptr<webrtc::VideoDecoderFactory> CreateIntelVideoDecoderFactory() {
 }
 #endif
 
+// The codecs built into the library, behind the plugins of |options|.
+std::unique_ptr<webrtc::VideoEncoderFactory> CreateVideoEncoderFactory(
+    const RTCPeerConnectionFactoryOptions& options) {
+#if defined(USE_INTEL_MEDIA_SDK)
+  std::unique_ptr<webrtc::VideoEncoderFactory> builtin =
+      CreateIntelVideoEncoderFactory();
+#else
+  std::unique_ptr<webrtc::VideoEncoderFactory> builtin =
+      webrtc::CreateBuiltinVideoEncoderFactory();
+#endif
+  if (!options.video_encoder_factory) {
+    return builtin;
+  }
+  return std::make_unique<PluginVideoEncoderFactory>(
+      options.video_encoder_factory, std::move(builtin));
+}
+
+std::unique_ptr<webrtc::VideoDecoderFactory> CreateVideoDecoderFactory(
+    const RTCPeerConnectionFactoryOptions& options) {
+#if defined(USE_INTEL_MEDIA_SDK)
+  std::unique_ptr<webrtc::VideoDecoderFactory> builtin =
+      CreateIntelVideoDecoderFactory();
+#else
+  std::unique_ptr<webrtc::VideoDecoderFactory> builtin =
+      webrtc::CreateBuiltinVideoDecoderFactory();
+#endif
+  if (!options.video_decoder_factory) {
+    return builtin;
+  }
+  return std::make_unique<PluginVideoDecoderFactory>(
+      options.video_decoder_factory, std::move(builtin));
+}
+
 RTCPeerConnectionFactoryImpl::RTCPeerConnectionFactoryImpl() {}
 
 RTCPeerConnectionFactoryImpl::~RTCPeerConnectionFactoryImpl() {}
 
 bool RTCPeerConnectionFactoryImpl::Initialize(bool use_dummy_audio /*= false*/) {
-  use_dummy_audio_ = use_dummy_audio;
+  RTCPeerConnectionFactoryOptions options;
+  options.use_dummy_audio = use_dummy_audio;
+  return InitializeWithOptions(options);
+}
+
+bool RTCPeerConnectionFactoryImpl::InitializeWithOptions(
+    const RTCPeerConnectionFactoryOptions& options) {
+  use_dummy_audio_ = options.use_dummy_audio;
   worker_thread_ = rtc::Thread::Create();
   worker_thread_->SetName("worker_thread", nullptr);
   RTC_CHECK(worker_thread_->Start()) << "Failed to start thread";
@@ -73,12 +115,7 @@ bool RTCPeerConnectionFactoryImpl::Initialize(bool use_dummy_audio /*= false*/)
         network_thread_.get(), worker_thread_.get(), signaling_thread_.get(),
         audio_device_module_, webrtc::CreateBuiltinAudioEncoderFactory(),
         webrtc::CreateBuiltinAudioDecoderFactory(),
-#if defined(USE_INTEL_MEDIA_SDK)
-        CreateIntelVideoEncoderFactory(), CreateIntelVideoDecoderFactory(),
-#else
-        webrtc::CreateBuiltinVideoEncoderFactory(),
-        webrtc::CreateBuiltinVideoDecoderFactory(),
-#endif
+        CreateVideoEncoderFactory(options), CreateVideoDecoderFactory(options),
         nullptr, nullptr);
   }
 
@@ -103,6 +140,51 @@ bool RTCPeerConnectionFactoryImpl::Terminate() {
   return true;
 }
 
+void RTCPeerConnectionFactoryImpl::SetObserverThread(RTCObserverThread thread) {
+  if (thread == RTCObserverThread::kEventThread && !event_thread_) {
+    event_thread_ = rtc::Thread::Create();
+    event_thread_->SetName("observer_event_thread", nullptr);
+    RTC_CHECK(event_thread_->Start()) << "Failed to start thread";
+  }
+  observer_thread_ = thread;
+#ifdef RTC_DESKTOP_DEVICE
+  if (desktop_device_impl_) {
+    desktop_device_impl_->SetObserverThread(observer_thread());
+  }
+#endif
+}
+
+rtc::Thread* RTCPeerConnectionFactoryImpl::observer_thread() {
+  if (observer_thread_ == RTCObserverThread::kEventThread) {
+    return event_thread_.get();
+  }
+  return signaling_thread_.get();
+}
+
+rtc::scoped_refptr<CryptoQueuePool>
+RTCPeerConnectionFactoryImpl::crypto_queue_pool() {
+  webrtc::MutexLock lock(&crypto_mutex_);
+  if (!crypto_queue_pool_) {
+    crypto_queue_pool_ =
+        rtc::make_ref_counted<CryptoQueuePool>(FrameCryptorPoolOptions());
+  }
+  return crypto_queue_pool_;
+}
+
+rtc::scoped_refptr<CryptoQueuePool>
+RTCPeerConnectionFactoryImpl::existing_crypto_queue_pool() {
+  webrtc::MutexLock lock(&crypto_mutex_);
+  return crypto_queue_pool_;
+}
+
+void RTCPeerConnectionFactoryImpl::SetCryptoQueuePool(
+    const FrameCryptorPoolOptions& options) {
+  rtc::scoped_refptr<CryptoQueuePool> pool =
+      rtc::make_ref_counted<CryptoQueuePool>(options);
+  webrtc::MutexLock lock(&crypto_mutex_);
+  crypto_queue_pool_.swap(pool);
+}
+
 void RTCPeerConnectionFactoryImpl::CreateAudioDeviceModule_w() {
   if (!audio_device_module_)
     audio_device_module_ = webrtc::AudioDeviceModule::Create(
@@ -122,7 +204,8 @@ scoped_refptr<RTCPeerConnection> RTCPeerConnectionFactoryImpl::Create(
   scoped_refptr<RTCPeerConnection> peerconnection =
       scoped_refptr<RTCPeerConnectionImpl>(
           new RefCountedObject<RTCPeerConnectionImpl>(
-              configuration, constraints, rtc_peerconnection_factory_));
+              configuration, constraints, rtc_peerconnection_factory_,
+              signaling_thread_.get()));
   peerconnections_.push_back(peerconnection);
   return peerconnection;
 }
@@ -183,7 +266,7 @@ scoped_refptr<RTCDummyAudioSource> RTCPeerConnectionFactoryImpl::CreateDummyAudi
       rtc::scoped_refptr<webrtc::internal::DummyAudioCapturer>(
         new rtc::RefCountedObject<webrtc::internal::DummyAudioCapturer>(
           task_queue_factory_.get(),
-          signaling_thread_.get(),
+          observer_thread(),
           16, /* bits_per_sample */
           sample_rate_hz,
           num_channels,
@@ -201,7 +284,7 @@ scoped_refptr<RTCDesktopDevice>
 RTCPeerConnectionFactoryImpl::GetDesktopDevice() {
   if (!desktop_device_impl_) {
     desktop_device_impl_ = scoped_refptr<RTCDesktopDeviceImpl>(
-        new RefCountedObject<RTCDesktopDeviceImpl>(signaling_thread_.get()));
+        new RefCountedObject<RTCDesktopDeviceImpl>(observer_thread()));
   }
   return desktop_device_impl_;
 }
@@ -324,7 +407,7 @@ scoped_refptr<RTCDummyVideoCapturer> RTCPeerConnectionFactoryImpl::CreateDummyVi
 {
   return scoped_refptr<RTCDummyVideoCapturer>(
     new RefCountedObject<RTCDummyVideoCapturerImpl>(
-      signaling_thread_.get(),
+      observer_thread(),
       fps,
       width,
       height
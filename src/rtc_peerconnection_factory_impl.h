@@ -7,10 +7,12 @@
 #include "api/peer_connection_interface.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "rtc_audio_device_impl.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread.h"
 #include "rtc_peerconnection.h"
 #include "rtc_peerconnection_factory.h"
 #include "rtc_video_device_impl.h"
+#include "src/internal/crypto_queue_pool.h"
 
 #ifdef RTC_DESKTOP_DEVICE
 #include "rtc_desktop_capturer_impl.h"
@@ -78,6 +80,11 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
 
   virtual bool GetUseDummyAudio() override { return use_dummy_audio_; }
 
+  void SetObserverThread(RTCObserverThread thread) override;
+
+  bool InitializeWithOptions(
+      const RTCPeerConnectionFactoryOptions& options) override;
+
   rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
   peer_connection_factory() {
     return rtc_peerconnection_factory_;
@@ -91,6 +98,18 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
 
   rtc::Thread* signaling_thread() { return signaling_thread_.get(); }
 
+  // Thread that calls the capturer and media list observers.
+  rtc::Thread* observer_thread();
+
+  // Crypto queues of the frame cryptors created next; creates the default
+  // pool on first use.
+  rtc::scoped_refptr<CryptoQueuePool> crypto_queue_pool();
+
+  // The current pool, or null if none has been created yet.
+  rtc::scoped_refptr<CryptoQueuePool> existing_crypto_queue_pool();
+
+  void SetCryptoQueuePool(const FrameCryptorPoolOptions& options);
+
  protected:
   void CreateAudioDeviceModule_w();
 
@@ -113,6 +132,9 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
   std::unique_ptr<rtc::Thread> worker_thread_;
   std::unique_ptr<rtc::Thread> signaling_thread_;
   std::unique_ptr<rtc::Thread> network_thread_;
+  // Created by SetObserverThread(RTCObserverThread::kEventThread).
+  std::unique_ptr<rtc::Thread> event_thread_;
+  RTCObserverThread observer_thread_ = RTCObserverThread::kSignalingThread;
   rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
       rtc_peerconnection_factory_;
   rtc::scoped_refptr<webrtc::AudioDeviceModule> audio_device_module_;
@@ -124,6 +146,10 @@ class RTCPeerConnectionFactoryImpl : public RTCPeerConnectionFactory {
   std::list<scoped_refptr<RTCPeerConnection>> peerconnections_;
   std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory_;
   bool use_dummy_audio_ = false;
+
+  // Guards the member below.
+  webrtc::Mutex crypto_mutex_;
+  rtc::scoped_refptr<CryptoQueuePool> crypto_queue_pool_;
 };
 
 }  // namespace libwebrtc
@@ -1,11 +1,16 @@
 #include "rtc_peerconnection_impl.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <utility>
 #include <vector>
 
+#include "api/candidate.h"
 #include "api/data_channel_interface.h"
+#include "p2p/base/p2p_constants.h"
 #include "pc/media_session.h"
+#include "rtc_base/network_constants.h"
 #include "rtc_base/logging.h"
 #include "rtc_data_channel_impl.h"
 #include "rtc_sdp_parse_error_impl.h"
@@ -59,7 +64,25 @@ static std::map<libwebrtc::TcpCandidatePolicy,
         {libwebrtc::TcpCandidatePolicy::kTcpCandidatePolicyDisabled,
          webrtc::PeerConnectionInterface::kTcpCandidatePolicyDisabled},
         {libwebrtc::TcpCandidatePolicy::kTcpCandidatePolicyEnabled,
-         webrtc::PeerConnectionInterface::kTcpCandidatePolicyDisabled}};
+         webrtc::PeerConnectionInterface::kTcpCandidatePolicyEnabled}};
+
+static std::map<libwebrtc::BundlePolicy,
+                webrtc::PeerConnectionInterface::BundlePolicy>
+    bundle_policy_map = {
+        {libwebrtc::BundlePolicy::kBundlePolicyBalanced,
+         webrtc::PeerConnectionInterface::kBundlePolicyBalanced},
+        {libwebrtc::BundlePolicy::kBundlePolicyMaxBundle,
+         webrtc::PeerConnectionInterface::kBundlePolicyMaxBundle},
+        {libwebrtc::BundlePolicy::kBundlePolicyMaxCompat,
+         webrtc::PeerConnectionInterface::kBundlePolicyMaxCompat}};
+
+static std::map<libwebrtc::ContinualGatheringPolicy,
+                webrtc::PeerConnectionInterface::ContinualGatheringPolicy>
+    continual_gathering_policy_map = {
+        {libwebrtc::ContinualGatheringPolicy::kGatherOnce,
+         webrtc::PeerConnectionInterface::GATHER_ONCE},
+        {libwebrtc::ContinualGatheringPolicy::kGatherContinually,
+         webrtc::PeerConnectionInterface::GATHER_CONTINUALLY}};
 
 static std::map<webrtc::PeerConnectionInterface::PeerConnectionState,
                 libwebrtc::RTCPeerConnectionState>
@@ -190,12 +213,23 @@ scoped_refptr<RTCStatsMemberList> RTCStatsMemberList::Create(
   return new RefCountedObject<RTCStatsMemberListImpl>(source);
 }
 
+scoped_refptr<RTCStatsMemberList> RTCStatsMemberList::Create(
+    vector<scoped_refptr<RTCStatsMember>>&& source) {
+  return new RefCountedObject<RTCStatsMemberListImpl>(std::move(source));
+}
+
 RTCStatsMemberListImpl::RTCStatsMemberListImpl(
     const vector<scoped_refptr<RTCStatsMember>>& source)
     : RTCStatsMemberList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCStatsMemberListImpl::RTCStatsMemberListImpl(
+    vector<scoped_refptr<RTCStatsMember>>&& source)
+    : RTCStatsMemberList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCStatsMemberListImpl::~RTCStatsMemberListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -205,12 +239,23 @@ scoped_refptr<MediaRTCStatsList> MediaRTCStatsList::Create(
   return new RefCountedObject<MediaRTCStatsListImpl>(source);
 }
 
+scoped_refptr<MediaRTCStatsList> MediaRTCStatsList::Create(
+    vector<scoped_refptr<MediaRTCStats>>&& source) {
+  return new RefCountedObject<MediaRTCStatsListImpl>(std::move(source));
+}
+
 MediaRTCStatsListImpl::MediaRTCStatsListImpl(
     const vector<scoped_refptr<MediaRTCStats>>& source)
     : MediaRTCStatsList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+MediaRTCStatsListImpl::MediaRTCStatsListImpl(
+    vector<scoped_refptr<MediaRTCStats>>&& source)
+    : MediaRTCStatsList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 MediaRTCStatsListImpl::~MediaRTCStatsListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -283,6 +328,25 @@ void RTCPeerConnectionObserverImpl::OnIceCandidate(scoped_refptr<RTCIceCandidate
   }
 }
 
+void RTCPeerConnectionObserverImpl::OnIceCandidates(vector<scoped_refptr<RTCIceCandidate>> candidates) {
+  if (callbacks_) {
+    rtcPeerConnectionObserverCallbacks* pCallbacks = reinterpret_cast<rtcPeerConnectionObserverCallbacks*>(callbacks_);
+    if (pCallbacks->IceCandidatesReadytoSend == nullptr) {
+      RTCPeerConnectionObserver::OnIceCandidates(candidates);
+      return;
+    }
+    std::vector<rtcIceCandidateHandle> handles;
+    for (size_t i = 0; i < candidates.size(); i++) {
+      scoped_refptr<RTCIceCandidate> candidate = candidates[i];
+      handles.push_back(static_cast<rtcIceCandidateHandle>(candidate.release()));
+    }
+    pCallbacks->IceCandidatesReadytoSend(
+      pCallbacks->UserData,
+      handles.data(),
+      static_cast<int>(handles.size()));
+  }
+}
+
 void RTCPeerConnectionObserverImpl::OnAddStream(scoped_refptr<RTCMediaStream> stream) {
   if (callbacks_) {
     rtcPeerConnectionObserverCallbacks* pCallbacks = reinterpret_cast<rtcPeerConnectionObserverCallbacks*>(callbacks_);
@@ -348,6 +412,67 @@ void RTCPeerConnectionObserverImpl::OnRemoveTrack(scoped_refptr<RTCRtpReceiver>
   }
 }
 
+/**
+ * class RTCIceCandidateBatcher
+ */
+
+RTCIceCandidateBatcher::RTCIceCandidateBatcher(
+    RTCPeerConnectionImpl* peerconnection, int batch_size, int window_ms)
+    : peerconnection_(peerconnection),
+      batch_size_(static_cast<size_t>(std::max(batch_size, 0))),
+      window_ms_(window_ms) {}
+
+void RTCIceCandidateBatcher::Add(scoped_refptr<RTCIceCandidate> candidate) {
+  if (!peerconnection_) {
+    return;
+  }
+  thread_ = rtc::Thread::Current();
+  pending_.push_back(candidate);
+
+  if (batch_size_ > 0 && pending_.size() >= batch_size_) {
+    Flush();
+    return;
+  }
+
+  if (pending_.size() == 1 && window_ms_ > 0 && thread_) {
+    rtc::scoped_refptr<RTCIceCandidateBatcher> self(this);
+    int generation = generation_;
+    thread_.load()->PostDelayedTask(
+        [self, generation]() {
+          if (self->generation_ == generation) {
+            self->Flush();
+          }
+        },
+        webrtc::TimeDelta::Millis(window_ms_));
+  }
+}
+
+void RTCIceCandidateBatcher::Flush() {
+  generation_++;
+  if (pending_.empty()) {
+    return;
+  }
+
+  std::vector<scoped_refptr<RTCIceCandidate>> batch;
+  batch.swap(pending_);
+  if (peerconnection_) {
+    peerconnection_->DeliverIceCandidates(batch);
+  }
+}
+
+void RTCIceCandidateBatcher::Detach() {
+  rtc::Thread* thread = thread_;
+  if (thread && !thread->IsCurrent()) {
+    thread->BlockingCall([this] {
+      peerconnection_ = nullptr;
+      pending_.clear();
+    });
+    return;
+  }
+  peerconnection_ = nullptr;
+  pending_.clear();
+}
+
 /**
  * class RTCPeerConnectionImpl 
  */
@@ -356,12 +481,19 @@ RTCPeerConnectionImpl::RTCPeerConnectionImpl(
     const RTCConfiguration& configuration,
     scoped_refptr<RTCMediaConstraints> constraints,
     rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
-        peer_connection_factory)
+        peer_connection_factory,
+    rtc::Thread* signaling_thread)
     : rtc_peerconnection_factory_(peer_connection_factory),
       configuration_(configuration),
       constraints_(constraints),
       callback_crt_sec_(new webrtc::Mutex()),
-      initialize_crt_sec_(new webrtc::Mutex())
+      initialize_crt_sec_(new webrtc::Mutex()),
+      stats_history_(new rtc::RefCountedObject<RTCStatsHistory>()),
+      signaling_thread_(signaling_thread),
+      transceiver_cache_(new rtc::RefCountedObject<RTCRtpTransceiverCache>()),
+      receiver_cache_(new rtc::RefCountedObject<RTCRtpReceiverCache>()),
+      sender_cache_(new rtc::RefCountedObject<RTCRtpSenderCache>()),
+      stream_cache_(new rtc::RefCountedObject<RTCMediaStreamCache>())
 {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor";
   Initialize();
@@ -379,10 +511,12 @@ void RTCPeerConnectionImpl::OnAddTrack(
   if (nullptr != observer_) {
     std::vector<scoped_refptr<RTCMediaStream>> out_streams;
     for (auto item : streams) {
-      out_streams.push_back(new RefCountedObject<MediaStreamImpl>(item));
+      out_streams.push_back(
+          stream_cache_->GetOrCreate<MediaStreamImpl>(item));
     }
     scoped_refptr<RTCRtpReceiver> rtc_receiver =
-        new RefCountedObject<RTCRtpReceiverImpl>(receiver);
+        receiver_cache_->GetOrCreate<RTCRtpReceiverImpl>(receiver,
+                                                          stream_cache_);
     observer_->OnAddTrack(out_streams, rtc_receiver);
   }
 }
@@ -391,7 +525,8 @@ void RTCPeerConnectionImpl::OnTrack(
     rtc::scoped_refptr<webrtc::RtpTransceiverInterface> transceiver) {
   if (nullptr != observer_) {
     observer_->OnTrack(
-        new RefCountedObject<RTCRtpTransceiverImpl>(transceiver));
+        transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+            transceiver, sender_cache_, receiver_cache_, stream_cache_));
   }
 }
 
@@ -399,7 +534,8 @@ void RTCPeerConnectionImpl::OnRemoveTrack(
     rtc::scoped_refptr<webrtc::RtpReceiverInterface> receiver) {
   if (nullptr != observer_) {
     observer_->OnRemoveTrack(
-        new RefCountedObject<RTCRtpReceiverImpl>(receiver));
+        receiver_cache_->GetOrCreate<RTCRtpReceiverImpl>(receiver,
+                                                          stream_cache_));
   }
 }
 
@@ -408,8 +544,8 @@ void RTCPeerConnectionImpl::OnAddStream(
     rtc::scoped_refptr<webrtc::MediaStreamInterface> stream) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << " " << stream->id();
 
-  scoped_refptr<MediaStreamImpl> remote_stream = scoped_refptr<MediaStreamImpl>(
-      new RefCountedObject<MediaStreamImpl>(stream));
+  scoped_refptr<MediaStreamImpl> remote_stream = static_cast<MediaStreamImpl*>(
+      stream_cache_->GetOrCreate<MediaStreamImpl>(stream).get());
 
   remote_stream->RegisterRTCPeerConnectionObserver(observer_);
 
@@ -465,6 +601,10 @@ void RTCPeerConnectionImpl::OnConnectionChange(
 
 void RTCPeerConnectionImpl::OnIceGatheringChange(
     webrtc::PeerConnectionInterface::IceGatheringState new_state) {
+  if (candidate_batcher_ &&
+      new_state == webrtc::PeerConnectionInterface::kIceGatheringComplete) {
+    candidate_batcher_->Flush();
+  }
   if (observer_)
     observer_->OnIceGatheringState(ice_gathering_state_map[new_state]);
 }
@@ -488,31 +628,83 @@ void RTCPeerConnectionImpl::AddCandidate(const string mid, int mid_mline_index,
   if (candidate != nullptr) rtc_peerconnection_->AddIceCandidate(candidate);
 }
 
+// Returns true if |candidate| matches any IceCandidateFilter bit in |filter|.
+static bool IsIceCandidateFiltered(const cricket::Candidate& candidate,
+                                   uint32_t filter) {
+  if (filter == kIceCandidateFilterNone) {
+    return false;
+  }
+
+  uint32_t bits = candidate.protocol() == cricket::UDP_PROTOCOL_NAME
+                      ? kIceCandidateFilterUdp
+                      : kIceCandidateFilterTcp;
+
+  if (candidate.is_local()) {
+    bits |= kIceCandidateFilterHost;
+  } else if (candidate.is_stun()) {
+    bits |= kIceCandidateFilterSrflx;
+  } else if (candidate.is_prflx()) {
+    bits |= kIceCandidateFilterPrflx;
+  } else if (candidate.is_relay()) {
+    bits |= kIceCandidateFilterRelay;
+  }
+
+  int family = candidate.address().family();
+  if (family == AF_INET) {
+    bits |= kIceCandidateFilterIPv4;
+  } else if (family == AF_INET6) {
+    bits |= kIceCandidateFilterIPv6;
+  }
+
+  switch (candidate.network_type()) {
+    case rtc::ADAPTER_TYPE_ETHERNET:
+      bits |= kIceCandidateFilterEthernet;
+      break;
+    case rtc::ADAPTER_TYPE_WIFI:
+      bits |= kIceCandidateFilterWifi;
+      break;
+    case rtc::ADAPTER_TYPE_CELLULAR:
+    case rtc::ADAPTER_TYPE_CELLULAR_2G:
+    case rtc::ADAPTER_TYPE_CELLULAR_3G:
+    case rtc::ADAPTER_TYPE_CELLULAR_4G:
+    case rtc::ADAPTER_TYPE_CELLULAR_5G:
+      bits |= kIceCandidateFilterCellular;
+      break;
+    case rtc::ADAPTER_TYPE_VPN:
+      bits |= kIceCandidateFilterVpn;
+      break;
+    case rtc::ADAPTER_TYPE_LOOPBACK:
+      bits |= kIceCandidateFilterLoopback;
+      break;
+    default:
+      break;
+  }
+
+  return (bits & filter) != 0;
+}
+
 void RTCPeerConnectionImpl::OnIceCandidate(
     const webrtc::IceCandidateInterface* candidate) {
   if (!rtc_peerconnection_) return;
 
-#if 0
-    if (candidate->candidate().protocol() != "tcp")
-        return;
-
-
-  // For loopback test. To save some connecting delay.
-  if (type_ == kLoopBack) {
-    if (!rtc_peerconnection_->AddIceCandidate(candidate)) {
-      RTC_LOG(LS_WARNING) << "Failed to apply the received candidate";
-    }
+  if (IsIceCandidateFiltered(candidate->candidate(),
+                             configuration_.ice_candidate_filter)) {
+    RTC_LOG(LS_INFO) << __FUNCTION__ << ", filtered "
+                     << candidate->candidate().ToSensitiveString();
     return;
   }
-#endif
 
   std::string cand_sdp;
-  if (observer_ && candidate->ToString(&cand_sdp)) {
+  if ((observer_ || candidate_batcher_) && candidate->ToString(&cand_sdp)) {
     scoped_refptr<RTCSdpParseError> error = RTCSdpParseError::Create();
     scoped_refptr<RTCIceCandidate> cand =
         RTCIceCandidate::Create(cand_sdp.c_str(), candidate->sdp_mid().c_str(),
                                 candidate->sdp_mline_index(), error);
-    observer_->OnIceCandidate(cand);
+    if (candidate_batcher_) {
+      candidate_batcher_->Add(cand);
+    } else {
+      observer_->OnIceCandidate(cand);
+    }
   }
 
   RTC_LOG(LS_INFO) << __FUNCTION__ << ", mid " << candidate->sdp_mid()
@@ -520,6 +712,13 @@ void RTCPeerConnectionImpl::OnIceCandidate(
                    << cand_sdp;
 }
 
+void RTCPeerConnectionImpl::DeliverIceCandidates(
+    const std::vector<scoped_refptr<RTCIceCandidate>>& candidates) {
+  if (observer_) {
+    observer_->OnIceCandidates(candidates);
+  }
+}
+
 void RTCPeerConnectionImpl::RegisterRTCPeerConnectionObserver(
     RTCPeerConnectionObserver* observer) {
   webrtc::MutexLock cs(callback_crt_sec_.get());
@@ -541,15 +740,18 @@ bool RTCPeerConnectionImpl::Initialize() {
   RTC_DCHECK(rtc_peerconnection_factory_.get() != nullptr);
   RTC_DCHECK(rtc_peerconnection_.get() == nullptr);
 
+  // Close() detaches the batcher for good, so every native connection gets
+  // a new one.
+  if (configuration_.ice_candidate_batch_size > 0 ||
+      configuration_.ice_candidate_batch_window_ms > 0) {
+    candidate_batcher_ = new rtc::RefCountedObject<RTCIceCandidateBatcher>(
+        this, configuration_.ice_candidate_batch_size,
+        configuration_.ice_candidate_batch_window_ms);
+  }
+
   webrtc::PeerConnectionInterface::RTCConfiguration config;
   webrtc::PeerConnectionInterface::IceServers servers;
 
-  config.rtcp_mux_policy =
-      webrtc::PeerConnectionInterface::kRtcpMuxPolicyNegotiate;
-
-  config.candidate_network_policy =
-      webrtc::PeerConnectionInterface::kCandidateNetworkPolicyAll;
-
   for (int i = 0; i < kMaxIceServerSize; i++) {
     IceServer ice_server = configuration_.ice_servers[i];
     if (ice_server.uri.size() > 0) {
@@ -568,6 +770,10 @@ bool RTCPeerConnectionImpl::Initialize() {
       tcp_candidate_policy_map[configuration_.tcp_candidate_policy];
   config.type = ice_transport_type_map[configuration_.type];
   config.rtcp_mux_policy = rtcp_mux_policy_map[configuration_.rtcp_mux_policy];
+  config.bundle_policy = bundle_policy_map[configuration_.bundle_policy];
+  config.ice_candidate_pool_size = configuration_.ice_candidate_pool_size;
+  config.continual_gathering_policy =
+      continual_gathering_policy_map[configuration_.continual_gathering_policy];
 
   offer_answer_options_.offer_to_receive_audio =
       configuration_.offer_to_receive_audio;
@@ -576,15 +782,49 @@ bool RTCPeerConnectionImpl::Initialize() {
 
   offer_answer_options_.use_rtp_mux = configuration_.use_rtp_mux;
 
-  // config.disable_ipv6 = configuration_.disable_ipv6;
   config.disable_ipv6_on_wifi = configuration_.disable_ipv6_on_wifi;
   config.disable_link_local_networks =
       configuration_.disable_link_local_networks;
-  config.max_ipv6_networks = configuration_.max_ipv6_networks;
+  // RTCConfiguration no longer has disable_ipv6; allowing no IPv6 network
+  // keeps the port allocator from gathering on IPv6 at all.
+  config.max_ipv6_networks =
+      configuration_.disable_ipv6 ? 0 : configuration_.max_ipv6_networks;
 
   if (configuration_.screencast_min_bitrate > 0)
     config.screencast_min_bitrate = configuration_.screencast_min_bitrate;
 
+  if (configuration_.ice_check_interval_strong_connectivity >= 0) {
+    config.ice_check_interval_strong_connectivity =
+        configuration_.ice_check_interval_strong_connectivity;
+  }
+  if (configuration_.ice_check_interval_weak_connectivity >= 0) {
+    config.ice_check_interval_weak_connectivity =
+        configuration_.ice_check_interval_weak_connectivity;
+  }
+  if (configuration_.ice_check_min_interval >= 0) {
+    config.ice_check_min_interval = configuration_.ice_check_min_interval;
+  }
+  if (configuration_.ice_connection_receiving_timeout >= 0) {
+    config.ice_connection_receiving_timeout =
+        configuration_.ice_connection_receiving_timeout;
+  }
+  if (configuration_.ice_backup_candidate_pair_ping_interval >= 0) {
+    config.ice_backup_candidate_pair_ping_interval =
+        configuration_.ice_backup_candidate_pair_ping_interval;
+  }
+
+  if (configuration_.min_port > 0 || configuration_.max_port > 0) {
+    config.port_allocator_config.min_port = configuration_.min_port;
+    config.port_allocator_config.max_port = configuration_.max_port;
+  }
+
+  config.audio_jitter_buffer_max_packets =
+      configuration_.audio_jitter_buffer_max_packets;
+  config.audio_jitter_buffer_fast_accelerate =
+      configuration_.audio_jitter_buffer_fast_accelerate;
+  config.audio_jitter_buffer_min_delay_ms =
+      configuration_.audio_jitter_buffer_min_delay_ms;
+
   RTCMediaConstraintsImpl* media_constraints =
       static_cast<RTCMediaConstraintsImpl*>(constraints_.get());
   webrtc::MediaConstraints rtc_constraints(media_constraints->GetMandatory(),
@@ -603,7 +843,11 @@ bool RTCPeerConnectionImpl::Initialize() {
 
   if (!result.ok()) {
     RTC_LOG(LS_WARNING) << "CreatePeerConnection failed";
-    Close();
+    // The lock is held here, so Close() can't be used. No candidate reached
+    // the batcher without a native connection, so it is just dropped.
+    initialized_ = false;
+    candidate_batcher_ = nullptr;
+    CloseLocked();
     return false;
   }
 
@@ -789,13 +1033,33 @@ void RTCPeerConnectionImpl::RestartIce() {
 }
 
 void RTCPeerConnectionImpl::Close() {
-  webrtc::MutexLock cs(initialize_crt_sec_.get());
-  if (!initialized_) {
-    return;
+  rtc::scoped_refptr<RTCIceCandidateBatcher> candidate_batcher;
+  {
+    webrtc::MutexLock cs(initialize_crt_sec_.get());
+    if (!initialized_) {
+      return;
+    }
+    initialized_ = false;
+    candidate_batcher = candidate_batcher_;
+    CloseLocked();
+  }
+
+  // Detached once the lock is released: it waits for the signaling thread,
+  // whose tasks may need the lock themselves.
+  if (candidate_batcher) {
+    candidate_batcher->Detach();
   }
-  initialized_ = false;
+}
 
+void RTCPeerConnectionImpl::CloseLocked() {
   RTC_LOG(LS_INFO) << __FUNCTION__;
+  for (auto link : stats_samplers_) {
+    webrtc::MutexLock lock(&link->mutex);
+    if (link->sampler) {
+      link->sampler->Detach();
+    }
+  }
+  stats_samplers_.clear();
   if (rtc_peerconnection_.get()) {
     rtc_peerconnection_ = nullptr;
     data_channel_ = nullptr;
@@ -860,7 +1124,8 @@ scoped_refptr<RTCMediaStream> RTCPeerConnectionImpl::CreateLocalMediaStream(
   }
   auto stream =
       rtc_peerconnection_factory_->CreateLocalMediaStream(stream_id.c_string());
-  auto rtc_stream = new RefCountedObject<MediaStreamImpl>(stream);
+  scoped_refptr<RTCMediaStream> rtc_stream =
+      stream_cache_->GetOrCreate<MediaStreamImpl>(stream);
   local_streams_.push_back(rtc_stream);
   return rtc_stream;
 }
@@ -907,6 +1172,44 @@ void RTCPeerConnectionImpl::GetStats(OnStatsCollectorSuccess success,
   rtc_peerconnection_->GetStats(rtc_callback.get());
 }
 
+void RTCPeerConnectionImpl::GetFilteredStats(
+    const RTCStatsFilter& filter, OnStatsCollectorSuccess success,
+    OnStatsCollectorFailure failure) {
+  rtc::scoped_refptr<WebRTCStatsCollectorCallback> rtc_callback =
+      WebRTCStatsCollectorCallback::Create(filter, stats_history_, success,
+                                           failure);
+  if (!rtc_peerconnection_.get() || !rtc_peerconnection_factory_.get()) {
+    webrtc::MutexLock cs(callback_crt_sec_.get());
+    failure("Failed to initialize PeerConnection");
+    return;
+  }
+  rtc_peerconnection_->GetStats(rtc_callback.get());
+}
+
+scoped_refptr<RTCStatsSampler> RTCPeerConnectionImpl::CreateStatsSampler(
+    const RTCStatsSamplerConfig& config) {
+  webrtc::MutexLock cs(initialize_crt_sec_.get());
+  if (!rtc_peerconnection_.get() || config.interval_ms <= 0 ||
+      config.history_size <= 0 || config.fields.size() == 0) {
+    return nullptr;
+  }
+
+  // Forget the samplers the application has released meanwhile.
+  stats_samplers_.erase(
+      std::remove_if(stats_samplers_.begin(), stats_samplers_.end(),
+                     [](const rtc::scoped_refptr<RTCStatsSamplerLink>& link) {
+                       webrtc::MutexLock lock(&link->mutex);
+                       return link->sampler == nullptr;
+                     }),
+      stats_samplers_.end());
+
+  scoped_refptr<RTCStatsSamplerImpl> sampler =
+      new RefCountedObject<RTCStatsSamplerImpl>(signaling_thread_,
+                                                rtc_peerconnection_, config);
+  stats_samplers_.push_back(sampler->link());
+  return sampler;
+}
+
 scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
     scoped_refptr<RTCMediaTrack> track,
     scoped_refptr<RTCRtpTransceiverInit> init) {
@@ -927,7 +1230,8 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
   }
 
   if (errorOr.ok()) {
-    return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+    return transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+        errorOr.value(), sender_cache_, receiver_cache_, stream_cache_);
   }
 
   return scoped_refptr<RTCRtpTransceiver>();
@@ -947,7 +1251,8 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
   }
 
   if (errorOr.ok()) {
-    return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+    return transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+        errorOr.value(), sender_cache_, receiver_cache_, stream_cache_);
   }
   // onAdd(scoped_refptr<RTCRtpTransceiver>(), errorOr.error().message());
   return scoped_refptr<RTCRtpTransceiver>();
@@ -965,7 +1270,8 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
         cricket::MediaType::MEDIA_TYPE_VIDEO);
   }
   if (errorOr.ok()) {
-    return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+    return transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+        errorOr.value(), sender_cache_, receiver_cache_, stream_cache_);
   }
   // onAdd(scoped_refptr<RTCRtpTransceiver>(), errorOr.error().message());
   return scoped_refptr<RTCRtpTransceiver>();
@@ -985,7 +1291,8 @@ scoped_refptr<RTCRtpTransceiver> RTCPeerConnectionImpl::AddTransceiver(
         cricket::MediaType::MEDIA_TYPE_VIDEO, initImpl->rtp_transceiver_init());
   }
   if (errorOr.ok()) {
-    return new RefCountedObject<RTCRtpTransceiverImpl>(errorOr.value());
+    return transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+        errorOr.value(), sender_cache_, receiver_cache_, stream_cache_);
   }
   // onAdd(scoped_refptr<RTCRtpTransceiver>(), errorOr.error().message());
   return scoped_refptr<RTCRtpTransceiver>();
@@ -1009,7 +1316,7 @@ scoped_refptr<RTCRtpSender> RTCPeerConnectionImpl::AddTrack(
   }
 
   if (errorOr.ok()) {
-    return new RefCountedObject<RTCRtpSenderImpl>(errorOr.value());
+    return sender_cache_->GetOrCreate<RTCRtpSenderImpl>(errorOr.value());
   }
 
   // onAdd(scoped_refptr<RTCRtpSender>(), errorOr.error().message());
@@ -1029,7 +1336,7 @@ bool RTCPeerConnectionImpl::RemoveTrack(scoped_refptr<RTCRtpSender> render) {
 vector<scoped_refptr<RTCRtpSender>> RTCPeerConnectionImpl::senders() {
   std::vector<scoped_refptr<RTCRtpSender>> vec;
   for (auto item : rtc_peerconnection_->GetSenders()) {
-    vec.push_back(new RefCountedObject<RTCRtpSenderImpl>(item));
+    vec.push_back(sender_cache_->GetOrCreate<RTCRtpSenderImpl>(item));
   }
   return vec;
 }
@@ -1037,7 +1344,9 @@ vector<scoped_refptr<RTCRtpSender>> RTCPeerConnectionImpl::senders() {
 vector<scoped_refptr<RTCRtpTransceiver>> RTCPeerConnectionImpl::transceivers() {
   std::vector<scoped_refptr<RTCRtpTransceiver>> vec;
   for (auto item : rtc_peerconnection_->GetTransceivers()) {
-    vec.push_back(new RefCountedObject<RTCRtpTransceiverImpl>(item));
+    vec.push_back(
+        transceiver_cache_->GetOrCreate<RTCRtpTransceiverImpl>(
+            item, sender_cache_, receiver_cache_, stream_cache_));
   }
   return vec;
 }
@@ -1045,7 +1354,8 @@ vector<scoped_refptr<RTCRtpTransceiver>> RTCPeerConnectionImpl::transceivers() {
 vector<scoped_refptr<RTCRtpReceiver>> RTCPeerConnectionImpl::receivers() {
   std::vector<scoped_refptr<RTCRtpReceiver>> vec;
   for (auto item : rtc_peerconnection_->GetReceivers()) {
-    vec.push_back(new RefCountedObject<RTCRtpReceiverImpl>(item));
+    vec.push_back(
+        receiver_cache_->GetOrCreate<RTCRtpReceiverImpl>(item, stream_cache_));
   }
   return vec;
 }
@@ -1075,24 +1385,161 @@ RTCIceGatheringState RTCPeerConnectionImpl::ice_gathering_state() {
 
 void WebRTCStatsCollectorCallback::OnStatsDelivered(
     const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) {
+  rtc::scoped_refptr<const webrtc::RTCStatsReport> previous;
+  if (history_) {
+    previous = history_->Exchange(report);
+  }
+  bool select_members = delta_ || !members_.empty();
+
   webrtc::RTCStatsReport::ConstIterator iter = report->begin();
-  std::vector<scoped_refptr<MediaRTCStats>> reports;
+  vector<scoped_refptr<MediaRTCStats>> reports;
+  reports.reserve(report->size());
   while (iter != report->end()) {
-    reports.push_back(new RefCountedObject<MediaRTCStatsImpl>(iter->copy()));
+    if (!types_.empty() && types_.find(iter->type()) == types_.end()) {
+      iter++;
+      continue;
+    }
+    scoped_refptr<MediaRTCStatsImpl> stats =
+        new RefCountedObject<MediaRTCStatsImpl>(iter->copy());
+    if (!select_members ||
+        stats->SelectMembers(members_,
+                             previous ? previous->Get(iter->id()) : nullptr,
+                             delta_)) {
+      reports.push_back(std::move(stats));
+    }
     iter++;
   }
-  success_(reports);
+  success_(std::move(reports));
+}
+
+static const webrtc::Attribute* FindStatsAttribute(
+    const std::vector<webrtc::Attribute>& attributes, const char* name) {
+  for (const webrtc::Attribute& attr : attributes) {
+    if (strcmp(attr.name(), name) == 0) {
+      return &attr;
+    }
+  }
+  return nullptr;
+}
+
+bool GetStatsNumber(const webrtc::RTCStats& stats, const char* name,
+                    double* value) {
+  for (const webrtc::Attribute& attr : stats.Attributes()) {
+    if (!attr.has_value() || strcmp(attr.name(), name) != 0) continue;
+    if (attr.holds_alternative<uint64_t>()) {
+      *value = static_cast<double>(attr.get<uint64_t>());
+    } else if (attr.holds_alternative<int64_t>()) {
+      *value = static_cast<double>(attr.get<int64_t>());
+    } else if (attr.holds_alternative<uint32_t>()) {
+      *value = static_cast<double>(attr.get<uint32_t>());
+    } else if (attr.holds_alternative<int32_t>()) {
+      *value = static_cast<double>(attr.get<int32_t>());
+    } else if (attr.holds_alternative<double>()) {
+      *value = attr.get<double>();
+    } else {
+      return false;
+    }
+    return true;
+  }
+  return false;
 }
 
+static const struct {
+  const char* counter;
+  const char* rate;
+  double scale;
+} kStatsRates[] = {
+    {"bytesSent", "sendBitrate", 8.0},
+    {"bytesReceived", "receiveBitrate", 8.0},
+    {"packetsSent", "packetsSentPerSecond", 1.0},
+    {"packetsReceived", "packetsReceivedPerSecond", 1.0},
+};
+
 MediaRTCStatsImpl::MediaRTCStatsImpl(std::unique_ptr<webrtc::RTCStats> stats)
     : stats_(std::move(stats)) {}
 
+bool MediaRTCStatsImpl::SelectMembers(const std::set<std::string>& names,
+                                      const webrtc::RTCStats* previous,
+                                      bool delta) {
+  members_.clear();
+  members_selected_ = true;
+
+  std::vector<webrtc::Attribute> previous_attributes;
+  if (delta && previous) {
+    previous_attributes = previous->Attributes();
+  }
+
+  for (const webrtc::Attribute& attr : stats_->Attributes()) {
+    if (!attr.has_value()) continue;
+    if (!names.empty() && names.find(attr.name()) == names.end()) continue;
+    if (delta && previous) {
+      const webrtc::Attribute* previous_attr =
+          FindStatsAttribute(previous_attributes, attr.name());
+      if (previous_attr && previous_attr->has_value() &&
+          *previous_attr == attr) {
+        continue;
+      }
+    }
+    members_.push_back(new RefCountedObject<RTCStatsMemberImpl>(attr));
+  }
+
+  if (delta && previous) {
+    AppendRates(*previous, names);
+  }
+  return !members_.empty();
+}
+
+void MediaRTCStatsImpl::AppendRates(const webrtc::RTCStats& previous,
+                                    const std::set<std::string>& names) {
+  double elapsed_s = (stats_->timestamp() - previous.timestamp()).us() / 1e6;
+  if (elapsed_s <= 0) {
+    return;
+  }
+
+  auto wanted = [&names](const char* name) {
+    return names.empty() || names.find(name) != names.end();
+  };
+
+  for (const auto& entry : kStatsRates) {
+    double current = 0, last = 0;
+    if (!wanted(entry.rate) ||
+        !GetStatsNumber(*stats_, entry.counter, &current) ||
+        !GetStatsNumber(previous, entry.counter, &last)) {
+      continue;
+    }
+    members_.push_back(new RefCountedObject<RTCStatsComputedMemberImpl>(
+        entry.rate, (current - last) * entry.scale / elapsed_s));
+  }
+
+  double lost = 0, last_lost = 0, received = 0, last_received = 0;
+  if (wanted("packetLossRate") &&
+      GetStatsNumber(*stats_, "packetsLost", &lost) &&
+      GetStatsNumber(previous, "packetsLost", &last_lost) &&
+      GetStatsNumber(*stats_, "packetsReceived", &received) &&
+      GetStatsNumber(previous, "packetsReceived", &last_received)) {
+    double lost_delta = lost - last_lost;
+    double expected = lost_delta + (received - last_received);
+    members_.push_back(new RefCountedObject<RTCStatsComputedMemberImpl>(
+        "packetLossRate",
+        expected > 0 ? std::max(0.0, lost_delta) / expected : 0.0));
+  }
+}
+
 const string MediaRTCStatsImpl::id() { return stats_->id(); }
 
 const string MediaRTCStatsImpl::type() { return stats_->type(); }
 
 int64_t MediaRTCStatsImpl::timestamp_us() { return stats_->timestamp().us(); }
 
-const string MediaRTCStatsImpl::ToJson() { return stats_->ToJson(); }
+const string MediaRTCStatsImpl::ToJson() { return ToJsonView(); }
+
+string_view MediaRTCStatsImpl::ToJsonView() {
+  webrtc::MutexLock lock(&json_mutex_);
+  if (!json_ready_) {
+    json_ = stats_->ToJson();
+    json_ready_ = true;
+  }
+  return json_;
+}
 
 }  // namespace libwebrtc
@@ -1,6 +1,7 @@
 #ifndef LIB_WEBRTC_MEDIA_SESSION_IMPL_HXX
 #define LIB_WEBRTC_MEDIA_SESSION_IMPL_HXX
 
+#include <atomic>
 #include <deque>
 #include <map>
 #include <set>
@@ -12,13 +13,16 @@
 #include "api/scoped_refptr.h"
 #include "modules/video_capture/video_capture.h"
 #include "rtc_audio_track_impl.h"
+#include "rtc_media_stream_impl.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_peerconnection.h"
 #include "rtc_peerconnection_factory.h"
+#include "rtc_stats_sampler_impl.h"
 #include "rtc_video_sink_adapter.h"
 #include "rtc_video_source.h"
 #include "rtc_video_source_impl.h"
 #include "rtc_video_track_impl.h"
+#include "rtc_wrapper_cache.h"
 #include "src/internal/video_capturer.h"
 
 namespace webrtc {
@@ -37,6 +41,7 @@ namespace libwebrtc {
 class RTCStatsMemberListImpl : public RTCStatsMemberList {
  public:
   RTCStatsMemberListImpl(const vector<scoped_refptr<RTCStatsMember>>& source);
+  RTCStatsMemberListImpl(vector<scoped_refptr<RTCStatsMember>>&& source);
   ~RTCStatsMemberListImpl();
 }; // end class RTCStatsMemberListImpl
 
@@ -46,6 +51,7 @@ class RTCStatsMemberListImpl : public RTCStatsMemberList {
 class MediaRTCStatsListImpl : public MediaRTCStatsList {
  public:
   MediaRTCStatsListImpl(const vector<scoped_refptr<MediaRTCStats>>& source);
+  MediaRTCStatsListImpl(vector<scoped_refptr<MediaRTCStats>>&& source);
   ~MediaRTCStatsListImpl();
 }; // end class MediaRTCStatsListImpl
 
@@ -83,10 +89,43 @@ class RTCPeerConnectionObserverImpl : public RTCPeerConnectionObserver
 
    void OnRemoveTrack(scoped_refptr<RTCRtpReceiver> receiver) override;
 
+   void OnIceCandidates(vector<scoped_refptr<RTCIceCandidate>> candidates) override;
+
  private:
    void* callbacks_ /* rtcPeerConnectionObserverCallbacks* */;
 }; // end class RTCPeerConnectionObserverImpl
 
+class RTCPeerConnectionImpl;
+
+/**
+ * class RTCIceCandidateBatcher
+ *
+ * Queues local ICE candidates and hands them to the peer connection in
+ * batches. Runs on the signaling thread; a pending window timer keeps the
+ * batcher, not the connection, alive.
+ */
+class RTCIceCandidateBatcher : public rtc::RefCountInterface {
+ public:
+  RTCIceCandidateBatcher(RTCPeerConnectionImpl* peerconnection,
+                         int batch_size, int window_ms);
+
+  void Add(scoped_refptr<RTCIceCandidate> candidate);
+
+  void Flush();
+
+  // Drops queued candidates and disconnects from the peer connection.
+  void Detach();
+
+ private:
+  RTCPeerConnectionImpl* peerconnection_;
+  std::atomic<rtc::Thread*> thread_{nullptr};
+  const size_t batch_size_;
+  const int window_ms_;
+  std::vector<scoped_refptr<RTCIceCandidate>> pending_;
+  // Bumped on every flush so that stale window timers do nothing.
+  int generation_ = 0;
+};
+
 /**
  * class RTCPeerConnectionImpl
  */
@@ -195,12 +234,20 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
   virtual void GetStats(OnStatsCollectorSuccess success,
                         OnStatsCollectorFailure failure) override;
 
+  virtual void GetFilteredStats(const RTCStatsFilter& filter,
+                                OnStatsCollectorSuccess success,
+                                OnStatsCollectorFailure failure) override;
+
+  virtual scoped_refptr<RTCStatsSampler> CreateStatsSampler(
+      const RTCStatsSamplerConfig& config) override;
+
  public:
   RTCPeerConnectionImpl(
       const RTCConfiguration& configuration,
       scoped_refptr<RTCMediaConstraints> constraints,
       rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
-          peer_connection_factory);
+          peer_connection_factory,
+      rtc::Thread* signaling_thread);
 
  protected:
   ~RTCPeerConnectionImpl();
@@ -244,11 +291,19 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
 
   virtual RTCPeerConnectionObserver* GetObserver() override { return observer_; }
 
+ public:
+  // Reports a batch of local candidates. Called by the batcher.
+  void DeliverIceCandidates(
+      const std::vector<scoped_refptr<RTCIceCandidate>>& candidates);
+
  protected:
+  // Close() minus the batcher; |initialize_crt_sec_| must be held.
+  void CloseLocked();
+
   rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface>
       rtc_peerconnection_factory_;
   rtc::scoped_refptr<webrtc::PeerConnectionInterface> rtc_peerconnection_;
-  const RTCConfiguration& configuration_;
+  const RTCConfiguration configuration_;
   scoped_refptr<RTCMediaConstraints> constraints_;
   webrtc::PeerConnectionInterface::RTCOfferAnswerOptions offer_answer_options_;
   RTCPeerConnectionObserver* observer_ = nullptr;
@@ -259,6 +314,19 @@ class RTCPeerConnectionImpl : public RTCPeerConnection,
   std::vector<scoped_refptr<RTCMediaStream>> local_streams_;
   std::vector<scoped_refptr<RTCMediaStream>> remote_streams_;
   scoped_refptr<RTCDataChannel> data_channel_;
+  rtc::scoped_refptr<RTCStatsHistory> stats_history_;
+  // Runs the stats samplers of every connection of the factory.
+  rtc::Thread* const signaling_thread_;
+  // Held weakly: a sampler the application releases is destroyed and
+  // clears its link.
+  std::vector<rtc::scoped_refptr<RTCStatsSamplerLink>> stats_samplers_;
+  // Wrappers handed out for native objects, so each native object keeps a
+  // single wrapper for as long as the application holds it.
+  rtc::scoped_refptr<RTCRtpTransceiverCache> transceiver_cache_;
+  rtc::scoped_refptr<RTCRtpReceiverCache> receiver_cache_;
+  rtc::scoped_refptr<RTCRtpSenderCache> sender_cache_;
+  rtc::scoped_refptr<RTCMediaStreamCache> stream_cache_;
+  rtc::scoped_refptr<RTCIceCandidateBatcher> candidate_batcher_;
 };
 
 }  // namespace libwebrtc
@@ -40,7 +40,7 @@ RTCRtpCapabilitiesImpl::RTCRtpCapabilitiesImpl(
     webrtc::RtpCapabilities rtp_capabilities)
     : rtp_capabilities_(rtp_capabilities) {}
 
-const vector<scoped_refptr<RTCRtpCodecCapability>>
+vector<scoped_refptr<RTCRtpCodecCapability>>
 RTCRtpCapabilitiesImpl::codecs() {
   std::vector<scoped_refptr<RTCRtpCodecCapability>> codecs;
   for (auto& codec : rtp_capabilities_.codecs) {
@@ -58,7 +58,7 @@ void RTCRtpCapabilitiesImpl::set_codecs(
   }
 }
 
-const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
+vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
 RTCRtpCapabilitiesImpl::header_extensions() {
   std::vector<scoped_refptr<RTCRtpHeaderExtensionCapability>> header_extensions;
   for (auto& header_extension : rtp_capabilities_.header_extensions) {
@@ -86,10 +86,27 @@ webrtc::RtpCapabilities RTCRtpCapabilitiesImpl::rtp_capabilities() {
 
 RTCRtpCodecCapabilityImpl::RTCRtpCodecCapabilityImpl(
     webrtc::RtpCodecCapability rtp_codec_capability)
-    : rtp_codec_capability_(rtp_codec_capability) {}
+    : rtp_codec_capability_(rtp_codec_capability) {
+  UpdateViews();
+}
+
+void RTCRtpCodecCapabilityImpl::UpdateViews() {
+  mime_type_ = rtp_codec_capability_.mime_type();
+  std::vector<std::string> strarr;
+  for (auto parameter : rtp_codec_capability_.parameters) {
+    if (parameter.first == "") {
+      strarr.push_back(parameter.second);
+    } else {
+      strarr.push_back(parameter.first + "=" + parameter.second);
+    }
+  }
+  sdp_fmtp_line_ = join(strarr, ";");
+}
+
+string RTCRtpCodecCapabilityImpl::mime_type() const { return mime_type_; }
 
-string RTCRtpCodecCapabilityImpl::mime_type() const {
-  return rtp_codec_capability_.mime_type();
+string_view RTCRtpCodecCapabilityImpl::mime_type_view() const {
+  return mime_type_;
 }
 
 void RTCRtpCodecCapabilityImpl::set_mime_type(const string& mime_type) {
@@ -104,6 +121,7 @@ void RTCRtpCodecCapabilityImpl::set_mime_type(const string& mime_type) {
     kind = cricket::MEDIA_TYPE_DATA;
   }
   rtp_codec_capability_.kind = kind;
+  UpdateViews();
 }
 
 int RTCRtpCodecCapabilityImpl::clock_rate() const {
@@ -123,15 +141,11 @@ void RTCRtpCodecCapabilityImpl::set_channels(int channels) {
 }
 
 string RTCRtpCodecCapabilityImpl::sdp_fmtp_line() const {
-  std::vector<std::string> strarr;
-  for (auto parameter : rtp_codec_capability_.parameters) {
-    if (parameter.first == "") {
-      strarr.push_back(parameter.second);
-    } else {
-      strarr.push_back(parameter.first + "=" + parameter.second);
-    }
-  }
-  return join(strarr, ";");
+  return sdp_fmtp_line_;
+}
+
+string_view RTCRtpCodecCapabilityImpl::sdp_fmtp_line_view() const {
+  return sdp_fmtp_line_;
 }
 
 void RTCRtpCodecCapabilityImpl::set_sdp_fmtp_line(const string& sdp_fmtp_line) {
@@ -144,6 +158,7 @@ void RTCRtpCodecCapabilityImpl::set_sdp_fmtp_line(const string& sdp_fmtp_line) {
       rtp_codec_capability_.parameters[""] = parameter;
     }
   }
+  UpdateViews();
 }
 
 webrtc::RtpCodecCapability RTCRtpCodecCapabilityImpl::rtp_codec_capability() {
@@ -155,12 +170,23 @@ scoped_refptr<RTCRtpCodecCapabilityList> RTCRtpCodecCapabilityList::Create(
   return new RefCountedObject<RTCRtpCodecCapabilityListImpl>(source);
 }
 
+scoped_refptr<RTCRtpCodecCapabilityList> RTCRtpCodecCapabilityList::Create(
+    vector<scoped_refptr<RTCRtpCodecCapability>>&& source) {
+  return new RefCountedObject<RTCRtpCodecCapabilityListImpl>(std::move(source));
+}
+
 RTCRtpCodecCapabilityListImpl::RTCRtpCodecCapabilityListImpl(
     const vector<scoped_refptr<RTCRtpCodecCapability>>& source)
     : RTCRtpCodecCapabilityList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpCodecCapabilityListImpl::RTCRtpCodecCapabilityListImpl(
+    vector<scoped_refptr<RTCRtpCodecCapability>>&& source)
+    : RTCRtpCodecCapabilityList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpCodecCapabilityListImpl::~RTCRtpCodecCapabilityListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -202,12 +228,23 @@ scoped_refptr<RTCRtpHeaderExtensionCapabilityList> RTCRtpHeaderExtensionCapabili
   return new RefCountedObject<RTCRtpHeaderExtensionCapabilityListImpl>(source);
 }
 
+scoped_refptr<RTCRtpHeaderExtensionCapabilityList> RTCRtpHeaderExtensionCapabilityList::Create(
+    vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>&& source) {
+  return new RefCountedObject<RTCRtpHeaderExtensionCapabilityListImpl>(std::move(source));
+}
+
 RTCRtpHeaderExtensionCapabilityListImpl::RTCRtpHeaderExtensionCapabilityListImpl(
     const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>& source)
     : RTCRtpHeaderExtensionCapabilityList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpHeaderExtensionCapabilityListImpl::RTCRtpHeaderExtensionCapabilityListImpl(
+    vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>&& source)
+    : RTCRtpHeaderExtensionCapabilityList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpHeaderExtensionCapabilityListImpl::~RTCRtpHeaderExtensionCapabilityListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -9,10 +9,10 @@ namespace libwebrtc {
 class RTCRtpCapabilitiesImpl : public RTCRtpCapabilities {
  public:
   RTCRtpCapabilitiesImpl(webrtc::RtpCapabilities rtp_capabilities);
-  virtual const vector<scoped_refptr<RTCRtpCodecCapability>> codecs() override;
+  virtual vector<scoped_refptr<RTCRtpCodecCapability>> codecs() override;
   virtual void set_codecs(
       vector<scoped_refptr<RTCRtpCodecCapability>> codecs) override;
-  virtual const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
+  virtual vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>
   header_extensions() override;
   virtual void set_header_extensions(
       vector<scoped_refptr<RTCRtpHeaderExtensionCapability>> header_extensions)
@@ -26,7 +26,7 @@ class RTCRtpCapabilitiesImpl : public RTCRtpCapabilities {
 
 class RTCRtpCodecCapabilityImpl : public RTCRtpCodecCapability {
  public:
-  RTCRtpCodecCapabilityImpl() {}
+  RTCRtpCodecCapabilityImpl() { UpdateViews(); }
   RTCRtpCodecCapabilityImpl(webrtc::RtpCodecCapability rtp_codec_capability);
   virtual void set_mime_type(const string& mime_type) override;
   virtual void set_clock_rate(int clock_rate) override;
@@ -38,10 +38,19 @@ class RTCRtpCodecCapabilityImpl : public RTCRtpCodecCapability {
   virtual int channels() const override;
   virtual string sdp_fmtp_line() const override;
 
+  virtual string_view mime_type_view() const override;
+  virtual string_view sdp_fmtp_line_view() const override;
+
   webrtc::RtpCodecCapability rtp_codec_capability();
 
  private:
+  // Refreshes the strings the views point to; called by the constructors
+  // and setters, so the const accessors never write.
+  void UpdateViews();
+
   webrtc::RtpCodecCapability rtp_codec_capability_;
+  std::string mime_type_;
+  std::string sdp_fmtp_line_;
 };
 
 /**
@@ -50,6 +59,7 @@ class RTCRtpCodecCapabilityImpl : public RTCRtpCodecCapability {
 class RTCRtpCodecCapabilityListImpl : public RTCRtpCodecCapabilityList {
  public:
   RTCRtpCodecCapabilityListImpl(const vector<scoped_refptr<RTCRtpCodecCapability>>& source);
+  RTCRtpCodecCapabilityListImpl(vector<scoped_refptr<RTCRtpCodecCapability>>&& source);
   ~RTCRtpCodecCapabilityListImpl();
 };
 
@@ -79,6 +89,7 @@ class RTCRtpHeaderExtensionCapabilityImpl
 class RTCRtpHeaderExtensionCapabilityListImpl : public RTCRtpHeaderExtensionCapabilityList {
  public:
   RTCRtpHeaderExtensionCapabilityListImpl(const vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>& source);
+  RTCRtpHeaderExtensionCapabilityListImpl(vector<scoped_refptr<RTCRtpHeaderExtensionCapability>>&& source);
   ~RTCRtpHeaderExtensionCapabilityListImpl();
 };
 
@@ -136,12 +136,23 @@ scoped_refptr<RTCRtpEncodingParametersList> RTCRtpEncodingParametersList::Create
   return new RefCountedObject<RTCRtpEncodingParametersListImpl>(source);
 }
 
+scoped_refptr<RTCRtpEncodingParametersList> RTCRtpEncodingParametersList::Create(
+    vector<scoped_refptr<RTCRtpEncodingParameters>>&& source) {
+  return new RefCountedObject<RTCRtpEncodingParametersListImpl>(std::move(source));
+}
+
 RTCRtpEncodingParametersListImpl::RTCRtpEncodingParametersListImpl(
     const vector<scoped_refptr<RTCRtpEncodingParameters>>& source)
     : RTCRtpEncodingParametersList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpEncodingParametersListImpl::RTCRtpEncodingParametersListImpl(
+    vector<scoped_refptr<RTCRtpEncodingParameters>>&& source)
+    : RTCRtpEncodingParametersList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpEncodingParametersListImpl::~RTCRtpEncodingParametersListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -165,7 +176,7 @@ void RTCRtpParametersImpl::set_mid(const string mid) {
   rtp_parameters_.mid = to_std_string(mid);
 }
 
-const vector<scoped_refptr<RTCRtpCodecParameters>>
+vector<scoped_refptr<RTCRtpCodecParameters>>
 RTCRtpParametersImpl::codecs() {
   std::vector<scoped_refptr<RTCRtpCodecParameters>> vec;
   for (auto item : rtp_parameters_.codecs) {
@@ -184,7 +195,7 @@ void RTCRtpParametersImpl::set_codecs(
   rtp_parameters_.codecs = list;
 }
 
-const vector<scoped_refptr<RTCRtpExtension>>
+vector<scoped_refptr<RTCRtpExtension>>
 RTCRtpParametersImpl::header_extensions() {
   std::vector<scoped_refptr<RTCRtpExtension>> vec;
   for (auto item : rtp_parameters_.header_extensions) {
@@ -203,7 +214,7 @@ void RTCRtpParametersImpl::set_header_extensions(
   rtp_parameters_.header_extensions = list;
 }
 
-const vector<scoped_refptr<RTCRtpEncodingParameters>>
+vector<scoped_refptr<RTCRtpEncodingParameters>>
 RTCRtpParametersImpl::encodings() {
   std::vector<scoped_refptr<RTCRtpEncodingParameters>> vec;
   for (auto item : rtp_parameters_.encodings) {
@@ -325,12 +336,23 @@ scoped_refptr<RTCRtcpParametersList> RTCRtcpParametersList::Create(
   return new RefCountedObject<RTCRtcpParametersListImpl>(source);
 }
 
+scoped_refptr<RTCRtcpParametersList> RTCRtcpParametersList::Create(
+    vector<scoped_refptr<RTCRtcpParameters>>&& source) {
+  return new RefCountedObject<RTCRtcpParametersListImpl>(std::move(source));
+}
+
 RTCRtcpParametersListImpl::RTCRtcpParametersListImpl(
     const vector<scoped_refptr<RTCRtcpParameters>>& source)
     : RTCRtcpParametersList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtcpParametersListImpl::RTCRtcpParametersListImpl(
+    vector<scoped_refptr<RTCRtcpParameters>>&& source)
+    : RTCRtcpParametersList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtcpParametersListImpl::~RTCRtcpParametersListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -372,12 +394,23 @@ scoped_refptr<RTCRtpExtensionList> RTCRtpExtensionList::Create(
   return new RefCountedObject<RTCRtpExtensionListImpl>(source);
 }
 
+scoped_refptr<RTCRtpExtensionList> RTCRtpExtensionList::Create(
+    vector<scoped_refptr<RTCRtpExtension>>&& source) {
+  return new RefCountedObject<RTCRtpExtensionListImpl>(std::move(source));
+}
+
 RTCRtpExtensionListImpl::RTCRtpExtensionListImpl(
     const vector<scoped_refptr<RTCRtpExtension>>& source)
     : RTCRtpExtensionList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpExtensionListImpl::RTCRtpExtensionListImpl(
+    vector<scoped_refptr<RTCRtpExtension>>&& source)
+    : RTCRtpExtensionList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpExtensionListImpl::~RTCRtpExtensionListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -411,6 +444,11 @@ scoped_refptr<RTCRtpCodecParametersMap> RTCRtpCodecParametersMap::Create(
   return new RefCountedObject<RTCRtpCodecParametersMapImpl>(source);
 }
 
+scoped_refptr<RTCRtpCodecParametersMap> RTCRtpCodecParametersMap::Create(
+  vector<scoped_refptr<RTCRtpCodecParametersPair>>&& source) {
+  return new RefCountedObject<RTCRtpCodecParametersMapImpl>(std::move(source));
+}
+
 scoped_refptr<RTCRtpCodecParametersMap> RTCRtpCodecParametersMap::Create() {
   return new RefCountedObject<RTCRtpCodecParametersMapImpl>();
 }
@@ -426,6 +464,12 @@ RTCRtpCodecParametersMapImpl::RTCRtpCodecParametersMapImpl(
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpCodecParametersMapImpl::RTCRtpCodecParametersMapImpl(
+  vector<scoped_refptr<RTCRtpCodecParametersPair>>&& source)
+  : RTCRtpCodecParametersMap(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpCodecParametersMapImpl::~RTCRtpCodecParametersMapImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -507,7 +551,7 @@ void RTCRtpCodecParametersImpl::set_ptime(int value) {
   // rtp_codec_parameters_.ptime = value;
 }
 
-const vector<scoped_refptr<RTCRtcpFeedback>>
+vector<scoped_refptr<RTCRtcpFeedback>>
 RTCRtpCodecParametersImpl::rtcp_feedback() {
   std::vector<scoped_refptr<RTCRtcpFeedback>> vec;
   for (auto item : rtp_codec_parameters_.rtcp_feedback) {
@@ -577,12 +621,23 @@ scoped_refptr<RTCRtpCodecParametersList> RTCRtpCodecParametersList::Create(
   return new RefCountedObject<RTCRtpCodecParametersListImpl>(source);
 }
 
+scoped_refptr<RTCRtpCodecParametersList> RTCRtpCodecParametersList::Create(
+    vector<scoped_refptr<RTCRtpCodecParameters>>&& source) {
+  return new RefCountedObject<RTCRtpCodecParametersListImpl>(std::move(source));
+}
+
 RTCRtpCodecParametersListImpl::RTCRtpCodecParametersListImpl(
     const vector<scoped_refptr<RTCRtpCodecParameters>>& source)
     : RTCRtpCodecParametersList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpCodecParametersListImpl::RTCRtpCodecParametersListImpl(
+    vector<scoped_refptr<RTCRtpCodecParameters>>&& source)
+    : RTCRtpCodecParametersList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpCodecParametersListImpl::~RTCRtpCodecParametersListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -627,12 +682,23 @@ scoped_refptr<RTCRtcpFeedbackList> RTCRtcpFeedbackList::Create(
   return new RefCountedObject<RTCRtcpFeedbackListImpl>(source);
 }
 
+scoped_refptr<RTCRtcpFeedbackList> RTCRtcpFeedbackList::Create(
+    vector<scoped_refptr<RTCRtcpFeedback>>&& source) {
+  return new RefCountedObject<RTCRtcpFeedbackListImpl>(std::move(source));
+}
+
 RTCRtcpFeedbackListImpl::RTCRtcpFeedbackListImpl(
     const vector<scoped_refptr<RTCRtcpFeedback>>& source)
     : RTCRtcpFeedbackList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtcpFeedbackListImpl::RTCRtcpFeedbackListImpl(
+    vector<scoped_refptr<RTCRtcpFeedback>>&& source)
+    : RTCRtcpFeedbackList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtcpFeedbackListImpl::~RTCRtcpFeedbackListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
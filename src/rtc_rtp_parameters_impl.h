@@ -29,6 +29,7 @@ class RTCRtcpFeedbackImpl : public RTCRtcpFeedback {
 class RTCRtcpFeedbackListImpl : public RTCRtcpFeedbackList {
  public:
   RTCRtcpFeedbackListImpl(const vector<scoped_refptr<RTCRtcpFeedback>>& source);
+  RTCRtcpFeedbackListImpl(vector<scoped_refptr<RTCRtcpFeedback>>&& source);
   ~RTCRtcpFeedbackListImpl();
 };
 
@@ -49,6 +50,7 @@ class RTCRtpCodecParametersMapImpl : public RTCRtpCodecParametersMap {
  public:
   RTCRtpCodecParametersMapImpl();
   RTCRtpCodecParametersMapImpl(const vector<scoped_refptr<RTCRtpCodecParametersPair>>& source);
+  RTCRtpCodecParametersMapImpl(vector<scoped_refptr<RTCRtpCodecParametersPair>>&& source);
   ~RTCRtpCodecParametersMapImpl();
 
   virtual vector<std::pair<string, string>> to_parameters() override;
@@ -72,7 +74,7 @@ class RTCRtpCodecParametersImpl : public RTCRtpCodecParameters {
   virtual void set_max_ptime(int value) override;
   virtual int ptime() override;
   virtual void set_ptime(int value) override;
-  virtual const vector<scoped_refptr<RTCRtcpFeedback>> rtcp_feedback() override;
+  virtual vector<scoped_refptr<RTCRtcpFeedback>> rtcp_feedback() override;
   virtual void set_rtcp_feedback(
       vector<scoped_refptr<RTCRtcpFeedback>> rtcp_feedbacks) override;
   virtual const vector<std::pair<string, string>> parameters() override;
@@ -93,6 +95,7 @@ class RTCRtpCodecParametersImpl : public RTCRtpCodecParameters {
 class RTCRtpCodecParametersListImpl : public RTCRtpCodecParametersList {
  public:
   RTCRtpCodecParametersListImpl(const vector<scoped_refptr<RTCRtpCodecParameters>>& source);
+  RTCRtpCodecParametersListImpl(vector<scoped_refptr<RTCRtpCodecParameters>>&& source);
   ~RTCRtpCodecParametersListImpl();
 };
 
@@ -120,6 +123,7 @@ class RTCRtpExtensionImpl : public RTCRtpExtension {
 class RTCRtpExtensionListImpl : public RTCRtpExtensionList {
  public:
   RTCRtpExtensionListImpl(const vector<scoped_refptr<RTCRtpExtension>>& source);
+  RTCRtpExtensionListImpl(vector<scoped_refptr<RTCRtpExtension>>&& source);
   ~RTCRtpExtensionListImpl();
 };
 
@@ -150,6 +154,7 @@ class RTCRtcpParametersImpl : public RTCRtcpParameters {
 class RTCRtcpParametersListImpl : public RTCRtcpParametersList {
  public:
   RTCRtcpParametersListImpl(const vector<scoped_refptr<RTCRtcpParameters>>& source);
+  RTCRtcpParametersListImpl(vector<scoped_refptr<RTCRtcpParameters>>&& source);
   ~RTCRtcpParametersListImpl();
 };
 
@@ -161,14 +166,14 @@ class RTCRtpParametersImpl : public RTCRtpParameters {
   virtual void set_transaction_id(const string id) override;
   virtual const string mid() override;
   virtual void set_mid(const string mid) override;
-  virtual const vector<scoped_refptr<RTCRtpCodecParameters>> codecs() override;
+  virtual vector<scoped_refptr<RTCRtpCodecParameters>> codecs() override;
   virtual void set_codecs(
       const vector<scoped_refptr<RTCRtpCodecParameters>> codecs) override;
-  virtual const vector<scoped_refptr<RTCRtpExtension>> header_extensions()
+  virtual vector<scoped_refptr<RTCRtpExtension>> header_extensions()
       override;
   virtual void set_header_extensions(
       const vector<scoped_refptr<RTCRtpExtension>> header_extensions) override;
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>> encodings()
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>> encodings()
       override;
   virtual void set_encodings(
       const vector<scoped_refptr<RTCRtpEncodingParameters>> encodings) override;
@@ -249,6 +254,7 @@ class RTCRtpEncodingParametersImpl : public RTCRtpEncodingParameters {
 class RTCRtpEncodingParametersListImpl : public RTCRtpEncodingParametersList {
  public:
   RTCRtpEncodingParametersListImpl(const vector<scoped_refptr<RTCRtpEncodingParameters>>& source);
+  RTCRtpEncodingParametersListImpl(vector<scoped_refptr<RTCRtpEncodingParameters>>&& source);
   ~RTCRtpEncodingParametersListImpl();
 };
 
@@ -48,8 +48,11 @@ void RTCRtpReceiverObserverImpl::OnFirstPacketReceived(RTCMediaType media_type)
  */
 
 RTCRtpReceiverImpl::RTCRtpReceiverImpl(
-    rtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver)
-    : rtp_receiver_(rtp_receiver), observer_(nullptr) {}
+    rtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver,
+    rtc::scoped_refptr<RTCMediaStreamCache> stream_cache)
+    : rtp_receiver_(rtp_receiver),
+      stream_cache_(stream_cache),
+      observer_(nullptr) {}
 
 rtc::scoped_refptr<webrtc::RtpReceiverInterface>
 RTCRtpReceiverImpl::rtp_receiver() {
@@ -99,7 +102,7 @@ const vector<string> RTCRtpReceiverImpl::stream_ids() const {
 vector<scoped_refptr<RTCMediaStream>> RTCRtpReceiverImpl::streams() const {
   std::vector<scoped_refptr<RTCMediaStream>> streams;
   for (auto item : rtp_receiver_->streams()) {
-    streams.push_back(new RefCountedObject<MediaStreamImpl>(item));
+    streams.push_back(stream_cache_->GetOrCreate<MediaStreamImpl>(item));
   }
   return streams;
 }
@@ -136,12 +139,23 @@ scoped_refptr<RTCRtpReceiverList> RTCRtpReceiverList::Create(
   return new RefCountedObject<RTCRtpReceiverListImpl>(source);
 }
 
+scoped_refptr<RTCRtpReceiverList> RTCRtpReceiverList::Create(
+    vector<scoped_refptr<RTCRtpReceiver>>&& source) {
+  return new RefCountedObject<RTCRtpReceiverListImpl>(std::move(source));
+}
+
 RTCRtpReceiverListImpl::RTCRtpReceiverListImpl(
     const vector<scoped_refptr<RTCRtpReceiver>>& source)
     : RTCRtpReceiverList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpReceiverListImpl::RTCRtpReceiverListImpl(
+    vector<scoped_refptr<RTCRtpReceiver>>&& source)
+    : RTCRtpReceiverList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpReceiverListImpl::~RTCRtpReceiverListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -3,6 +3,7 @@
 
 #include "api/rtp_receiver_interface.h"
 #include "rtc_rtp_receiver.h"
+#include "rtc_wrapper_cache.h"
 
 namespace libwebrtc {
 
@@ -25,7 +26,8 @@ class RTCRtpReceiverImpl : public RTCRtpReceiver,
                            webrtc::RtpReceiverObserverInterface {
  public:
   RTCRtpReceiverImpl(
-      rtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver);
+      rtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver,
+      rtc::scoped_refptr<RTCMediaStreamCache> stream_cache);
 
   virtual scoped_refptr<RTCMediaTrack> track() const override;
   virtual scoped_refptr<RTCDtlsTransport> dtls_transport() const override;
@@ -43,6 +45,7 @@ class RTCRtpReceiverImpl : public RTCRtpReceiver,
 
  private:
   rtc::scoped_refptr<webrtc::RtpReceiverInterface> rtp_receiver_;
+  rtc::scoped_refptr<RTCMediaStreamCache> stream_cache_;
   RTCRtpReceiverObserver* observer_;
 
   virtual void OnFirstPacketReceived(cricket::MediaType media_type) override;
@@ -55,6 +58,7 @@ class RTCRtpReceiverImpl : public RTCRtpReceiver,
 class RTCRtpReceiverListImpl : public RTCRtpReceiverList {
  public:
   RTCRtpReceiverListImpl(const vector<scoped_refptr<RTCRtpReceiver>>& source);
+  RTCRtpReceiverListImpl(vector<scoped_refptr<RTCRtpReceiver>>&& source);
   ~RTCRtpReceiverListImpl();
 }; // end class RTCRtpReceiverListImpl
 
@@ -80,7 +80,7 @@ void RTCRtpSenderImpl::set_stream_ids(const vector<string> stream_ids) const {
   rtp_sender_->SetStreams(list);
 }
 
-const vector<scoped_refptr<RTCRtpEncodingParameters>>
+vector<scoped_refptr<RTCRtpEncodingParameters>>
 RTCRtpSenderImpl::init_send_encodings() const {
   std::vector<scoped_refptr<RTCRtpEncodingParameters>> vec;
   for (webrtc::RtpEncodingParameters item :
@@ -114,12 +114,23 @@ scoped_refptr<RTCRtpSenderList> RTCRtpSenderList::Create(
   return new RefCountedObject<RTCRtpSenderListImpl>(source);
 }
 
+scoped_refptr<RTCRtpSenderList> RTCRtpSenderList::Create(
+    vector<scoped_refptr<RTCRtpSender>>&& source) {
+  return new RefCountedObject<RTCRtpSenderListImpl>(std::move(source));
+}
+
 RTCRtpSenderListImpl::RTCRtpSenderListImpl(
     const vector<scoped_refptr<RTCRtpSender>>& source)
     : RTCRtpSenderList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpSenderListImpl::RTCRtpSenderListImpl(
+    vector<scoped_refptr<RTCRtpSender>>&& source)
+    : RTCRtpSenderList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpSenderListImpl::~RTCRtpSenderListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
@@ -19,7 +19,7 @@ class RTCRtpSenderImpl : public RTCRtpSender {
   virtual const string id() const override;
   virtual const vector<string> stream_ids() const override;
   virtual void set_stream_ids(const vector<string> stream_ids) const override;
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>>
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>>
   init_send_encodings() const override;
   virtual scoped_refptr<RTCRtpParameters> parameters() const override;
   virtual bool set_parameters(
@@ -40,6 +40,7 @@ class RTCRtpSenderImpl : public RTCRtpSender {
 class RTCRtpSenderListImpl : public RTCRtpSenderList {
  public:
   RTCRtpSenderListImpl(const vector<scoped_refptr<RTCRtpSender>>& source);
+  RTCRtpSenderListImpl(vector<scoped_refptr<RTCRtpSender>>&& source);
   ~RTCRtpSenderListImpl();
 }; // end class RTCRtpSenderListImpl
 
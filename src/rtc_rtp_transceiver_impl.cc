@@ -49,7 +49,7 @@ void RTCRtpTransceiverInitImpl::set_stream_ids(const vector<string> ids) {
   rtp_transceiver_init_.stream_ids = list;
 }
 
-const vector<scoped_refptr<RTCRtpEncodingParameters>>
+vector<scoped_refptr<RTCRtpEncodingParameters>>
 RTCRtpTransceiverInitImpl::send_encodings() {
   std::vector<scoped_refptr<RTCRtpEncodingParameters>> vec;
   for (auto item : rtp_transceiver_init_.send_encodings) {
@@ -69,8 +69,14 @@ void RTCRtpTransceiverInitImpl::set_send_encodings(
 }
 
 RTCRtpTransceiverImpl::RTCRtpTransceiverImpl(
-    rtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver)
-    : rtp_transceiver_(rtp_transceiver) {}
+    rtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver,
+    rtc::scoped_refptr<RTCRtpSenderCache> sender_cache,
+    rtc::scoped_refptr<RTCRtpReceiverCache> receiver_cache,
+    rtc::scoped_refptr<RTCMediaStreamCache> stream_cache)
+    : rtp_transceiver_(rtp_transceiver),
+      sender_cache_(sender_cache),
+      receiver_cache_(receiver_cache),
+      stream_cache_(stream_cache) {}
 
 rtc::scoped_refptr<webrtc::RtpTransceiverInterface>
 libwebrtc::RTCRtpTransceiverImpl::rtp_transceiver() {
@@ -78,17 +84,13 @@ libwebrtc::RTCRtpTransceiverImpl::rtp_transceiver() {
 }
 
 scoped_refptr<RTCRtpSender> RTCRtpTransceiverImpl::sender() const {
-  if (nullptr == rtp_transceiver_->sender().get()) {
-    return scoped_refptr<RTCRtpSender>();
-  }
-  return new RefCountedObject<RTCRtpSenderImpl>(rtp_transceiver_->sender());
+  return sender_cache_->GetOrCreate<RTCRtpSenderImpl>(
+      rtp_transceiver_->sender());
 }
 
 scoped_refptr<RTCRtpReceiver> RTCRtpTransceiverImpl::receiver() const {
-  if (nullptr == rtp_transceiver_->receiver().get()) {
-    return scoped_refptr<RTCRtpReceiver>();
-  }
-  return new RefCountedObject<RTCRtpReceiverImpl>(rtp_transceiver_->receiver());
+  return receiver_cache_->GetOrCreate<RTCRtpReceiverImpl>(
+      rtp_transceiver_->receiver(), stream_cache_);
 }
 
 bool RTCRtpTransceiverImpl::Stopped() const {
@@ -171,12 +173,23 @@ scoped_refptr<RTCRtpTransceiverList> RTCRtpTransceiverList::Create(
   return new RefCountedObject<RTCRtpTransceiverListImpl>(source);
 }
 
+scoped_refptr<RTCRtpTransceiverList> RTCRtpTransceiverList::Create(
+    vector<scoped_refptr<RTCRtpTransceiver>>&& source) {
+  return new RefCountedObject<RTCRtpTransceiverListImpl>(std::move(source));
+}
+
 RTCRtpTransceiverListImpl::RTCRtpTransceiverListImpl(
     const vector<scoped_refptr<RTCRtpTransceiver>>& source)
     : RTCRtpTransceiverList(source) {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
 }
 
+RTCRtpTransceiverListImpl::RTCRtpTransceiverListImpl(
+    vector<scoped_refptr<RTCRtpTransceiver>>&& source)
+    : RTCRtpTransceiverList(std::move(source)) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor ";
+}
+
 RTCRtpTransceiverListImpl::~RTCRtpTransceiverListImpl() {
   RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
 }
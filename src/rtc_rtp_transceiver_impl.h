@@ -4,6 +4,7 @@
 #include "api/rtp_transceiver_interface.h"
 #include "api/scoped_refptr.h"
 #include "rtc_rtp_transceiver.h"
+#include "rtc_wrapper_cache.h"
 
 namespace libwebrtc {
 class RTCRtpTransceiverInitImpl : public RTCRtpTransceiverInit {
@@ -14,7 +15,7 @@ class RTCRtpTransceiverInitImpl : public RTCRtpTransceiverInit {
   virtual void set_direction(RTCRtpTransceiverDirection value) override;
   virtual const vector<string> stream_ids() override;
   virtual void set_stream_ids(const vector<string> ids) override;
-  virtual const vector<scoped_refptr<RTCRtpEncodingParameters>> send_encodings()
+  virtual vector<scoped_refptr<RTCRtpEncodingParameters>> send_encodings()
       override;
   virtual void set_send_encodings(
       const vector<scoped_refptr<RTCRtpEncodingParameters>> send_encodings)
@@ -31,7 +32,10 @@ class RTCRtpTransceiverInitImpl : public RTCRtpTransceiverInit {
 class RTCRtpTransceiverImpl : public RTCRtpTransceiver {
  public:
   RTCRtpTransceiverImpl(
-      rtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver);
+      rtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver,
+      rtc::scoped_refptr<RTCRtpSenderCache> sender_cache,
+      rtc::scoped_refptr<RTCRtpReceiverCache> receiver_cache,
+      rtc::scoped_refptr<RTCMediaStreamCache> stream_cache);
 
   virtual RTCMediaType media_type() const override;
   virtual const string mid() const override;
@@ -53,6 +57,9 @@ class RTCRtpTransceiverImpl : public RTCRtpTransceiver {
 
  private:
   rtc::scoped_refptr<webrtc::RtpTransceiverInterface> rtp_transceiver_;
+  rtc::scoped_refptr<RTCRtpSenderCache> sender_cache_;
+  rtc::scoped_refptr<RTCRtpReceiverCache> receiver_cache_;
+  rtc::scoped_refptr<RTCMediaStreamCache> stream_cache_;
 };
 
 /**
@@ -61,6 +68,7 @@ class RTCRtpTransceiverImpl : public RTCRtpTransceiver {
 class RTCRtpTransceiverListImpl : public RTCRtpTransceiverList {
  public:
   RTCRtpTransceiverListImpl(const vector<scoped_refptr<RTCRtpTransceiver>>& source);
+  RTCRtpTransceiverListImpl(vector<scoped_refptr<RTCRtpTransceiver>>&& source);
   ~RTCRtpTransceiverListImpl();
 }; // end class RTCRtpTransceiverListImpl
 
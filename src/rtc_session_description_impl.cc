@@ -24,13 +24,14 @@ scoped_refptr<RTCSessionDescription> RTCSessionDescription::Create(
 
 RTCSessionDescriptionImpl::RTCSessionDescriptionImpl(
     std::unique_ptr<webrtc::SessionDescriptionInterface> description)
-    : description_(std::move(description)) {}
-
-const string RTCSessionDescriptionImpl::sdp() const {
-  description_->ToString((std::string*)&sdp_);
-  return sdp_;
+    : description_(std::move(description)) {
+  description_->ToString(&sdp_);
 }
 
+const string RTCSessionDescriptionImpl::sdp() const { return sdp_; }
+
+string_view RTCSessionDescriptionImpl::sdp_view() const { return sdp_; }
+
 RTCSessionDescription::SdpType RTCSessionDescriptionImpl::GetType() {
   return (RTCSessionDescription::SdpType)description_->GetType();
 }
@@ -14,6 +14,8 @@ class RTCSessionDescriptionImpl : public RTCSessionDescription {
 
   virtual const string sdp() const override;
 
+  virtual string_view sdp_view() const override;
+
   virtual SdpType GetType() override;
 
   virtual const string type() override;
@@ -26,6 +28,7 @@ class RTCSessionDescriptionImpl : public RTCSessionDescription {
 
  private:
   std::unique_ptr<webrtc::SessionDescriptionInterface> description_;
+  // Serialized once so that sdp_view() can hand it out.
   std::string sdp_;
   std::string type_;
 };
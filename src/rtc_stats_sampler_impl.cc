@@ -0,0 +1,278 @@
+#include "rtc_stats_sampler_impl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "api/stats/rtc_stats_collector_callback.h"
+#include "rtc_media_stream_impl.h"
+
+namespace libwebrtc {
+
+static const double kNoValue = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * Forwards a stats report to the sampler that requested it, if the sampler
+ * still exists.
+ */
+class StatsSamplerCollectorCallback
+    : public webrtc::RTCStatsCollectorCallback {
+ public:
+  StatsSamplerCollectorCallback(rtc::scoped_refptr<RTCStatsSamplerLink> link)
+      : link_(link) {}
+
+  void OnStatsDelivered(
+      const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report) override {
+    std::vector<RTCStatsSummary> summaries;
+    OnStatsSamplerSummary on_summary;
+    {
+      webrtc::MutexLock lock(&link_->mutex);
+      if (!link_->sampler) {
+        return;
+      }
+      link_->sampler->OnReport(report, &summaries, &on_summary);
+    }
+    if (on_summary) {
+      on_summary(summaries.data(), static_cast<int>(summaries.size()));
+    }
+  }
+
+ private:
+  rtc::scoped_refptr<RTCStatsSamplerLink> link_;
+};
+
+RTCStatsSamplerImpl::RTCStatsSamplerImpl(
+    rtc::Thread* signaling_thread,
+    rtc::scoped_refptr<webrtc::PeerConnectionInterface> rtc_peerconnection,
+    const RTCStatsSamplerConfig& config)
+    : thread_(signaling_thread),
+      link_(new rtc::RefCountedObject<RTCStatsSamplerLink>()),
+      interval_ms_(std::max(config.interval_ms, 1)),
+      capacity_(static_cast<size_t>(std::max(config.history_size, 1))),
+      rtc_peerconnection_(rtc_peerconnection) {
+  for (size_t i = 0; i < config.fields.size(); i++) {
+    const RTCStatsSamplerField& field = config.fields[i];
+    fields_.push_back(
+        {field.type.std_string(), field.member.std_string(), field.rate});
+  }
+  timestamps_.resize(capacity_, 0);
+  values_.resize(capacity_ * fields_.size(), kNoValue);
+  last_sums_.resize(fields_.size(), 0);
+  last_found_.resize(fields_.size(), false);
+  link_->sampler = this;
+}
+
+RTCStatsSamplerImpl::~RTCStatsSamplerImpl() {
+  running_ = false;
+  webrtc::MutexLock lock(&link_->mutex);
+  link_->sampler = nullptr;
+}
+
+bool RTCStatsSamplerImpl::Start() {
+  {
+    webrtc::MutexLock lock(&mutex_);
+    if (!rtc_peerconnection_) {
+      return false;
+    }
+  }
+  if (running_.exchange(true)) {
+    return true;
+  }
+  int generation = ++generation_;
+  rtc::scoped_refptr<RTCStatsSamplerLink> link = link_;
+  thread_->PostTask([link, generation] { Sample(link, generation); });
+  return true;
+}
+
+void RTCStatsSamplerImpl::Stop() {
+  running_ = false;
+  ++generation_;
+}
+
+void RTCStatsSamplerImpl::Detach() {
+  Stop();
+  webrtc::MutexLock lock(&mutex_);
+  rtc_peerconnection_ = nullptr;
+}
+
+void RTCStatsSamplerImpl::Clear() {
+  webrtc::MutexLock lock(&mutex_);
+  head_ = 0;
+  count_ = 0;
+  since_summary_ = 0;
+  last_timestamp_us_ = 0;
+  std::fill(last_found_.begin(), last_found_.end(), false);
+}
+
+int RTCStatsSamplerImpl::sample_count() const {
+  webrtc::MutexLock lock(&mutex_);
+  return static_cast<int>(count_);
+}
+
+void RTCStatsSamplerImpl::Sample(rtc::scoped_refptr<RTCStatsSamplerLink> link,
+                                 int generation) {
+  rtc::scoped_refptr<webrtc::PeerConnectionInterface> pc;
+  rtc::Thread* thread = nullptr;
+  int interval_ms = 0;
+  {
+    webrtc::MutexLock link_lock(&link->mutex);
+    RTCStatsSamplerImpl* sampler = link->sampler;
+    if (!sampler || generation != sampler->generation_) {
+      return;
+    }
+    RTC_DCHECK_RUN_ON(sampler->thread_);
+    thread = sampler->thread_;
+    interval_ms = sampler->interval_ms_;
+
+    webrtc::MutexLock lock(&sampler->mutex_);
+    // Skip the tick while the previous report is still being collected, so
+    // a short interval never queues up requests.
+    if (!sampler->pending_ && sampler->rtc_peerconnection_) {
+      pc = sampler->rtc_peerconnection_;
+      sampler->pending_ = true;
+    }
+  }
+  if (pc) {
+    pc->GetStats(rtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>(
+                     new rtc::RefCountedObject<StatsSamplerCollectorCallback>(
+                         link))
+                     .get());
+  }
+
+  thread->PostDelayedHighPrecisionTask(
+      [link, generation]() { Sample(link, generation); },
+      webrtc::TimeDelta::Millis(interval_ms));
+}
+
+void RTCStatsSamplerImpl::OnReport(
+    const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report,
+    std::vector<RTCStatsSummary>* summaries,
+    OnStatsSamplerSummary* on_summary) {
+  const size_t field_count = fields_.size();
+  std::vector<double> sums(field_count, 0);
+  std::vector<bool> found(field_count, false);
+  for (const webrtc::RTCStats& stats : *report) {
+    for (size_t i = 0; i < field_count; i++) {
+      double value = 0;
+      if (fields_[i].type == stats.type() &&
+          GetStatsNumber(stats, fields_[i].member.c_str(), &value)) {
+        sums[i] += value;
+        found[i] = true;
+      }
+    }
+  }
+
+  int64_t timestamp_us = report->timestamp().us();
+  webrtc::MutexLock lock(&mutex_);
+  pending_ = false;
+  if (!running_) {
+    return;
+  }
+
+  double elapsed_s = last_timestamp_us_ > 0
+                         ? (timestamp_us - last_timestamp_us_) / 1e6
+                         : 0;
+  double* row = values_.data() + head_ * field_count;
+  for (size_t i = 0; i < field_count; i++) {
+    if (!found[i]) {
+      row[i] = kNoValue;
+    } else if (!fields_[i].rate) {
+      row[i] = sums[i];
+    } else if (last_found_[i] && elapsed_s > 0) {
+      row[i] = (sums[i] - last_sums_[i]) / elapsed_s;
+    } else {
+      row[i] = kNoValue;
+    }
+  }
+  timestamps_[head_] = timestamp_us;
+  head_ = (head_ + 1) % capacity_;
+  count_ = std::min(count_ + 1, capacity_);
+
+  last_sums_.swap(sums);
+  last_found_.swap(found);
+  last_timestamp_us_ = timestamp_us;
+
+  if (on_summary_ && summary_every_ > 0 &&
+      ++since_summary_ >= summary_every_) {
+    since_summary_ = 0;
+    summaries->resize(field_count);
+    SummarizeLocked(summaries->data(), field_count);
+    *on_summary = on_summary_;
+  }
+}
+
+int RTCStatsSamplerImpl::GetHistory(int64_t* timestamps_us, double* values,
+                                    int max_samples) const {
+  if (max_samples <= 0) {
+    return 0;
+  }
+
+  const size_t field_count = fields_.size();
+  webrtc::MutexLock lock(&mutex_);
+  size_t count = std::min(count_, static_cast<size_t>(max_samples));
+  size_t first = (head_ + capacity_ - count) % capacity_;
+  for (size_t n = 0; n < count; n++) {
+    size_t slot = (first + n) % capacity_;
+    if (timestamps_us) {
+      timestamps_us[n] = timestamps_[slot];
+    }
+    if (values && field_count > 0) {
+      memcpy(values + n * field_count, values_.data() + slot * field_count,
+             field_count * sizeof(double));
+    }
+  }
+  return static_cast<int>(count);
+}
+
+int RTCStatsSamplerImpl::GetSummary(RTCStatsSummary* summaries,
+                                    int max_fields) const {
+  if (!summaries || max_fields <= 0) {
+    return 0;
+  }
+
+  size_t count = std::min(fields_.size(), static_cast<size_t>(max_fields));
+  webrtc::MutexLock lock(&mutex_);
+  SummarizeLocked(summaries, count);
+  return static_cast<int>(count);
+}
+
+void RTCStatsSamplerImpl::SetSummaryCallback(int every_samples,
+                                             OnStatsSamplerSummary callback) {
+  webrtc::MutexLock lock(&mutex_);
+  summary_every_ = callback ? every_samples : 0;
+  since_summary_ = 0;
+  on_summary_ = callback;
+}
+
+void RTCStatsSamplerImpl::SummarizeLocked(RTCStatsSummary* summaries,
+                                          size_t count) const {
+  const size_t field_count = fields_.size();
+  size_t first = (head_ + capacity_ - count_) % capacity_;
+  for (size_t i = 0; i < count; i++) {
+    RTCStatsSummary& summary = summaries[i];
+    summary.min = summary.max = summary.mean = summary.last = kNoValue;
+    summary.samples = 0;
+
+    double total = 0;
+    for (size_t n = 0; n < count_; n++) {
+      double value = values_[((first + n) % capacity_) * field_count + i];
+      if (value != value) {  // NaN
+        continue;
+      }
+      if (summary.samples == 0) {
+        summary.min = summary.max = value;
+      } else {
+        summary.min = std::min(summary.min, value);
+        summary.max = std::max(summary.max, value);
+      }
+      summary.last = value;
+      total += value;
+      summary.samples++;
+    }
+    if (summary.samples > 0) {
+      summary.mean = total / summary.samples;
+    }
+  }
+}
+
+}  // namespace libwebrtc
@@ -0,0 +1,124 @@
+#ifndef LIB_WEBRTC_RTC_STATS_SAMPLER_IMPL_HXX
+#define LIB_WEBRTC_RTC_STATS_SAMPLER_IMPL_HXX
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "api/peer_connection_interface.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread.h"
+#include "rtc_stats_sampler.h"
+
+namespace libwebrtc {
+
+class RTCStatsSamplerImpl;
+
+/**
+ * Lets in-flight stats requests reach the sampler without keeping it alive;
+ * the sampler clears |sampler| when it is destroyed.
+ */
+class RTCStatsSamplerLink : public rtc::RefCountInterface {
+ public:
+  webrtc::Mutex mutex;
+  RTCStatsSamplerImpl* sampler = nullptr;
+};
+
+/**
+ * class RTCStatsSamplerImpl
+ *
+ * Samples on the signaling thread shared by all connections of the factory;
+ * the scheduled ticks only hold the link.
+ */
+class RTCStatsSamplerImpl : public RTCStatsSampler {
+ public:
+  RTCStatsSamplerImpl(
+      rtc::Thread* signaling_thread,
+      rtc::scoped_refptr<webrtc::PeerConnectionInterface> rtc_peerconnection,
+      const RTCStatsSamplerConfig& config);
+  ~RTCStatsSamplerImpl();
+
+  bool Start() override;
+
+  void Stop() override;
+
+  bool IsRunning() const override { return running_; }
+
+  void Clear() override;
+
+  int interval_ms() const override { return interval_ms_; }
+
+  int field_count() const override { return static_cast<int>(fields_.size()); }
+
+  int capacity() const override { return static_cast<int>(capacity_); }
+
+  int sample_count() const override;
+
+  int GetHistory(int64_t* timestamps_us, double* values,
+                 int max_samples) const override;
+
+  int GetSummary(RTCStatsSummary* summaries, int max_fields) const override;
+
+  void SetSummaryCallback(int every_samples,
+                          OnStatsSamplerSummary callback) override;
+
+ public:
+  // Stops sampling and releases the peer connection. Called when the
+  // owning connection is closed; Start() fails afterwards.
+  void Detach();
+
+  // Lets the owning connection reach the sampler without keeping it alive.
+  rtc::scoped_refptr<RTCStatsSamplerLink> link() const { return link_; }
+
+  // Records |report| as the next sample. Called on the signaling thread.
+  // When a summary is due, fills |summaries| and |on_summary| for the caller
+  // to invoke once the link is unlocked.
+  void OnReport(const rtc::scoped_refptr<const webrtc::RTCStatsReport>& report,
+                std::vector<RTCStatsSummary>* summaries,
+                OnStatsSamplerSummary* on_summary);
+
+ private:
+  struct Field {
+    std::string type;
+    std::string member;
+    bool rate;
+  };
+
+  // Requests a report and schedules the next tick, unless the sampler is
+  // gone or |generation| was stopped.
+  static void Sample(rtc::scoped_refptr<RTCStatsSamplerLink> link,
+                     int generation);
+  // Requires |mutex_| to be held.
+  void SummarizeLocked(RTCStatsSummary* summaries, size_t count) const;
+
+ private:
+  rtc::Thread* const thread_;
+  rtc::scoped_refptr<RTCStatsSamplerLink> link_;
+  std::vector<Field> fields_;
+  const int interval_ms_;
+  const size_t capacity_;
+  std::atomic<bool> running_{false};
+  std::atomic<int> generation_{0};
+
+  // Guards the members below.
+  mutable webrtc::Mutex mutex_;
+  rtc::scoped_refptr<webrtc::PeerConnectionInterface> rtc_peerconnection_;
+  bool pending_ = false;
+  // Ring buffer of |capacity_| rows; |head_| is the next row to write.
+  std::vector<int64_t> timestamps_;
+  std::vector<double> values_;
+  size_t head_ = 0;
+  size_t count_ = 0;
+  // Raw sums of the previous report, for rate fields.
+  std::vector<double> last_sums_;
+  std::vector<bool> last_found_;
+  int64_t last_timestamp_us_ = 0;
+  int summary_every_ = 0;
+  int since_summary_ = 0;
+  OnStatsSamplerSummary on_summary_;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_STATS_SAMPLER_IMPL_HXX
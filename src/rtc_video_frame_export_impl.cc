@@ -0,0 +1,374 @@
+#include "rtc_video_frame_export_impl.h"
+
+#include <limits.h>
+#include <string.h>
+
+#include <algorithm>
+
+#if defined(WEBRTC_WIN)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(WEBRTC_LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "base/refcountedobject.h"
+#include "libyuv/convert_from.h"
+#include "libyuv/scale.h"
+#include "rtc_base/logging.h"
+#include "rtc_video_frame_impl.h"
+
+namespace libwebrtc {
+
+static const int kMaxExportDimension = 16384;
+static const int kMaxExportSlots = 16;
+
+static size_t Align64(size_t value) {
+  return (value + 63) & ~static_cast<size_t>(63);
+}
+
+// Fields of the shared header and slots that readers in other processes
+// synchronise on. They are plain integers in the public layout.
+template <typename T>
+static std::atomic<T>* AsAtomic(T* value) {
+  static_assert(sizeof(std::atomic<T>) == sizeof(T),
+                "std::atomic must have the size of the plain integer");
+  return reinterpret_cast<std::atomic<T>*>(value);
+}
+
+struct ExportPlanes {
+  uint32_t stride_y = 0;
+  uint32_t stride_u = 0;
+  uint32_t stride_v = 0;
+  uint32_t offset_u = 0;
+  uint32_t offset_v = 0;
+  size_t size = 0;
+};
+
+static ExportPlanes PlanesFor(RTCVideoFrameExportFormat format, int width,
+                              int height) {
+  ExportPlanes planes;
+  if (format == RTCVideoFrameExportFormat::kI420) {
+    size_t chroma_height = static_cast<size_t>((height + 1) / 2);
+    planes.stride_y = static_cast<uint32_t>(Align64(width));
+    planes.stride_u = planes.stride_v =
+        static_cast<uint32_t>(Align64((width + 1) / 2));
+    planes.offset_u =
+        static_cast<uint32_t>(Align64(planes.stride_y * size_t(height)));
+    planes.offset_v = static_cast<uint32_t>(
+        planes.offset_u + Align64(planes.stride_u * chroma_height));
+    planes.size = planes.offset_v + planes.stride_v * chroma_height;
+  } else {
+    planes.stride_y = static_cast<uint32_t>(Align64(width * 4));
+    planes.size = planes.stride_y * size_t(height);
+  }
+  return planes;
+}
+
+static bool IsValidFormat(RTCVideoFrameExportFormat format) {
+  switch (format) {
+    case RTCVideoFrameExportFormat::kARGB:
+    case RTCVideoFrameExportFormat::kBGRA:
+    case RTCVideoFrameExportFormat::kABGR:
+    case RTCVideoFrameExportFormat::kRGBA:
+    case RTCVideoFrameExportFormat::kI420:
+      return true;
+  }
+  return false;
+}
+
+scoped_refptr<RTCVideoFrameExport> RTCVideoFrameExport::Create(
+    const RTCVideoFrameExportConfig& config) {
+  scoped_refptr<RTCVideoFrameExportImpl> frame_export =
+      new RefCountedObject<RTCVideoFrameExportImpl>(config);
+  if (!frame_export->Initialize()) {
+    return scoped_refptr<RTCVideoFrameExport>();
+  }
+  return frame_export;
+}
+
+RTCVideoFrameExportImpl::RTCVideoFrameExportImpl(
+    const RTCVideoFrameExportConfig& config)
+    : name_(config.name.std_string()),
+      format_(config.format),
+      max_width_(config.max_width),
+      max_height_(config.max_height),
+      slot_count_(config.slot_count),
+      renderer_(RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>::Create()) {
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor " << (void*)this;
+}
+
+RTCVideoFrameExportImpl::~RTCVideoFrameExportImpl() {
+  Unmap();
+  RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
+}
+
+bool RTCVideoFrameExportImpl::Initialize() {
+  if (name_.empty() || !IsValidFormat(format_) || max_width_ < 2 ||
+      max_height_ < 2 || max_width_ > kMaxExportDimension ||
+      max_height_ > kMaxExportDimension || slot_count_ < 1 ||
+      slot_count_ > kMaxExportSlots) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": invalid configuration";
+    return false;
+  }
+
+  slot_size_ = kRTCVideoFrameExportSlotData +
+               Align64(PlanesFor(format_, max_width_, max_height_).size);
+  mapping_size_ = sizeof(RTCVideoFrameExportHeader) + slot_count_ * slot_size_;
+  if (slot_size_ > UINT32_MAX || !Map()) {
+    return false;
+  }
+
+  // A new mapping is zero filled: every slot sequence starts at 0 (empty).
+  RTCVideoFrameExportHeader* header =
+      reinterpret_cast<RTCVideoFrameExportHeader*>(mapping_);
+  header->version = kRTCVideoFrameExportVersion;
+  header->format = static_cast<uint32_t>(format_);
+  header->slot_count = static_cast<uint32_t>(slot_count_);
+  header->slot_size = static_cast<uint32_t>(slot_size_);
+  header->max_width = static_cast<uint32_t>(max_width_);
+  header->max_height = static_cast<uint32_t>(max_height_);
+  // Written last, so a reader that sees the magic sees the fields above.
+  AsAtomic(&header->magic)->store(kRTCVideoFrameExportMagic,
+                                  std::memory_order_release);
+  return true;
+}
+
+bool RTCVideoFrameExportImpl::Map() {
+#if defined(WEBRTC_WIN)
+  HANDLE handle = ::CreateFileMappingA(
+      INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+      static_cast<DWORD>(static_cast<uint64_t>(mapping_size_) >> 32),
+      static_cast<DWORD>(mapping_size_), name_.c_str());
+  if (handle == nullptr) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": CreateFileMapping(" << name_
+                      << ") failed: " << ::GetLastError();
+    return false;
+  }
+  if (::GetLastError() == ERROR_ALREADY_EXISTS) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": " << name_ << " is in use";
+    ::CloseHandle(handle);
+    return false;
+  }
+  void* view = ::MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0,
+                               mapping_size_);
+  if (view == nullptr) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": MapViewOfFile failed: "
+                      << ::GetLastError();
+    ::CloseHandle(handle);
+    return false;
+  }
+  mapping_handle_ = handle;
+  mapping_ = static_cast<uint8_t*>(view);
+  return true;
+#else
+  std::string shm_name = name_[0] == '/' ? name_ : "/" + name_;
+  int fd = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    // Possibly another live export; never take over its name.
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": " << shm_name << " is in use";
+    return false;
+  }
+  if (fd < 0) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": shm_open(" << shm_name
+                      << ") failed: " << errno;
+    return false;
+  }
+  void* view = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(mapping_size_)) == 0) {
+    view = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0);
+  }
+  if (view == MAP_FAILED) {
+    RTC_LOG(LS_ERROR) << __FUNCTION__ << ": mapping " << shm_name
+                      << " failed: " << errno;
+    close(fd);
+    shm_unlink(shm_name.c_str());
+    return false;
+  }
+  fd_ = fd;
+  mapping_ = static_cast<uint8_t*>(view);
+  return true;
+#endif
+}
+
+void RTCVideoFrameExportImpl::Unmap() {
+#if defined(WEBRTC_WIN)
+  if (mapping_) {
+    ::UnmapViewOfFile(mapping_);
+  }
+  if (mapping_handle_) {
+    ::CloseHandle(static_cast<HANDLE>(mapping_handle_));
+  }
+  mapping_handle_ = nullptr;
+#else
+  if (mapping_) {
+    munmap(mapping_, mapping_size_);
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    shm_unlink((name_[0] == '/' ? name_ : "/" + name_).c_str());
+  }
+  fd_ = -1;
+#endif
+  mapping_ = nullptr;
+}
+
+void RTCVideoFrameExportImpl::OnFrame(scoped_refptr<RTCVideoFrame> frame) {
+  if (frame && mapping_) {
+    webrtc::MutexLock lock(&mutex_);
+    WriteFrame(frame.get());
+  }
+  renderer_->OnFrame(frame);
+}
+
+void RTCVideoFrameExportImpl::RegisterFrameCallback(void* user_data,
+                                                    void* callback) {
+  renderer_->RegisterFrameCallback(user_data, callback);
+}
+
+void RTCVideoFrameExportImpl::RegisterFrameCallback(
+    OnFrameCallbackSafe callback) {
+  renderer_->RegisterFrameCallback(callback);
+}
+
+void RTCVideoFrameExportImpl::UnRegisterFrameCallback() {
+  renderer_->UnRegisterFrameCallback();
+}
+
+void RTCVideoFrameExportImpl::SetLatencyMeasurement(bool enable) {
+  renderer_->SetLatencyMeasurement(enable);
+}
+
+bool RTCVideoFrameExportImpl::GetLatencyStats(RTCVideoLatencyStats* stats) {
+  return renderer_->GetLatencyStats(stats);
+}
+
+int RTCVideoFrameExportImpl::GetFrameLatencies(int64_t* latencies_us,
+                                               int max_frames) {
+  return renderer_->GetFrameLatencies(latencies_us, max_frames);
+}
+
+void RTCVideoFrameExportImpl::ResetLatencyStats() {
+  renderer_->ResetLatencyStats();
+}
+
+void RTCVideoFrameExportImpl::FitWithin(int width, int height, int* out_width,
+                                        int* out_height) const {
+  if (width <= max_width_ && height <= max_height_) {
+    *out_width = width;
+    *out_height = height;
+    return;
+  }
+  double scale = std::min(static_cast<double>(max_width_) / width,
+                          static_cast<double>(max_height_) / height);
+  *out_width = std::max(2, static_cast<int>(width * scale) & ~1);
+  *out_height = std::max(2, static_cast<int>(height * scale) & ~1);
+}
+
+void RTCVideoFrameExportImpl::WriteFrame(RTCVideoFrame* frame) {
+  VideoFrameBufferImpl* frame_impl = static_cast<VideoFrameBufferImpl*>(frame);
+  rtc::scoped_refptr<webrtc::I420BufferInterface> i420 =
+      frame_impl->buffer()->ToI420();
+  if (!i420) {
+    return;
+  }
+  webrtc::VideoRotation rotation =
+      static_cast<const VideoFrameBufferImpl*>(frame_impl)->rotation();
+  if (rotation != webrtc::kVideoRotation_0) {
+    i420 = webrtc::I420Buffer::Rotate(*i420, rotation);
+  }
+
+  int width = 0;
+  int height = 0;
+  FitWithin(i420->width(), i420->height(), &width, &height);
+  ExportPlanes planes = PlanesFor(format_, width, height);
+
+  uint64_t n = ++sequence_;
+  uint8_t* slot_base = mapping_ + sizeof(RTCVideoFrameExportHeader) +
+                       ((n - 1) % slot_count_) * slot_size_;
+  RTCVideoFrameExportSlot* slot =
+      reinterpret_cast<RTCVideoFrameExportSlot*>(slot_base);
+  uint8_t* data = slot_base + kRTCVideoFrameExportSlotData;
+
+  AsAtomic(&slot->sequence)->store(2 * n - 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->timestamp_us = frame->timestamp_us();
+  slot->width = static_cast<uint32_t>(width);
+  slot->height = static_cast<uint32_t>(height);
+  slot->stride_y = planes.stride_y;
+  slot->stride_u = planes.stride_u;
+  slot->stride_v = planes.stride_v;
+  slot->offset_u = planes.offset_u;
+  slot->offset_v = planes.offset_v;
+
+  if (format_ == RTCVideoFrameExportFormat::kI420) {
+    // Scales, or copies when the size is unchanged, straight into the slot.
+    libyuv::I420Scale(i420->DataY(), i420->StrideY(), i420->DataU(),
+                      i420->StrideU(), i420->DataV(), i420->StrideV(),
+                      i420->width(), i420->height(), data, planes.stride_y,
+                      data + planes.offset_u, planes.stride_u,
+                      data + planes.offset_v, planes.stride_v, width, height,
+                      libyuv::kFilterBox);
+  } else {
+    if (width != i420->width() || height != i420->height()) {
+      if (!scaled_ || scaled_->width() != width ||
+          scaled_->height() != height) {
+        scaled_ = webrtc::I420Buffer::Create(width, height);
+      }
+      scaled_->ScaleFrom(*i420);
+      i420 = scaled_;
+    }
+    int stride = static_cast<int>(planes.stride_y);
+    switch (format_) {
+      case RTCVideoFrameExportFormat::kARGB:
+        libyuv::I420ToARGB(i420->DataY(), i420->StrideY(), i420->DataU(),
+                           i420->StrideU(), i420->DataV(), i420->StrideV(),
+                           data, stride, width, height);
+        break;
+      case RTCVideoFrameExportFormat::kBGRA:
+        libyuv::I420ToBGRA(i420->DataY(), i420->StrideY(), i420->DataU(),
+                           i420->StrideU(), i420->DataV(), i420->StrideV(),
+                           data, stride, width, height);
+        break;
+      case RTCVideoFrameExportFormat::kABGR:
+        libyuv::I420ToABGR(i420->DataY(), i420->StrideY(), i420->DataU(),
+                           i420->StrideU(), i420->DataV(), i420->StrideV(),
+                           data, stride, width, height);
+        break;
+      case RTCVideoFrameExportFormat::kRGBA:
+        libyuv::I420ToRGBA(i420->DataY(), i420->StrideY(), i420->DataU(),
+                           i420->StrideU(), i420->DataV(), i420->StrideV(),
+                           data, stride, width, height);
+        break;
+      default:
+        break;
+    }
+  }
+
+  AsAtomic(&slot->sequence)->store(2 * n, std::memory_order_release);
+
+  RTCVideoFrameExportHeader* header =
+      reinterpret_cast<RTCVideoFrameExportHeader*>(mapping_);
+  AsAtomic(&header->latest_slot)
+      ->store(static_cast<uint32_t>((n - 1) % slot_count_),
+              std::memory_order_relaxed);
+  AsAtomic(&header->latest_sequence)->store(n, std::memory_order_release);
+  AsAtomic(&header->frame_signal)
+      ->store(static_cast<uint32_t>(n), std::memory_order_release);
+#if defined(WEBRTC_LINUX)
+  syscall(SYS_futex, &header->frame_signal, FUTEX_WAKE, INT_MAX, nullptr,
+          nullptr, 0);
+#endif
+  frames_written_++;
+}
+
+}  // namespace libwebrtc
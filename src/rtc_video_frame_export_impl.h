@@ -0,0 +1,81 @@
+#ifndef LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_IMPL_HXX
+#define LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_IMPL_HXX
+
+#include <atomic>
+#include <string>
+
+#include "api/video/i420_buffer.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_video_frame_export.h"
+
+namespace libwebrtc {
+
+/**
+ * class RTCVideoFrameExportImpl
+ */
+class RTCVideoFrameExportImpl : public RTCVideoFrameExport {
+ public:
+  RTCVideoFrameExportImpl(const RTCVideoFrameExportConfig& config);
+  ~RTCVideoFrameExportImpl();
+
+  // Creates the shared memory and writes its header. Returns false if the
+  // configuration is invalid or the mapping cannot be created.
+  bool Initialize();
+
+  void OnFrame(scoped_refptr<RTCVideoFrame> frame) override;
+
+  void RegisterFrameCallback(void* user_data /* rtcObjectHandle */,
+                             void* callback /* rtcVideoRendererFrameDelegate */) override;
+  void RegisterFrameCallback(OnFrameCallbackSafe callback) override;
+  void UnRegisterFrameCallback() override;
+
+  void SetLatencyMeasurement(bool enable) override;
+  bool GetLatencyStats(RTCVideoLatencyStats* stats) override;
+  int GetFrameLatencies(int64_t* latencies_us, int max_frames) override;
+  void ResetLatencyStats() override;
+
+  const string name() const override { return name_; }
+
+  RTCVideoFrameExportFormat format() const override { return format_; }
+
+  size_t mapping_size() const override { return mapping_size_; }
+
+  uint64_t frames_written() const override { return frames_written_; }
+
+ private:
+  bool Map();
+  void Unmap();
+  // Requires |mutex_| to be held.
+  void WriteFrame(RTCVideoFrame* frame);
+  void FitWithin(int width, int height, int* out_width, int* out_height) const;
+
+ private:
+  const std::string name_;
+  const RTCVideoFrameExportFormat format_;
+  const int max_width_;
+  const int max_height_;
+  const int slot_count_;
+  // Renderer the frame callbacks are registered on.
+  scoped_refptr<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>> renderer_;
+  std::atomic<uint64_t> frames_written_{0};
+
+  size_t slot_size_ = 0;
+  size_t mapping_size_ = 0;
+  uint8_t* mapping_ = nullptr;
+#if defined(WEBRTC_WIN)
+  void* mapping_handle_ = nullptr;
+#else
+  int fd_ = -1;
+#endif
+
+  // Guards the members below.
+  webrtc::Mutex mutex_;
+  uint64_t sequence_ = 0;
+  // Scratch frame for scaling before an ARGB conversion; reused while the
+  // output size does not change.
+  rtc::scoped_refptr<webrtc::I420Buffer> scaled_;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_VIDEO_FRAME_EXPORT_IMPL_HXX
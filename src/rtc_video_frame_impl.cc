@@ -7,6 +7,7 @@
 #include "rtc_video_frame_impl.h"
 
 #include "api/video/i420_buffer.h"
+#include "src/internal/parallel_convert.h"
 #include "libyuv/convert.h"
 #include "libyuv/convert_argb.h"
 #include "libyuv/convert_from.h"
@@ -29,7 +30,7 @@ VideoFrameBufferImpl::~VideoFrameBufferImpl() {}
 scoped_refptr<RTCVideoFrame> VideoFrameBufferImpl::Copy() {
   scoped_refptr<VideoFrameBufferImpl> frame =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(buffer_));
+          new VideoFrameBufferImpl(buffer_));
   return frame;
 }
 
@@ -78,41 +79,16 @@ int VideoFrameBufferImpl::ConvertToARGB(RTCVideoFrameARGB* pDest)
   rtc::scoped_refptr<webrtc::I420Buffer> dest =
       webrtc::I420Buffer::Create(pDest->width, pDest->height);
 
-  dest->ScaleFrom(*i420.get());
+  ParallelI420Scale(*i420.get(), dest.get());
   // ARGB buffer size
   int buf_size = dest->width() * dest->height() * (32 >> 3);
   switch (pDest->type) {
     case RTCVideoFrameTypeARGB::kARGB:
-      libyuv::I420ToARGB(dest->DataY(), dest->StrideY(),
-                         dest->DataU(), dest->StrideU(),
-                         dest->DataV(), dest->StrideV(),
-                         pDest->data, pDest->stride,
-                         pDest->width,
-                         pDest->height);
-      break;
     case RTCVideoFrameTypeARGB::kBGRA:
-      libyuv::I420ToBGRA(dest->DataY(), dest->StrideY(),
-                         dest->DataU(), dest->StrideU(),
-                         dest->DataV(), dest->StrideV(),
-                         pDest->data, pDest->stride,
-                         pDest->width,
-                         pDest->height);
-      break;
     case RTCVideoFrameTypeARGB::kABGR:
-      libyuv::I420ToABGR(dest->DataY(), dest->StrideY(),
-                         dest->DataU(), dest->StrideU(),
-                         dest->DataV(), dest->StrideV(),
-                         pDest->data, pDest->stride,
-                         pDest->width,
-                         pDest->height);
-      break;
     case RTCVideoFrameTypeARGB::kRGBA:
-      libyuv::I420ToRGBA(dest->DataY(), dest->StrideY(),
-                         dest->DataU(), dest->StrideU(),
-                         dest->DataV(), dest->StrideV(),
-                         pDest->data, pDest->stride,
-                         pDest->width,
-                         pDest->height);
+      ParallelI420ToARGB(*dest.get(), pDest->type, pDest->data,
+                         pDest->stride);
       break;
     default:
       break;
@@ -139,7 +115,7 @@ int VideoFrameBufferImpl::ScaleFrom(scoped_refptr<RTCVideoFrame> source)
         *source_impl->buffer_.get(), 
         static_cast<webrtc::VideoRotation>(source_impl->rotation())
       );
-  i420->ScaleFrom(*i420_source.get());
+  ParallelI420Scale(*i420_source.get(), i420.get());
   buffer_ = i420;
 
   return size();
@@ -172,40 +148,10 @@ int VideoFrameBufferImpl::ScaleFrom(RTCVideoFrameARGB* source)
   rtc::scoped_refptr<webrtc::I420Buffer> i420_dst =
       webrtc::I420Buffer::Create(width(), height());
 
-  switch (source->type) {
-    case RTCVideoFrameTypeARGB::kARGB:
-      libyuv::ARGBToI420(source->data, source->stride,
-                         i420_src->MutableDataY(), i420_src->StrideY(),
-                         i420_src->MutableDataU(), i420_src->StrideU(),
-                         i420_src->MutableDataV(), i420_src->StrideV(),
-                         source->width, source->height);
-      break;
-    case RTCVideoFrameTypeARGB::kBGRA:
-      libyuv::BGRAToI420(source->data, source->stride,
-                         i420_src->MutableDataY(), i420_src->StrideY(),
-                         i420_src->MutableDataU(), i420_src->StrideU(),
-                         i420_src->MutableDataV(), i420_src->StrideV(),
-                         source->width, source->height);
-      break;
-    case RTCVideoFrameTypeARGB::kABGR:
-      libyuv::ABGRToI420(source->data, source->stride,
-                         i420_src->MutableDataY(), i420_src->StrideY(),
-                         i420_src->MutableDataU(), i420_src->StrideU(),
-                         i420_src->MutableDataV(), i420_src->StrideV(),
-                         source->width, source->height);
-      break;
-    case RTCVideoFrameTypeARGB::kRGBA:
-      libyuv::RGBAToI420(source->data, source->stride,
-                         i420_src->MutableDataY(), i420_src->StrideY(),
-                         i420_src->MutableDataU(), i420_src->StrideU(),
-                         i420_src->MutableDataV(), i420_src->StrideV(),
-                         source->width, source->height);
-      break;
-    default:
-      break;
-  }
+  ParallelARGBToI420(source->type, source->data, source->stride,
+                     i420_src.get());
 
-  i420_dst->ScaleFrom(*i420_src.get());
+  ParallelI420Scale(*i420_src.get(), i420_dst.get());
   buffer_ = i420_dst;
 
   return size();
@@ -268,7 +214,7 @@ int VideoFrameBufferImpl::ScaleFrom(RTCVideoFrameYUV* source)
       return 0; // error
     }
 
-    i420_dst->ScaleFrom(*i420_src.get());
+    ParallelI420Scale(*i420_src.get(), i420_dst.get());
     buffer_ = i420_dst;
 
     return size();
@@ -385,7 +331,7 @@ scoped_refptr<RTCVideoFrame> RTCVideoFrame::Create(int width, int height) {
   
   scoped_refptr<VideoFrameBufferImpl> frame =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(i420_buffer));
+          new VideoFrameBufferImpl(i420_buffer));
   return frame;
 }
 
@@ -410,7 +356,7 @@ scoped_refptr<RTCVideoFrame> RTCVideoFrame::Create(int width, int height,
 
   scoped_refptr<VideoFrameBufferImpl> frame =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(i420_buffer));
+          new VideoFrameBufferImpl(i420_buffer));
   return frame;
 }
 
@@ -422,7 +368,7 @@ scoped_refptr<RTCVideoFrame> RTCVideoFrame::Create(
 
   scoped_refptr<VideoFrameBufferImpl> frame =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(i420_buffer));
+          new VideoFrameBufferImpl(i420_buffer));
   return frame;
 }
 
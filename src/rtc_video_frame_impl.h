@@ -10,12 +10,13 @@
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_rotation.h"
+#include "base/refcountedobject.h"
 #include "common_video/include/video_frame_buffer.h"
 #include "rtc_video_frame.h"
 
 namespace libwebrtc {
 
-class VideoFrameBufferImpl : public RTCVideoFrame {
+class VideoFrameBufferImpl final : public RefCountedFinal<RTCVideoFrame> {
  public:
   VideoFrameBufferImpl(
       rtc::scoped_refptr<webrtc::VideoFrameBuffer> frame_buffer);
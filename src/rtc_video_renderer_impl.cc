@@ -2,12 +2,12 @@
 
 #include "interop_api.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
 
 namespace libwebrtc {
 
 RTCVideoRendererImpl::RTCVideoRendererImpl()
-    : user_data_(nullptr)
-    , callback_(nullptr)
+    : callback_(nullptr)
     , callback_safe_(nullptr)
 {
     RTC_LOG(LS_INFO) << __FUNCTION__ << ": ctor " << (void*)this;
@@ -15,7 +15,6 @@ RTCVideoRendererImpl::RTCVideoRendererImpl()
 
 RTCVideoRendererImpl::~RTCVideoRendererImpl()
 {
-    user_data_ = nullptr;
     callback_ = nullptr;
     callback_safe_ = nullptr;
     RTC_LOG(LS_INFO) << __FUNCTION__ << ": dtor ";
@@ -23,9 +22,15 @@ RTCVideoRendererImpl::~RTCVideoRendererImpl()
 
 void RTCVideoRendererImpl::OnFrame(scoped_refptr<RTCVideoFrame> frame)
 {
+    // Read before the callbacks, which may hold on to the frame for a while
+    // or hand it over to the application.
+    if (measure_latency_ && frame) {
+        latency_tracker_.OnFrame(*frame, rtc::TimeMicros());
+    }
+
     if (callback_) {
         void* pFrame = static_cast<void*>(frame.release());
-        callback_(user_data_, pFrame);
+        callback_(pFrame);
     }
     else if (callback_safe_) {
         callback_safe_(frame);
@@ -35,15 +40,14 @@ void RTCVideoRendererImpl::OnFrame(scoped_refptr<RTCVideoFrame> frame)
 void RTCVideoRendererImpl::RegisterFrameCallback(void* user_data /* rtcObjectHandle */, void* callback /* rtcVideoRendererFrameDelegate */)
 {
     RTC_LOG(LS_INFO) << __FUNCTION__ << ": RegisterFrameCallback " << callback;
-    user_data_ = user_data;
-    callback_ = reinterpret_cast<rtcVideoRendererFrameDelegate>(callback);
+    callback_ = OnFrameCallback(
+        reinterpret_cast<rtcVideoRendererFrameDelegate>(callback), user_data);
     callback_safe_ = nullptr;
 }
 
 void RTCVideoRendererImpl::RegisterFrameCallback(OnFrameCallbackSafe callback)
 {
     RTC_LOG(LS_INFO) << __FUNCTION__ << ": RegisterFrameCallback (Safe)";
-    user_data_ = nullptr;
     callback_ = nullptr;
     callback_safe_ = callback;
 }
@@ -51,11 +55,37 @@ void RTCVideoRendererImpl::RegisterFrameCallback(OnFrameCallbackSafe callback)
 void RTCVideoRendererImpl::UnRegisterFrameCallback()
 {
     RTC_LOG(LS_INFO) << __FUNCTION__;
-    user_data_ = nullptr;
     callback_ = nullptr;
     callback_safe_ = nullptr;
 }
 
+void RTCVideoRendererImpl::SetLatencyMeasurement(bool enable)
+{
+    if (enable && !measure_latency_) {
+        latency_tracker_.Reset();
+    }
+    measure_latency_ = enable;
+}
+
+bool RTCVideoRendererImpl::GetLatencyStats(RTCVideoLatencyStats* stats)
+{
+    if (!stats || !measure_latency_) {
+        return false;
+    }
+    latency_tracker_.GetStats(stats);
+    return true;
+}
+
+int RTCVideoRendererImpl::GetFrameLatencies(int64_t* latencies_us, int max_frames)
+{
+    return latency_tracker_.GetFrameLatencies(latencies_us, max_frames);
+}
+
+void RTCVideoRendererImpl::ResetLatencyStats()
+{
+    latency_tracker_.Reset();
+}
+
 template <>
 scoped_refptr<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>> RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>::Create()
 {
@@ -1,14 +1,20 @@
 #ifndef LIB_WEBRTC_VIDEO_RENDERER_IMPL_HXX
 #define LIB_WEBRTC_VIDEO_RENDERER_IMPL_HXX
 
+#include <atomic>
+
+#include "interop_api.h"
 #include "rtc_video_renderer.h"
 #include "rtc_video_frame.h"
+#include "src/internal/frame_latency_tracker.h"
 
 namespace libwebrtc {
 
 class RTCVideoRendererImpl : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame>> {
  public:
-  typedef fixed_size_function<void(void* user_data /* rtcObjectHandle */, void* frame /* rtcVideoFrameHandle */)> OnFrameCallback;
+  // Called once per frame; the delegate is invoked directly with its
+  // user_data.
+  typedef context_function<rtcVideoRendererFrameDelegate> OnFrameCallback;
 
  public:
   RTCVideoRendererImpl();
@@ -19,11 +25,17 @@ class RTCVideoRendererImpl : public RTCVideoRenderer<scoped_refptr<RTCVideoFrame
   void RegisterFrameCallback(void* user_data /* rtcObjectHandle */, void* callback /* rtcVideoRendererFrameDelegate */) override;
   void RegisterFrameCallback(OnFrameCallbackSafe callback) override;
   void UnRegisterFrameCallback() override;
+
+  void SetLatencyMeasurement(bool enable) override;
+  bool GetLatencyStats(RTCVideoLatencyStats* stats) override;
+  int GetFrameLatencies(int64_t* latencies_us, int max_frames) override;
+  void ResetLatencyStats() override;
  
  private:
-  void* user_data_ = nullptr;
   OnFrameCallback callback_ = nullptr;
   OnFrameCallbackSafe callback_safe_ = nullptr;
+  std::atomic<bool> measure_latency_{false};
+  FrameLatencyTracker latency_tracker_;
 }; // end class RTCVideoRendererImpl
 
 } // end namespace libwebrtc
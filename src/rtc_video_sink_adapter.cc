@@ -22,7 +22,7 @@ VideoSinkAdapter::~VideoSinkAdapter() {
 void VideoSinkAdapter::OnFrame(const webrtc::VideoFrame& video_frame) {
   scoped_refptr<VideoFrameBufferImpl> frame_buffer =
       scoped_refptr<VideoFrameBufferImpl>(
-          new RefCountedObject<VideoFrameBufferImpl>(
+          new VideoFrameBufferImpl(
               video_frame.video_frame_buffer()));
 
   frame_buffer->set_rotation(video_frame.rotation());
@@ -28,6 +28,10 @@ class VideoTrackImpl : public RTCVideoTrack {
 
   virtual const string id() const override { return id_; }
 
+  virtual string_view kind_view() const override { return kind_; }
+
+  virtual string_view id_view() const override { return id_; }
+
   virtual bool enabled() const override { return rtc_track_->enabled(); }
 
   virtual bool set_enabled(bool enable) override {
@@ -0,0 +1,115 @@
+#ifndef LIB_WEBRTC_RTC_WRAPPER_CACHE_HXX
+#define LIB_WEBRTC_RTC_WRAPPER_CACHE_HXX
+
+#include <unordered_map>
+#include <utility>
+
+#include "api/media_stream_interface.h"
+#include "api/rtp_transceiver_interface.h"
+#include "api/scoped_refptr.h"
+#include "base/refcountedobject.h"
+#include "rtc_base/ref_count.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_media_stream.h"
+#include "rtc_rtp_transceiver.h"
+#include "rtc_types.h"
+
+namespace libwebrtc {
+
+/**
+ * class RTCWrapperCache
+ *
+ * Identity map from a native object to its live wrapper, so the same native
+ * transceiver, receiver, sender or stream is always handed out as the same
+ * wrapper. Entries are weak: the map does not keep wrappers alive, a wrapper
+ * removes its entry when it is destroyed.
+ */
+template <class Native, class Wrapper>
+class RTCWrapperCache : public rtc::RefCountInterface {
+ public:
+  /**
+   * Returns the live wrapper of |native|, or creates one of type |Impl|
+   * from |native| and |args|.
+   */
+  template <class Impl, class... Args>
+  scoped_refptr<Wrapper> GetOrCreate(rtc::scoped_refptr<Native> native,
+                                     Args&&... args);
+
+  /**
+   * Removes the entry of |native| if it still refers to |wrapper|.
+   */
+  void Erase(const Native* native, const Wrapper* wrapper) {
+    webrtc::MutexLock lock(&mutex_);
+    auto it = wrappers_.find(native);
+    if (it != wrappers_.end() && it->second == wrapper) {
+      wrappers_.erase(it);
+    }
+  }
+
+ private:
+  webrtc::Mutex mutex_;
+  std::unordered_map<const Native*, Wrapper*> wrappers_;
+};
+
+/**
+ * Reference counted wrapper that unregisters itself from its cache.
+ */
+template <class Impl, class Native, class Wrapper>
+class RTCCachedWrapper : public RefCountedObject<Impl> {
+ public:
+  template <class... Args>
+  RTCCachedWrapper(
+      rtc::scoped_refptr<RTCWrapperCache<Native, Wrapper>> cache,
+      rtc::scoped_refptr<Native> native, Args&&... args)
+      : RefCountedObject<Impl>(native, std::forward<Args>(args)...),
+        cache_(cache),
+        native_(native.get()) {}
+
+ protected:
+  ~RTCCachedWrapper() override { cache_->Erase(native_, this); }
+
+ private:
+  rtc::scoped_refptr<RTCWrapperCache<Native, Wrapper>> cache_;
+  const Native* native_;
+};
+
+template <class Native, class Wrapper>
+template <class Impl, class... Args>
+scoped_refptr<Wrapper> RTCWrapperCache<Native, Wrapper>::GetOrCreate(
+    rtc::scoped_refptr<Native> native, Args&&... args) {
+  if (!native) {
+    return scoped_refptr<Wrapper>();
+  }
+
+  webrtc::MutexLock lock(&mutex_);
+  auto it = wrappers_.find(native.get());
+  if (it != wrappers_.end()) {
+    // A wrapper whose count was already zero is being destroyed and is
+    // blocked in Erase() on |mutex_|; leave it alone and replace the entry.
+    Wrapper* wrapper = it->second;
+    if (wrapper->AddRef() > 1) {
+      scoped_refptr<Wrapper> result = wrapper;
+      wrapper->Release();
+      return result;
+    }
+  }
+
+  Wrapper* wrapper = new RTCCachedWrapper<Impl, Native, Wrapper>(
+      rtc::scoped_refptr<RTCWrapperCache<Native, Wrapper>>(this), native,
+      std::forward<Args>(args)...);
+  wrappers_[native.get()] = wrapper;
+  return scoped_refptr<Wrapper>(wrapper);
+}
+
+typedef RTCWrapperCache<webrtc::RtpTransceiverInterface, RTCRtpTransceiver>
+    RTCRtpTransceiverCache;
+typedef RTCWrapperCache<webrtc::RtpReceiverInterface, RTCRtpReceiver>
+    RTCRtpReceiverCache;
+typedef RTCWrapperCache<webrtc::RtpSenderInterface, RTCRtpSender>
+    RTCRtpSenderCache;
+typedef RTCWrapperCache<webrtc::MediaStreamInterface, RTCMediaStream>
+    RTCMediaStreamCache;
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_RTC_WRAPPER_CACHE_HXX
@@ -0,0 +1,99 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "rtc_audio_data.h"
+#include "src/internal/audio_util.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+// Arguments: source rate, source channels, source bits, destination rate,
+// destination channels, destination bits. The first row matches both sides
+// and takes the direct copy path.
+void ScaleArgs(benchmark::internal::Benchmark* b) {
+  const int formats[][6] = {{48000, 2, 16, 48000, 2, 16},
+                            {48000, 2, 16, 16000, 1, 16},
+                            {44100, 2, 16, 48000, 2, 16},
+                            {48000, 1, 16, 48000, 2, 16},
+                            {48000, 2, 16, 48000, 2, 32},
+                            {48000, 2, 32, 48000, 2, 16}};
+  for (const auto& f : formats) {
+    b->Args({f[0], f[1], f[2], f[3], f[4], f[5]});
+  }
+  b->ArgNames({"src_hz", "src_ch", "src_bits", "dst_hz", "dst_ch",
+               "dst_bits"});
+}
+
+// Arguments: sample rate, channels, bits per sample, tone frequency.
+void ClearArgs(benchmark::internal::Benchmark* b) {
+  for (int rate : {16000, 48000}) {
+    for (int channels : {1, 2}) {
+      for (int bits : {16, 24, 32}) {
+        for (RTCAudioDataToneFrequency tone :
+             {RTCAudioDataToneFrequency::kNone,
+              RTCAudioDataToneFrequency::kTone1kHz}) {
+          b->Args({rate, channels, bits, static_cast<int>(tone)});
+        }
+      }
+    }
+  }
+  b->ArgNames({"hz", "ch", "bits", "tone"});
+}
+
+// A 10 ms chunk of the format in arguments |first|..|first + 2|, holding a
+// 440 Hz tone.
+scoped_refptr<RTCAudioData> ToneChunk(const benchmark::State& state,
+                                      int first) {
+  scoped_refptr<RTCAudioData> data = RTCAudioData::Create(
+      0, nullptr, static_cast<uint32_t>(state.range(first + 2)),
+      static_cast<int>(state.range(first)),
+      static_cast<uint32_t>(state.range(first + 1)));
+  data->Clear(RTCAudioDataToneFrequency::kTone440Hz);
+  return data;
+}
+
+void BM_AudioDataScaleFrom(benchmark::State& state) {
+  scoped_refptr<RTCAudioData> source = ToneChunk(state, 0);
+  scoped_refptr<RTCAudioData> dest = ToneChunk(state, 3);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dest->ScaleFrom(source));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * source->data_size());
+}
+BENCHMARK(BM_AudioDataScaleFrom)->Apply(ScaleArgs);
+
+// AudioScale() on raw buffers, without the RTCAudioData wrapper around it.
+void BM_AudioScale(benchmark::State& state) {
+  scoped_refptr<RTCAudioData> source = ToneChunk(state, 0);
+  scoped_refptr<RTCAudioData> dest = ToneChunk(state, 3);
+  std::vector<uint8_t> out(dest->data_size());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(AudioScale(
+        out.data(), dest->bits_per_sample(), dest->samples_per_channel(),
+        dest->sample_rate_hz(), dest->num_channels(), source->data(),
+        source->bits_per_sample(), source->samples_per_channel(),
+        source->sample_rate_hz(), source->num_channels()));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * source->data_size());
+}
+BENCHMARK(BM_AudioScale)->Apply(ScaleArgs);
+
+void BM_AudioDataClear(benchmark::State& state) {
+  scoped_refptr<RTCAudioData> data = ToneChunk(state, 0);
+  const RTCAudioDataToneFrequency tone =
+      static_cast<RTCAudioDataToneFrequency>(state.range(3));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data->Clear(tone));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * data->data_size());
+}
+BENCHMARK(BM_AudioDataClear)->Apply(ClearArgs);
+
+}  // namespace
@@ -0,0 +1,43 @@
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Runs like BENCHMARK_MAIN(), but unless --benchmark_out is given also
+// writes the results as JSON to <executable name>.json, so every run leaves
+// a file that can be compared against the one from the previous release.
+int main(int argc, char** argv) {
+  std::vector<char*> args(argv, argv + argc);
+  bool has_out = false;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--benchmark_out=", 16) == 0) {
+      has_out = true;
+    }
+  }
+
+  std::string name = argc > 0 ? argv[0] : "libwebrtc_benchmarks";
+  size_t slash = name.find_last_of("/\\");
+  if (slash != std::string::npos) {
+    name = name.substr(slash + 1);
+  }
+  size_t ext = name.rfind(".exe");
+  if (ext != std::string::npos && ext + 4 == name.size()) {
+    name = name.substr(0, ext);
+  }
+  std::string out = "--benchmark_out=" + name + ".json";
+  std::string out_format = "--benchmark_out_format=json";
+  if (!has_out) {
+    args.push_back(&out[0]);
+    args.push_back(&out_format[0]);
+  }
+
+  int args_count = static_cast<int>(args.size());
+  benchmark::Initialize(&args_count, args.data());
+  if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libwebrtc.h"
+#include "rtc_video_frame.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+// Arguments: frame width, frame height, conversion threads.
+void ConversionArgs(benchmark::internal::Benchmark* b) {
+  const int sizes[][2] = {
+      {1280, 720}, {1920, 1080}, {2560, 1440}, {3840, 2160}};
+  for (const auto& size : sizes) {
+    for (int threads : {1, 2, 4, 8}) {
+      b->Args({size[0], size[1], threads});
+    }
+  }
+  b->ArgNames({"width", "height", "threads"})->UseRealTime();
+}
+
+class ParallelConversionScope {
+ public:
+  explicit ParallelConversionScope(int threads) {
+    LibWebRTC::SetParallelConversion(threads, 0);
+  }
+  ~ParallelConversionScope() { LibWebRTC::SetParallelConversion(1); }
+};
+
+// I420 to ARGB at the same size, as a renderer reading remote frames does.
+void BM_ConvertToARGB(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  ParallelConversionScope scope(static_cast<int>(state.range(2)));
+
+  scoped_refptr<RTCVideoFrame> frame = RTCVideoFrame::Create(width, height);
+  frame->Clear(RTCVideoFrameClearType::kColorBar);
+  std::vector<uint8_t> argb(static_cast<size_t>(width) * height * 4);
+  RTCVideoFrameARGB dest;
+  dest.type = RTCVideoFrameTypeARGB::kBGRA;
+  dest.width = width;
+  dest.height = height;
+  dest.data = argb.data();
+  dest.stride = width * 4;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ConvertToARGB(&dest));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * argb.size());
+}
+BENCHMARK(BM_ConvertToARGB)->Apply(ConversionArgs);
+
+// ARGB to I420 and a half-size scale, as a desktop capture feeding a
+// smaller encode does.
+void BM_ScaleFromARGB(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  ParallelConversionScope scope(static_cast<int>(state.range(2)));
+
+  std::vector<uint8_t> argb(static_cast<size_t>(width) * height * 4, 0x80);
+  RTCVideoFrameARGB source;
+  source.type = RTCVideoFrameTypeARGB::kARGB;
+  source.width = width;
+  source.height = height;
+  source.data = argb.data();
+  source.stride = width * 4;
+  scoped_refptr<RTCVideoFrame> frame =
+      RTCVideoFrame::Create(width / 2, height / 2);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ScaleFrom(&source));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * argb.size());
+}
+BENCHMARK(BM_ScaleFromARGB)->Apply(ConversionArgs);
+
+}  // namespace
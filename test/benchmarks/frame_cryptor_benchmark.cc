@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "api/crypto/frame_crypto_transformer.h"
+#include "api/frame_transformer_interface.h"
+#include "benchmark/benchmark.h"
+#include "openssl/aead.h"
+#include "rtc_base/event.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+#include "src/internal/snapshot_key_provider.h"
+
+using libwebrtc::SnapshotKeyProvider;
+using webrtc::FrameCryptorTransformer;
+
+namespace {
+
+const char kParticipant[] = "benchmark";
+
+// Key ring sizes of rtc_frame_cryptor.h: DEFAULT_KEYRING_SIZE and
+// MAX_KEYRING_SIZE.
+const int kDefaultKeyRingSize = 16;
+const int kMaxKeyRingSize = 255;
+
+/**
+ * Encoded frame with a synthetic payload. Only the members every
+ * transformable frame has are implemented, so the transformer treats it as
+ * an audio frame: one byte of header left in the clear, the rest encrypted.
+ */
+class SyntheticFrame : public webrtc::TransformableFrameInterface {
+ public:
+  SyntheticFrame(std::vector<uint8_t> data, Direction direction)
+      : data_(std::move(data)), direction_(direction) {}
+
+  rtc::ArrayView<const uint8_t> GetData() const override { return data_; }
+
+  void SetData(rtc::ArrayView<const uint8_t> data) override {
+    data_.assign(data.begin(), data.end());
+  }
+
+  uint8_t GetPayloadType() const override { return 111; }
+  uint32_t GetSsrc() const override { return 1; }
+  uint32_t GetTimestamp() const override { return timestamp_; }
+  void SetRTPTimestamp(uint32_t timestamp) override { timestamp_ = timestamp; }
+  Direction GetDirection() const override { return direction_; }
+  std::string GetMimeType() const override { return "audio/opus"; }
+
+ private:
+  std::vector<uint8_t> data_;
+  Direction direction_;
+  uint32_t timestamp_ = 0;
+};
+
+/**
+ * Receives the transformed frames and timestamps them.
+ */
+class FrameSink : public webrtc::TransformedFrameCallback {
+ public:
+  void OnTransformedFrame(
+      std::unique_ptr<webrtc::TransformableFrameInterface> frame) override {
+    done_us_ = rtc::TimeMicros();
+    frame_ = std::move(frame);
+    event_.Set();
+  }
+
+  // Waits for the frame passed to Transform() and returns it.
+  std::unique_ptr<webrtc::TransformableFrameInterface> Wait() {
+    event_.Wait(rtc::Event::kForever);
+    return std::move(frame_);
+  }
+
+  int64_t done_us() const { return done_us_; }
+
+ private:
+  rtc::Event event_;
+  std::unique_ptr<webrtc::TransformableFrameInterface> frame_;
+  int64_t done_us_ = 0;
+};
+
+/**
+ * A transformer set up the way RTCFrameCryptorImpl sets one up, with the
+ * SnapshotKeyProvider that KeyProvider::Create() wraps. Every index of the
+ * key ring holds its own key. Built from the WebRTC sources directly rather
+ * than through the shared library, which does not export these types.
+ */
+class CryptorFixture {
+ public:
+  CryptorFixture(FrameCryptorTransformer::Algorithm algorithm,
+                 int key_ring_size)
+      : thread_(rtc::Thread::Create()),
+        sink_(rtc::make_ref_counted<FrameSink>()),
+        key_ring_size_(key_ring_size) {
+    thread_->SetName("frame_cryptor_benchmark", nullptr);
+    thread_->Start();
+
+    webrtc::KeyProviderOptions options;
+    options.shared_key = false;
+    std::string salt = "LKFrameEncryptionKey";
+    options.ratchet_salt.assign(salt.begin(), salt.end());
+    options.ratchet_window_size = 16;
+    options.key_ring_size = key_ring_size;
+    key_provider_ = rtc::make_ref_counted<SnapshotKeyProvider>(options);
+    std::vector<SnapshotKeyProvider::KeyEntry> keys(key_ring_size);
+    for (int index = 0; index < key_ring_size; index++) {
+      keys[index].participant_id = kParticipant;
+      keys[index].index = index;
+      keys[index].key.resize(32);
+      for (size_t i = 0; i < keys[index].key.size(); i++) {
+        keys[index].key[i] = static_cast<uint8_t>(i * 7 + index + 1);
+      }
+    }
+    key_provider_->SetKeys(keys);
+
+    transformer_ = rtc::scoped_refptr<FrameCryptorTransformer>(
+        new FrameCryptorTransformer(
+            thread_.get(), kParticipant,
+            FrameCryptorTransformer::MediaType::kAudioFrame, algorithm,
+            key_provider_));
+    transformer_->RegisterTransformedFrameCallback(sink_);
+    transformer_->SetKeyIndex(0);
+    transformer_->SetEnabled(true);
+  }
+
+  ~CryptorFixture() {
+    transformer_->UnregisterTransformedFrameCallback();
+    transformer_ = nullptr;
+    thread_->Stop();
+  }
+
+  // Transforms |data| and returns the result; |latency_us| receives the
+  // time from Transform() to the frame reaching the sink.
+  std::vector<uint8_t> Run(const std::vector<uint8_t>& data,
+                           webrtc::TransformableFrameInterface::Direction
+                               direction,
+                           int64_t* latency_us) {
+    std::unique_ptr<webrtc::TransformableFrameInterface> frame(
+        new SyntheticFrame(data, direction));
+    const int64_t start_us = rtc::TimeMicros();
+    transformer_->Transform(std::move(frame));
+    std::unique_ptr<webrtc::TransformableFrameInterface> result =
+        sink_->Wait();
+    *latency_us = sink_->done_us() - start_us;
+    rtc::ArrayView<const uint8_t> out = result->GetData();
+    return std::vector<uint8_t>(out.begin(), out.end());
+  }
+
+  // Encrypts the next frames with the key at |index|.
+  void SetKeyIndex(int index) { transformer_->SetKeyIndex(index); }
+
+  int key_ring_size() const { return key_ring_size_; }
+
+  SnapshotKeyProvider* key_provider() { return key_provider_.get(); }
+
+ private:
+  std::unique_ptr<rtc::Thread> thread_;
+  rtc::scoped_refptr<FrameSink> sink_;
+  const int key_ring_size_;
+  rtc::scoped_refptr<SnapshotKeyProvider> key_provider_;
+  rtc::scoped_refptr<FrameCryptorTransformer> transformer_;
+};
+
+FrameCryptorTransformer::Algorithm AlgorithmArg(int64_t arg) {
+  return static_cast<FrameCryptorTransformer::Algorithm>(arg);
+}
+
+std::vector<uint8_t> SyntheticPayload(size_t size) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = static_cast<uint8_t>(i * 31 + 17);
+  }
+  return data;
+}
+
+// Reports frames/s, MB/s and the per-frame latency percentiles.
+void ReportLatency(benchmark::State& state, std::vector<int64_t>* latencies,
+                   size_t frame_size) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * frame_size);
+  state.counters["frames_per_s"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+  // 1 when BoringSSL uses AES instructions (AES-NI, ARMv8 crypto) rather
+  // than its constant-time software fallback.
+  state.counters["aes_hw"] = EVP_has_aes_hardware() ? 1 : 0;
+  if (latencies->empty()) {
+    return;
+  }
+  std::sort(latencies->begin(), latencies->end());
+  auto percentile = [latencies](double p) {
+    size_t index = static_cast<size_t>(p * (latencies->size() - 1));
+    return static_cast<double>((*latencies)[index]);
+  };
+  state.counters["p50_us"] = percentile(0.50);
+  state.counters["p99_us"] = percentile(0.99);
+}
+
+// Arguments: algorithm, frame size in bytes, key ring size. Consecutive
+// frames use consecutive key indices, wrapping around the ring.
+void CryptorArgs(benchmark::internal::Benchmark* b) {
+  for (int algorithm :
+       {static_cast<int>(FrameCryptorTransformer::Algorithm::kAesGcm),
+        static_cast<int>(FrameCryptorTransformer::Algorithm::kAesCbc)}) {
+    // An audio frame, a small and a large video delta, a video key frame.
+    for (int size : {160, 1200, 16 * 1024, 128 * 1024}) {
+      for (int key_ring_size : {1, kDefaultKeyRingSize, kMaxKeyRingSize}) {
+        b->Args({algorithm, size, key_ring_size});
+      }
+    }
+  }
+  b->ArgNames({"algorithm", "bytes", "key_ring"})->UseRealTime();
+}
+
+void BM_EncryptFrame(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(1));
+  CryptorFixture cryptor(AlgorithmArg(state.range(0)),
+                         static_cast<int>(state.range(2)));
+  const std::vector<uint8_t> payload = SyntheticPayload(size);
+
+  std::vector<int64_t> latencies;
+  int64_t latency_us = 0;
+  int frames = 0;
+  for (auto _ : state) {
+    cryptor.SetKeyIndex(frames++ % cryptor.key_ring_size());
+    benchmark::DoNotOptimize(cryptor.Run(
+        payload, webrtc::TransformableFrameInterface::Direction::kSender,
+        &latency_us));
+    latencies.push_back(latency_us);
+  }
+  ReportLatency(state, &latencies, size);
+}
+BENCHMARK(BM_EncryptFrame)->Apply(CryptorArgs);
+
+void BM_DecryptFrame(benchmark::State& state) {
+  const size_t size = static_cast<size_t>(state.range(1));
+  CryptorFixture cryptor(AlgorithmArg(state.range(0)),
+                         static_cast<int>(state.range(2)));
+  int64_t latency_us = 0;
+  // One frame per key; the receiver picks the key from the frame trailer.
+  std::vector<std::vector<uint8_t>> encrypted(cryptor.key_ring_size());
+  for (int index = 0; index < cryptor.key_ring_size(); index++) {
+    cryptor.SetKeyIndex(index);
+    encrypted[index] = cryptor.Run(
+        SyntheticPayload(size),
+        webrtc::TransformableFrameInterface::Direction::kSender, &latency_us);
+  }
+
+  std::vector<int64_t> latencies;
+  size_t frames = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cryptor.Run(
+        encrypted[frames++ % encrypted.size()],
+        webrtc::TransformableFrameInterface::Direction::kReceiver,
+        &latency_us));
+    latencies.push_back(latency_us);
+  }
+  ReportLatency(state, &latencies, size);
+}
+BENCHMARK(BM_DecryptFrame)->Apply(CryptorArgs);
+
+// Encryption with the sender's key ratcheted every |range(1)| frames, to
+// show the cost of the key derivation on the frames that follow it.
+void BM_EncryptFrameWithRatchet(benchmark::State& state) {
+  const size_t size = 1200;
+  const int ratchet_every = static_cast<int>(state.range(1));
+  CryptorFixture cryptor(AlgorithmArg(state.range(0)), kDefaultKeyRingSize);
+  const std::vector<uint8_t> payload = SyntheticPayload(size);
+
+  std::vector<int64_t> latencies;
+  int64_t latency_us = 0;
+  int frames = 0;
+  for (auto _ : state) {
+    if (++frames % ratchet_every == 0) {
+      cryptor.key_provider()->RatchetKey(kParticipant, 0);
+    }
+    benchmark::DoNotOptimize(cryptor.Run(
+        payload, webrtc::TransformableFrameInterface::Direction::kSender,
+        &latency_us));
+    latencies.push_back(latency_us);
+  }
+  ReportLatency(state, &latencies, size);
+}
+BENCHMARK(BM_EncryptFrameWithRatchet)
+    ->ArgsProduct(
+        {{static_cast<int>(FrameCryptorTransformer::Algorithm::kAesGcm),
+          static_cast<int>(FrameCryptorTransformer::Algorithm::kAesCbc)},
+                   {1, 10, 100}})
+    ->ArgNames({"algorithm", "ratchet_every"})
+    ->UseRealTime();
+
+}  // namespace
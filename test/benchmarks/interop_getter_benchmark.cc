@@ -0,0 +1,54 @@
+#include "benchmark/benchmark.h"
+#include "rtc_video_frame.h"
+
+#ifdef LIBWEBRTC_INTEROP
+#include "interop_api.h"
+#endif
+
+using namespace libwebrtc;
+
+namespace {
+
+// One frame shared by all threads, as a managed host polling the same frame
+// from several places would.
+RTCVideoFrame* SharedFrame() {
+  static RTCVideoFrame* frame = RTCVideoFrame::Create(640, 480).release();
+  return frame;
+}
+
+// What the interop getters did before: take a reference for the call.
+void BM_GetterScopedRefptr(benchmark::State& state) {
+  void* handle = SharedFrame();
+  for (auto _ : state) {
+    scoped_refptr<RTCVideoFrame> p = static_cast<RTCVideoFrame*>(handle);
+    benchmark::DoNotOptimize(p->width());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetterScopedRefptr)->ThreadRange(1, 8);
+
+// What they do now: borrow the caller's reference.
+void BM_GetterBorrowed(benchmark::State& state) {
+  void* handle = SharedFrame();
+  for (auto _ : state) {
+    RTCVideoFrame* p = static_cast<RTCVideoFrame*>(handle);
+    benchmark::DoNotOptimize(p->width());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetterBorrowed)->ThreadRange(1, 8);
+
+#ifdef LIBWEBRTC_INTEROP
+void BM_InteropGetWidth(benchmark::State& state) {
+  rtcVideoFrameHandle handle = SharedFrame();
+  int width = 0;
+  for (auto _ : state) {
+    RTCVideoFrame_GetWidth(handle, &width);
+    benchmark::DoNotOptimize(width);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InteropGetWidth)->ThreadRange(1, 8);
+#endif
+
+}  // namespace
@@ -0,0 +1,114 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "rtc_types.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+// Lengths on both sides of the inline buffer, up to an SDP sized string.
+void StringLengthArgs(benchmark::internal::Benchmark* b) {
+  for (int length : {8, PORTABLE_STRING_BUF_SIZE - 1, PORTABLE_STRING_BUF_SIZE,
+                     256, 4096}) {
+    b->Arg(length);
+  }
+  b->ArgName("length");
+}
+
+void ElementCountArgs(benchmark::internal::Benchmark* b) {
+  for (int count : {1, 8, 64, 1024}) {
+    b->Arg(count);
+  }
+  b->ArgName("count");
+}
+
+void BM_PortableStringFromChars(benchmark::State& state) {
+  const std::string source(static_cast<size_t>(state.range(0)), 'x');
+
+  for (auto _ : state) {
+    string s(source.c_str());
+    benchmark::DoNotOptimize(s.c_string());
+  }
+  state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableStringFromChars)->Apply(StringLengthArgs);
+
+void BM_PortableStringCopy(benchmark::State& state) {
+  const string source(std::string(static_cast<size_t>(state.range(0)), 'x'));
+
+  for (auto _ : state) {
+    string s(source);
+    benchmark::DoNotOptimize(s.c_string());
+  }
+  state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableStringCopy)->Apply(StringLengthArgs);
+
+void BM_PortableStringMove(benchmark::State& state) {
+  const std::string source(static_cast<size_t>(state.range(0)), 'x');
+  string from(source);
+
+  for (auto _ : state) {
+    string to(std::move(from));
+    benchmark::DoNotOptimize(to.c_string());
+    from = std::move(to);
+  }
+}
+BENCHMARK(BM_PortableStringMove)->Apply(StringLengthArgs);
+
+void BM_PortableStringToStd(benchmark::State& state) {
+  const string source(std::string(static_cast<size_t>(state.range(0)), 'x'));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(source.std_string());
+  }
+  state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableStringToStd)->Apply(StringLengthArgs);
+
+void BM_PortableVectorFromArray(benchmark::State& state) {
+  const std::vector<uint8_t> source(static_cast<size_t>(state.range(0)) * 1024,
+                                    0x80);
+
+  for (auto _ : state) {
+    vector<uint8_t> v(source.data(), source.size());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableVectorFromArray)
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(1024)
+    ->ArgName("kbytes");
+
+// A vector of strings built from a std::vector, as stats ids and ICE server
+// URLs are returned across the API.
+void BM_PortableVectorOfStrings(benchmark::State& state) {
+  const std::vector<std::string> source(static_cast<size_t>(state.range(0)),
+                                        "RTCInboundRTPVideoStream_1234567890");
+
+  for (auto _ : state) {
+    vector<string> v(source);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableVectorOfStrings)->Apply(ElementCountArgs);
+
+void BM_PortableVectorCopy(benchmark::State& state) {
+  const vector<string> source(std::vector<std::string>(
+      static_cast<size_t>(state.range(0)), "RTCInboundRTPVideoStream_1234"));
+
+  for (auto _ : state) {
+    vector<string> v(source);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_PortableVectorCopy)->Apply(ElementCountArgs);
+
+}  // namespace
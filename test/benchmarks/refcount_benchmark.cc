@@ -0,0 +1,97 @@
+#include "base/atomicops.h"
+#include "benchmark/benchmark.h"
+#include "rtc_video_frame.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+class Counted : public RefCountInterface {
+ public:
+  virtual int value() const { return 1; }
+};
+
+class CountedFinal final : public RefCountedFinal<Counted> {};
+
+// The counter RefCountedObject used before: AtomicOps on a volatile int,
+// sequentially consistent on every platform.
+class CountedLegacy final : public Counted {
+ public:
+  int AddRef() const override {
+    return AtomicOps::Increment(&ref_count_);
+  }
+  int Release() const override {
+    int count = AtomicOps::Decrement(&ref_count_);
+    if (!count) {
+      delete this;
+    }
+    return count;
+  }
+
+ private:
+  mutable volatile int ref_count_ = 0;
+};
+
+template <class T>
+T* Shared() {
+  static T* object = [] {
+    T* p = new T();
+    p->AddRef();
+    return p;
+  }();
+  return object;
+}
+
+// AddRef/Release pairs through the interface, as scoped_refptr<Counted> does.
+template <class T>
+void BM_CopyRefShared(benchmark::State& state) {
+  Counted* object = Shared<T>();
+  for (auto _ : state) {
+    scoped_refptr<Counted> p = object;
+    benchmark::DoNotOptimize(p.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_CopyRefShared, CountedLegacy)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_CopyRefShared, RefCountedObject<Counted>)
+    ->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_CopyRefShared, CountedFinal)->ThreadRange(1, 8);
+
+// The same through the final type, where the calls are devirtualised.
+void BM_CopyRefSharedFinalType(benchmark::State& state) {
+  CountedFinal* object = Shared<CountedFinal>();
+  for (auto _ : state) {
+    scoped_refptr<CountedFinal> p = object;
+    benchmark::DoNotOptimize(p.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CopyRefSharedFinalType)->ThreadRange(1, 8);
+
+// One object per thread: no contention, measures the uncontended cost.
+template <class T>
+void BM_CopyRefPerThread(benchmark::State& state) {
+  scoped_refptr<Counted> object = new T();
+  for (auto _ : state) {
+    scoped_refptr<Counted> p = object;
+    benchmark::DoNotOptimize(p.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_CopyRefPerThread, CountedLegacy)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_CopyRefPerThread, RefCountedObject<Counted>)
+    ->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_CopyRefPerThread, CountedFinal)->ThreadRange(1, 8);
+
+// A frame handed from a sink to its consumers.
+void BM_CopyVideoFrameRef(benchmark::State& state) {
+  static RTCVideoFrame* frame = RTCVideoFrame::Create(640, 480).release();
+  for (auto _ : state) {
+    scoped_refptr<RTCVideoFrame> p = frame;
+    benchmark::DoNotOptimize(p.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CopyVideoFrameRef)->ThreadRange(1, 8);
+
+}  // namespace
@@ -0,0 +1,229 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "rtc_video_frame.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+const int kResolutions[][2] = {
+    {320, 180}, {640, 360}, {1280, 720}, {1920, 1080}, {3840, 2160}};
+
+size_t I420Size(int width, int height) {
+  return static_cast<size_t>(width) * height +
+         2 * static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+}
+
+// Arguments: frame width, frame height.
+void ResolutionArgs(benchmark::internal::Benchmark* b) {
+  for (const auto& size : kResolutions) {
+    b->Args({size[0], size[1]});
+  }
+  b->ArgNames({"width", "height"});
+}
+
+// Arguments: frame width, frame height, pixel format.
+template <class Format, size_t N>
+void FormatArgs(benchmark::internal::Benchmark* b, const Format (&formats)[N]) {
+  for (const auto& size : kResolutions) {
+    for (Format format : formats) {
+      b->Args({size[0], size[1], static_cast<int64_t>(format)});
+    }
+  }
+  b->ArgNames({"width", "height", "format"});
+}
+
+void ARGBFormatArgs(benchmark::internal::Benchmark* b) {
+  const RTCVideoFrameTypeARGB formats[] = {
+      RTCVideoFrameTypeARGB::kARGB, RTCVideoFrameTypeARGB::kBGRA,
+      RTCVideoFrameTypeARGB::kABGR, RTCVideoFrameTypeARGB::kRGBA};
+  FormatArgs(b, formats);
+}
+
+// NV12 is left out: ScaleFrom() does not convert it yet and returns at once.
+void YUVFormatArgs(benchmark::internal::Benchmark* b) {
+  const RTCVideoFrameTypeYUV formats[] = {RTCVideoFrameTypeYUV::kI420,
+                                          RTCVideoFrameTypeYUV::kYUY2};
+  FormatArgs(b, formats);
+}
+
+void ClearTypeArgs(benchmark::internal::Benchmark* b) {
+  const RTCVideoFrameClearType types[] = {RTCVideoFrameClearType::kNone,
+                                          RTCVideoFrameClearType::kNoise,
+                                          RTCVideoFrameClearType::kColorBar};
+  FormatArgs(b, types);
+  b->ArgNames({"width", "height", "clear"});
+}
+
+void ReportFrames(benchmark::State& state, size_t frame_bytes) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * frame_bytes);
+}
+
+// An I420 source frame of |width| x |height| filled with colour bars.
+scoped_refptr<RTCVideoFrame> ColorBarFrame(int width, int height) {
+  scoped_refptr<RTCVideoFrame> frame = RTCVideoFrame::Create(width, height);
+  frame->Clear(RTCVideoFrameClearType::kColorBar);
+  return frame;
+}
+
+void BM_VideoFrameCreate(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(RTCVideoFrame::Create(width, height));
+  }
+  ReportFrames(state, I420Size(width, height));
+}
+BENCHMARK(BM_VideoFrameCreate)->Apply(ResolutionArgs);
+
+// Create() from one contiguous I420 buffer, as frames read from a file are.
+void BM_VideoFrameCreateFromBuffer(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  const int length = width * height * 3 / 2;
+  std::vector<uint8_t> buffer(static_cast<size_t>(length), 0x80);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        RTCVideoFrame::Create(width, height, buffer.data(), length));
+  }
+  ReportFrames(state, buffer.size());
+}
+BENCHMARK(BM_VideoFrameCreateFromBuffer)->Apply(ResolutionArgs);
+
+// Create() from separate planes, as a capturer with its own buffers does.
+void BM_VideoFrameCreateFromPlanes(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  scoped_refptr<RTCVideoFrame> source = ColorBarFrame(width, height);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(RTCVideoFrame::Create(
+        width, height, source->DataY(), source->StrideY(), source->DataU(),
+        source->StrideU(), source->DataV(), source->StrideV()));
+  }
+  ReportFrames(state, I420Size(width, height));
+}
+BENCHMARK(BM_VideoFrameCreateFromPlanes)->Apply(ResolutionArgs);
+
+void BM_VideoFrameCopy(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  scoped_refptr<RTCVideoFrame> frame = ColorBarFrame(width, height);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->Copy());
+  }
+  ReportFrames(state, I420Size(width, height));
+}
+BENCHMARK(BM_VideoFrameCopy)->Apply(ResolutionArgs);
+
+void BM_VideoFrameConvertToARGB(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  scoped_refptr<RTCVideoFrame> frame = ColorBarFrame(width, height);
+  std::vector<uint8_t> argb(static_cast<size_t>(width) * height * 4);
+  RTCVideoFrameARGB dest;
+  dest.type = static_cast<RTCVideoFrameTypeARGB>(state.range(2));
+  dest.width = width;
+  dest.height = height;
+  dest.data = argb.data();
+  dest.stride = width * 4;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ConvertToARGB(&dest));
+  }
+  ReportFrames(state, argb.size());
+}
+BENCHMARK(BM_VideoFrameConvertToARGB)->Apply(ARGBFormatArgs);
+
+// I420 to I420 at half size, as a simulcast layer is produced.
+void BM_VideoFrameScaleFromFrame(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  scoped_refptr<RTCVideoFrame> source = ColorBarFrame(width, height);
+  scoped_refptr<RTCVideoFrame> frame =
+      RTCVideoFrame::Create(width / 2, height / 2);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ScaleFrom(source));
+  }
+  ReportFrames(state, I420Size(width, height));
+}
+BENCHMARK(BM_VideoFrameScaleFromFrame)->Apply(ResolutionArgs);
+
+void BM_VideoFrameScaleFromARGB(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  std::vector<uint8_t> argb(static_cast<size_t>(width) * height * 4, 0x80);
+  RTCVideoFrameARGB source;
+  source.type = static_cast<RTCVideoFrameTypeARGB>(state.range(2));
+  source.width = width;
+  source.height = height;
+  source.data = argb.data();
+  source.stride = width * 4;
+  scoped_refptr<RTCVideoFrame> frame =
+      RTCVideoFrame::Create(width / 2, height / 2);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ScaleFrom(&source));
+  }
+  ReportFrames(state, argb.size());
+}
+BENCHMARK(BM_VideoFrameScaleFromARGB)->Apply(ARGBFormatArgs);
+
+void BM_VideoFrameScaleFromYUV(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  const int chroma_width = (width + 1) / 2;
+  const int chroma_height = (height + 1) / 2;
+  RTCVideoFrameYUV source;
+  source.type = static_cast<RTCVideoFrameTypeYUV>(state.range(2));
+  source.width = width;
+  source.height = height;
+
+  std::vector<uint8_t> y, u, v;
+  if (source.type == RTCVideoFrameTypeYUV::kYUY2) {
+    // Packed: every plane pointer refers to the one buffer.
+    y.assign(static_cast<size_t>(width) * height * 2, 0x80);
+    source.dataY = source.dataU = source.dataV = y.data();
+    source.strideY = width * 2;
+    source.strideU = source.strideV = width;
+  } else {
+    y.assign(static_cast<size_t>(width) * height, 0x80);
+    u.assign(static_cast<size_t>(chroma_width) * chroma_height, 0x80);
+    v.assign(static_cast<size_t>(chroma_width) * chroma_height, 0x80);
+    source.dataY = y.data();
+    source.dataU = u.data();
+    source.dataV = v.data();
+    source.strideY = width;
+    source.strideU = source.strideV = chroma_width;
+  }
+  scoped_refptr<RTCVideoFrame> frame =
+      RTCVideoFrame::Create(width / 2, height / 2);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->ScaleFrom(&source));
+  }
+  ReportFrames(state, y.size() + u.size() + v.size());
+}
+BENCHMARK(BM_VideoFrameScaleFromYUV)->Apply(YUVFormatArgs);
+
+void BM_VideoFrameClear(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  const RTCVideoFrameClearType type =
+      static_cast<RTCVideoFrameClearType>(state.range(2));
+  scoped_refptr<RTCVideoFrame> frame = RTCVideoFrame::Create(width, height);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame->Clear(type));
+  }
+  ReportFrames(state, I420Size(width, height));
+}
+BENCHMARK(BM_VideoFrameClear)->Apply(ClearTypeArgs);
+
+}  // namespace
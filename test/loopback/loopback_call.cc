@@ -0,0 +1,368 @@
+#include "loopback_call.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+
+#include "rtc_audio_track.h"
+#include "rtc_media_track.h"
+#include "rtc_mediaconstraints.h"
+#include "rtc_rtp_receiver.h"
+#include "rtc_rtp_transceiver.h"
+#include "rtc_video_source.h"
+#include "rtc_video_track.h"
+
+namespace libwebrtc {
+
+namespace {
+
+double MemberValue(const scoped_refptr<RTCStatsMember>& member) {
+  switch (member->GetType()) {
+    case RTCStatsMember::kInt32:
+      return member->ValueInt32();
+    case RTCStatsMember::kUint32:
+      return member->ValueUint32();
+    case RTCStatsMember::kInt64:
+      return static_cast<double>(member->ValueInt64());
+    case RTCStatsMember::kUint64:
+      return static_cast<double>(member->ValueUint64());
+    case RTCStatsMember::kDouble:
+      return member->ValueDouble();
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+/**
+ * class LoopbackEndpoint
+ */
+
+LoopbackEndpoint::LoopbackEndpoint(LoopbackCall* call, const std::string& name)
+    : call_(call), name_(name) {}
+
+LoopbackEndpoint::~LoopbackEndpoint() { Close(); }
+
+bool LoopbackEndpoint::Open(scoped_refptr<RTCPeerConnectionFactory> factory,
+                            const LoopbackOptions& options,
+                            LoopbackEndpoint* remote) {
+  factory_ = factory;
+  remote_ = remote;
+
+  // Host candidates only: no STUN or TURN servers are involved.
+  RTCConfiguration configuration;
+  pc_ = factory_->Create(configuration, RTCMediaConstraints::Create());
+  if (!pc_) {
+    return false;
+  }
+  renderer_ = RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>::Create();
+  renderer_->SetLatencyMeasurement(true);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = false;
+    remote_description_set_ = false;
+    pending_candidates_.clear();
+  }
+  pc_->RegisterRTCPeerConnectionObserver(this);
+
+  const std::string stream_id = name_ + "_stream";
+  vector<string> stream_ids(std::vector<std::string>{stream_id});
+
+  capturer_ = factory_->CreateDummyVideoCapturer(options.fps, options.width,
+                                                 options.height);
+  capturer_->SetLatencyWatermark(true);
+  scoped_refptr<RTCVideoSource> video_source =
+      factory_->CreateDummyVideoSource(capturer_, (name_ + "_video").c_str());
+  scoped_refptr<RTCVideoTrack> video_track =
+      factory_->CreateVideoTrack(video_source, (name_ + "_video").c_str());
+  if (!video_track || !pc_->AddTrack(video_track, stream_ids)) {
+    return false;
+  }
+
+  if (options.audio) {
+    audio_source_ =
+        factory_->CreateDummyAudioSource((name_ + "_audio").c_str(), 48000, 2);
+    if (!audio_source_) {
+      return false;
+    }
+    scoped_refptr<RTCAudioTrack> audio_track =
+        factory_->CreateAudioTrack(audio_source_, (name_ + "_audio").c_str());
+    if (!audio_track || !pc_->AddTrack(audio_track, stream_ids)) {
+      return false;
+    }
+    audio_source_->Start();
+  }
+
+  capturer_->Start(options.fps, options.width, options.height);
+  return true;
+}
+
+void LoopbackEndpoint::Close() {
+  if (capturer_) {
+    capturer_->Stop();
+  }
+  if (audio_source_) {
+    audio_source_->Stop();
+  }
+
+  scoped_refptr<RTCVideoTrack> remote_video_track;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    pending_candidates_.clear();
+    remote_video_track = remote_video_track_;
+    remote_video_track_ = nullptr;
+  }
+  if (remote_video_track) {
+    remote_video_track->RemoveRenderer(renderer_.get());
+  }
+
+  if (pc_) {
+    pc_->DeRegisterRTCPeerConnectionObserver();
+    pc_->Close();
+    factory_->Delete(pc_);
+  }
+  pc_ = nullptr;
+  capturer_ = nullptr;
+  audio_source_ = nullptr;
+  renderer_ = nullptr;
+  factory_ = nullptr;
+  connected_ = false;
+}
+
+scoped_refptr<RTCPeerConnection> LoopbackEndpoint::peer_connection() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_ ? nullptr : pc_;
+}
+
+void LoopbackEndpoint::Offer() {
+  scoped_refptr<RTCPeerConnection> pc = peer_connection();
+  if (!pc) {
+    return;
+  }
+  pc->CreateOffer(
+      [this](const string sdp, const string type) {
+        OnLocalDescription(sdp, type);
+      },
+      [this](const char* error) { Fail("CreateOffer", error); },
+      RTCMediaConstraints::Create());
+}
+
+void LoopbackEndpoint::OnLocalDescription(const string sdp,
+                                          const string type) {
+  scoped_refptr<RTCPeerConnection> pc = peer_connection();
+  if (!pc) {
+    return;
+  }
+  local_sdp_ = sdp.std_string();
+  local_type_ = type.std_string();
+  pc->SetLocalDescription(
+      sdp, type,
+      [this]() { remote_->OnRemoteDescription(local_sdp_, local_type_); },
+      [this](const char* error) { Fail("SetLocalDescription", error); });
+}
+
+void LoopbackEndpoint::OnRemoteDescription(const std::string& sdp,
+                                           const std::string& type) {
+  scoped_refptr<RTCPeerConnection> pc = peer_connection();
+  if (!pc) {
+    return;
+  }
+  remote_is_offer_ = (type == "offer");
+  pc->SetRemoteDescription(
+      sdp.c_str(), type.c_str(), [this]() { OnRemoteDescriptionSet(); },
+      [this](const char* error) { Fail("SetRemoteDescription", error); });
+}
+
+void LoopbackEndpoint::OnRemoteDescriptionSet() {
+  scoped_refptr<RTCPeerConnection> pc;
+  std::vector<Candidate> candidates;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    pc = pc_;
+    remote_description_set_ = true;
+    candidates.swap(pending_candidates_);
+  }
+  for (const Candidate& candidate : candidates) {
+    pc->AddCandidate(candidate.mid.c_str(), candidate.mline_index,
+                     candidate.sdp.c_str());
+  }
+
+  if (remote_is_offer_) {
+    pc->CreateAnswer(
+        [this](const string sdp, const string type) {
+          OnLocalDescription(sdp, type);
+        },
+        [this](const char* error) { Fail("CreateAnswer", error); },
+        RTCMediaConstraints::Create());
+  }
+}
+
+void LoopbackEndpoint::OnRemoteCandidate(const std::string& mid,
+                                         int mline_index,
+                                         const std::string& candidate) {
+  scoped_refptr<RTCPeerConnection> pc;
+  {
+    // Candidates can arrive before the description they belong to, and
+    // after this side has been closed.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    if (!remote_description_set_) {
+      pending_candidates_.push_back({mid, mline_index, candidate});
+      return;
+    }
+    pc = pc_;
+  }
+  pc->AddCandidate(mid.c_str(), mline_index, candidate.c_str());
+}
+
+void LoopbackEndpoint::OnIceCandidate(scoped_refptr<RTCIceCandidate> candidate) {
+  remote_->OnRemoteCandidate(candidate->sdp_mid().std_string(),
+                             candidate->sdp_mline_index(),
+                             candidate->candidate().std_string());
+}
+
+void LoopbackEndpoint::OnPeerConnectionState(RTCPeerConnectionState state) {
+  if (state == RTCPeerConnectionStateConnected) {
+    connected_ = true;
+  } else if (state == RTCPeerConnectionStateFailed) {
+    connected_ = false;
+    Fail("connect", "peer connection failed");
+  }
+}
+
+void LoopbackEndpoint::OnTrack(scoped_refptr<RTCRtpTransceiver> transceiver) {
+  scoped_refptr<RTCMediaTrack> track = transceiver->receiver()->track();
+  if (!track || track->kind_view().std_string() != "video") {
+    return;
+  }
+
+  scoped_refptr<RTCVideoTrack> video_track =
+      static_cast<RTCVideoTrack*>(track.get());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return;
+    }
+    remote_video_track_ = video_track;
+  }
+  video_track->AddRenderer(renderer_.get());
+}
+
+void LoopbackEndpoint::ResetStats() { renderer_->ResetLatencyStats(); }
+
+RTCVideoLatencyStats LoopbackEndpoint::GetStats() {
+  RTCVideoLatencyStats stats;
+  renderer_->GetLatencyStats(&stats);
+  return stats;
+}
+
+bool LoopbackEndpoint::GetFrameCounters(LoopbackFrameCounters* counters) {
+  struct Result {
+    std::mutex mutex;
+    std::condition_variable done;
+    bool finished = false;
+    bool ok = false;
+    LoopbackFrameCounters counters;
+  };
+  // Shared with the callbacks, which may still run after a timeout.
+  std::shared_ptr<Result> result = std::make_shared<Result>();
+
+  RTCStatsFilter filter;
+  filter.types = vector<string>(
+      std::vector<std::string>{"outbound-rtp", "inbound-rtp"});
+  filter.members = vector<string>(
+      std::vector<std::string>{"framesEncoded", "framesDecoded"});
+  scoped_refptr<RTCPeerConnection> pc = peer_connection();
+  if (!pc) {
+    return false;
+  }
+  pc->GetStats(
+      filter,
+      [result](const vector<scoped_refptr<MediaRTCStats>> reports) {
+        LoopbackFrameCounters counters;
+        for (size_t i = 0; i < reports.size(); i++) {
+          vector<scoped_refptr<RTCStatsMember>> members = reports[i]->Members();
+          for (size_t j = 0; j < members.size(); j++) {
+            std::string name = members[j]->GetName().std_string();
+            if (name == "framesEncoded") {
+              counters.frames_encoded += MemberValue(members[j]);
+            } else if (name == "framesDecoded") {
+              counters.frames_decoded += MemberValue(members[j]);
+            }
+          }
+        }
+        std::lock_guard<std::mutex> lock(result->mutex);
+        result->counters = counters;
+        result->ok = true;
+        result->finished = true;
+        result->done.notify_all();
+      },
+      [result](const char* error) {
+        std::lock_guard<std::mutex> lock(result->mutex);
+        result->finished = true;
+        result->done.notify_all();
+      });
+
+  std::unique_lock<std::mutex> lock(result->mutex);
+  if (!result->done.wait_for(lock, std::chrono::seconds(5),
+                             [&result] { return result->finished; })) {
+    return false;
+  }
+  *counters = result->counters;
+  return result->ok;
+}
+
+void LoopbackEndpoint::Fail(const char* step, const char* error) {
+  call_->SetFailed(name_ + ": " + step + ": " + (error ? error : "unknown"));
+}
+
+/**
+ * class LoopbackCall
+ */
+
+LoopbackCall::LoopbackCall(int index)
+    : index_(index),
+      caller_(this, "call" + std::to_string(index) + "_a"),
+      callee_(this, "call" + std::to_string(index) + "_b") {}
+
+LoopbackCall::~LoopbackCall() { Stop(); }
+
+bool LoopbackCall::Start(scoped_refptr<RTCPeerConnectionFactory> factory,
+                         const LoopbackOptions& options) {
+  if (!caller_.Open(factory, options, &callee_) ||
+      !callee_.Open(factory, options, &caller_)) {
+    SetFailed("could not create the peer connections or tracks");
+    return false;
+  }
+  caller_.Offer();
+  return true;
+}
+
+void LoopbackCall::Stop() {
+  // The side closed first stops accepting SDP and candidates from the other
+  // one, which can still be delivering them until it is closed too.
+  caller_.Close();
+  callee_.Close();
+}
+
+std::string LoopbackCall::error() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_;
+}
+
+void LoopbackCall::SetFailed(const std::string& error) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!failed_) {
+    error_ = error;
+    failed_ = true;
+  }
+}
+
+}  // namespace libwebrtc
@@ -0,0 +1,159 @@
+#ifndef LIB_WEBRTC_LOOPBACK_CALL_HXX
+#define LIB_WEBRTC_LOOPBACK_CALL_HXX
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rtc_dummy_audio_source.h"
+#include "rtc_dummy_video_capturer.h"
+#include "rtc_peerconnection.h"
+#include "rtc_peerconnection_factory.h"
+#include "rtc_video_renderer.h"
+
+namespace libwebrtc {
+
+struct LoopbackOptions {
+  int width = 640;
+  int height = 360;
+  int fps = 30;
+  bool audio = true;
+};
+
+// Frame counters from the standard stats, summed over the video streams.
+struct LoopbackFrameCounters {
+  double frames_encoded = 0;
+  double frames_decoded = 0;
+};
+
+class LoopbackCall;
+
+/**
+ * class LoopbackEndpoint
+ *
+ * One peer connection of a loopback call. Sends a dummy video track with
+ * the latency watermark and optionally a dummy audio track, and renders the
+ * video of the other side with latency measurement enabled.
+ */
+class LoopbackEndpoint : public RTCPeerConnectionObserver {
+ public:
+  LoopbackEndpoint(LoopbackCall* call, const std::string& name);
+  ~LoopbackEndpoint() override;
+
+  bool Open(scoped_refptr<RTCPeerConnectionFactory> factory,
+            const LoopbackOptions& options, LoopbackEndpoint* remote);
+
+  void Close();
+
+  // Starts the offer/answer exchange with the remote endpoint.
+  void Offer();
+
+  // Called by the remote endpoint.
+  void OnRemoteDescription(const std::string& sdp, const std::string& type);
+  void OnRemoteCandidate(const std::string& mid, int mline_index,
+                         const std::string& candidate);
+
+  bool connected() const { return connected_; }
+
+  // Clears the latency statistics, starting a new measurement window.
+  void ResetStats();
+  RTCVideoLatencyStats GetStats();
+
+  // Blocks until the stats report arrives. Returns false on failure.
+  bool GetFrameCounters(LoopbackFrameCounters* counters);
+
+  const std::string& name() const { return name_; }
+
+ protected:
+  // RTCPeerConnectionObserver
+  void OnSignalingState(RTCSignalingState state) override {}
+  void OnPeerConnectionState(RTCPeerConnectionState state) override;
+  void OnIceGatheringState(RTCIceGatheringState state) override {}
+  void OnIceConnectionState(RTCIceConnectionState state) override {}
+  void OnIceCandidate(scoped_refptr<RTCIceCandidate> candidate) override;
+  void OnAddStream(scoped_refptr<RTCMediaStream> stream) override {}
+  void OnRemoveStream(scoped_refptr<RTCMediaStream> stream) override {}
+  void OnDataChannel(scoped_refptr<RTCDataChannel> data_channel) override {}
+  void OnRenegotiationNeeded() override {}
+  void OnTrack(scoped_refptr<RTCRtpTransceiver> transceiver) override;
+  void OnAddTrack(vector<scoped_refptr<RTCMediaStream>> streams,
+                  scoped_refptr<RTCRtpReceiver> receiver) override {}
+  void OnRemoveTrack(scoped_refptr<RTCRtpReceiver> receiver) override {}
+
+ private:
+  void OnLocalDescription(const string sdp, const string type);
+  void OnRemoteDescriptionSet();
+  void Fail(const char* step, const char* error);
+
+  // The peer connection, or null once Close() has started. Signaling
+  // callbacks and the remote endpoint can still call in after that.
+  scoped_refptr<RTCPeerConnection> peer_connection();
+
+  LoopbackCall* call_;
+  std::string name_;
+  LoopbackEndpoint* remote_ = nullptr;
+  scoped_refptr<RTCPeerConnectionFactory> factory_;
+  scoped_refptr<RTCPeerConnection> pc_;
+  scoped_refptr<RTCDummyVideoCapturer> capturer_;
+  scoped_refptr<RTCDummyAudioSource> audio_source_;
+  scoped_refptr<RTCVideoRenderer<scoped_refptr<RTCVideoFrame>>> renderer_;
+  std::atomic<bool> connected_{false};
+
+  // Only touched by the signaling callbacks, which run one at a time.
+  std::string local_sdp_;
+  std::string local_type_;
+  bool remote_is_offer_ = false;
+
+  // Guards the members below.
+  std::mutex mutex_;
+  bool closed_ = true;
+  bool remote_description_set_ = false;
+  struct Candidate {
+    std::string mid;
+    int mline_index;
+    std::string sdp;
+  };
+  std::vector<Candidate> pending_candidates_;
+  scoped_refptr<RTCVideoTrack> remote_video_track_;
+};
+
+/**
+ * class LoopbackCall
+ *
+ * Two endpoints in the same process that negotiate with each other directly,
+ * exchanging SDP and ICE candidates through method calls.
+ */
+class LoopbackCall {
+ public:
+  explicit LoopbackCall(int index);
+  ~LoopbackCall();
+
+  bool Start(scoped_refptr<RTCPeerConnectionFactory> factory,
+             const LoopbackOptions& options);
+  void Stop();
+
+  bool connected() const { return caller_.connected() && callee_.connected(); }
+  bool failed() const { return failed_; }
+  std::string error() const;
+
+  int index() const { return index_; }
+  LoopbackEndpoint* caller() { return &caller_; }
+  LoopbackEndpoint* callee() { return &callee_; }
+
+  void SetFailed(const std::string& error);
+
+ private:
+  int index_;
+  LoopbackEndpoint caller_;
+  LoopbackEndpoint callee_;
+  std::atomic<bool> failed_{false};
+
+  // Guards the members below.
+  mutable std::mutex mutex_;
+  std::string error_;
+};
+
+}  // namespace libwebrtc
+
+#endif  // LIB_WEBRTC_LOOPBACK_CALL_HXX
@@ -0,0 +1,352 @@
+// Headless loopback call harness.
+//
+// Creates --pairs calls in one process, each two peer connections that send
+// a dummy video track (and a dummy audio track unless --audio=0) to each
+// other over host candidates, with SDP and ICE exchanged in-process. After
+// --warmup seconds it measures for --duration seconds and reports process
+// CPU and memory, encoded/decoded frame rates from the standard stats and
+// the capture to render latency and freezes the renderers measure from the
+// watermarks the dummy capturers put in the video frames.
+//
+// The results are printed and written as JSON to --out (default
+// <executable name>.json). Exits with 1 when a call fails to connect or a
+// direction renders no watermarked frames, so it also serves as a smoke
+// test of a full call.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "libwebrtc.h"
+#include "loopback_call.h"
+#include "rtc_peerconnection_factory.h"
+
+using namespace libwebrtc;
+
+namespace {
+
+struct HarnessOptions {
+  int pairs = 4;
+  int duration_s = 30;
+  int warmup_s = 5;
+  int connect_timeout_s = 30;
+  LoopbackOptions call;
+  std::string out;
+};
+
+bool ParseInt(const char* arg, const char* name, int* value) {
+  size_t length = strlen(name);
+  if (strncmp(arg, name, length) != 0 || arg[length] != '=') {
+    return false;
+  }
+  *value = atoi(arg + length + 1);
+  return true;
+}
+
+bool ParseOptions(int argc, char** argv, HarnessOptions* options) {
+  std::string name = argc > 0 ? argv[0] : "libwebrtc_loopback";
+  size_t slash = name.find_last_of("/\\");
+  if (slash != std::string::npos) {
+    name = name.substr(slash + 1);
+  }
+  size_t ext = name.rfind(".exe");
+  if (ext != std::string::npos && ext + 4 == name.size()) {
+    name = name.substr(0, ext);
+  }
+  options->out = name + ".json";
+
+  for (int i = 1; i < argc; i++) {
+    int audio = options->call.audio ? 1 : 0;
+    if (ParseInt(argv[i], "--pairs", &options->pairs) ||
+        ParseInt(argv[i], "--duration", &options->duration_s) ||
+        ParseInt(argv[i], "--warmup", &options->warmup_s) ||
+        ParseInt(argv[i], "--connect_timeout", &options->connect_timeout_s) ||
+        ParseInt(argv[i], "--width", &options->call.width) ||
+        ParseInt(argv[i], "--height", &options->call.height) ||
+        ParseInt(argv[i], "--fps", &options->call.fps)) {
+      continue;
+    }
+    if (ParseInt(argv[i], "--audio", &audio)) {
+      options->call.audio = audio != 0;
+      continue;
+    }
+    if (strncmp(argv[i], "--out=", 6) == 0) {
+      options->out = argv[i] + 6;
+      continue;
+    }
+    fprintf(stderr,
+            "usage: %s [--pairs=N] [--duration=S] [--warmup=S] "
+            "[--connect_timeout=S] [--width=W] [--height=H] [--fps=F] "
+            "[--audio=0|1] [--out=FILE]\n",
+            name.c_str());
+    return false;
+  }
+  return options->pairs > 0 && options->duration_s > 0 &&
+         options->warmup_s >= 0 && options->call.width > 0 &&
+         options->call.height > 0 && options->call.fps > 0;
+}
+
+// User plus system CPU time of the process.
+int64_t ProcessCpuMicros() {
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel,
+                       &user)) {
+    return 0;
+  }
+  ULARGE_INTEGER k, u;
+  k.LowPart = kernel.dwLowDateTime;
+  k.HighPart = kernel.dwHighDateTime;
+  u.LowPart = user.dwLowDateTime;
+  u.HighPart = user.dwHighDateTime;
+  return static_cast<int64_t>((k.QuadPart + u.QuadPart) / 10);
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ll +
+         usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif
+}
+
+// Current and peak resident set size in bytes; 0 where unknown.
+void ProcessMemory(int64_t* resident, int64_t* peak) {
+  *resident = 0;
+  *peak = 0;
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                           sizeof(counters))) {
+    *resident = static_cast<int64_t>(counters.WorkingSetSize);
+    *peak = static_cast<int64_t>(counters.PeakWorkingSetSize);
+  }
+#elif defined(__linux__)
+  FILE* status = fopen("/proc/self/status", "r");
+  if (!status) {
+    return;
+  }
+  char line[256];
+  long long kb = 0;
+  while (fgets(line, sizeof(line), status)) {
+    if (sscanf(line, "VmRSS: %lld kB", &kb) == 1) {
+      *resident = kb * 1024;
+    } else if (sscanf(line, "VmHWM: %lld kB", &kb) == 1) {
+      *peak = kb * 1024;
+    }
+  }
+  fclose(status);
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    // Bytes on macOS.
+    *peak = static_cast<int64_t>(usage.ru_maxrss);
+  }
+#endif
+}
+
+struct DirectionResult {
+  std::string name;
+  double encoded_fps = 0;
+  double decoded_fps = 0;
+  double rendered_fps = 0;
+  RTCVideoLatencyStats latency;
+};
+
+// |sender| -> |receiver| over the window that started with |sender_start|
+// and |receiver_start|.
+DirectionResult MeasureDirection(LoopbackEndpoint* sender,
+                                 LoopbackEndpoint* receiver,
+                                 const LoopbackFrameCounters& sender_start,
+                                 const LoopbackFrameCounters& receiver_start,
+                                 double seconds) {
+  DirectionResult result;
+  result.name = sender->name() + " -> " + receiver->name();
+
+  LoopbackFrameCounters sender_end, receiver_end;
+  if (sender->GetFrameCounters(&sender_end)) {
+    result.encoded_fps =
+        (sender_end.frames_encoded - sender_start.frames_encoded) / seconds;
+  }
+  if (receiver->GetFrameCounters(&receiver_end)) {
+    result.decoded_fps =
+        (receiver_end.frames_decoded - receiver_start.frames_decoded) /
+        seconds;
+  }
+
+  result.latency = receiver->GetStats();
+  result.rendered_fps = result.latency.frames_rendered / seconds;
+  return result;
+}
+
+bool WriteJson(const std::string& path, const HarnessOptions& options,
+               int connected, double cpu_percent, int64_t resident,
+               int64_t peak, const std::vector<DirectionResult>& directions) {
+  FILE* file = fopen(path.c_str(), "w");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "{\n");
+  fprintf(file,
+          "  \"config\": {\"pairs\": %d, \"duration_s\": %d, "
+          "\"warmup_s\": %d, \"width\": %d, \"height\": %d, \"fps\": %d, "
+          "\"audio\": %s},\n",
+          options.pairs, options.duration_s, options.warmup_s,
+          options.call.width, options.call.height, options.call.fps,
+          options.call.audio ? "true" : "false");
+  fprintf(file,
+          "  \"process\": {\"connected_pairs\": %d, \"cpu_percent\": %.2f, "
+          "\"cpu_percent_per_pair\": %.2f, \"rss_bytes\": %lld, "
+          "\"peak_rss_bytes\": %lld},\n",
+          connected, cpu_percent,
+          connected > 0 ? cpu_percent / connected : 0.0,
+          static_cast<long long>(resident), static_cast<long long>(peak));
+  fprintf(file, "  \"directions\": [\n");
+  for (size_t i = 0; i < directions.size(); i++) {
+    const DirectionResult& d = directions[i];
+    fprintf(file,
+            "    {\"name\": \"%s\", \"encoded_fps\": %.2f, "
+            "\"decoded_fps\": %.2f, \"rendered_fps\": %.2f, "
+            "\"frames_lost\": %lld, \"frames_unmarked\": %lld, "
+            "\"freeze_count\": %lld, \"total_freeze_ms\": %lld, "
+            "\"latency_ms\": {\"samples\": %lld, \"min\": %.2f, "
+            "\"mean\": %.2f, \"p50\": %.2f, \"p95\": %.2f, "
+            "\"p99\": %.2f, \"max\": %.2f}}%s\n",
+            d.name.c_str(), d.encoded_fps, d.decoded_fps, d.rendered_fps,
+            static_cast<long long>(d.latency.frames_lost),
+            static_cast<long long>(d.latency.frames_rendered -
+                                   d.latency.frames_marked),
+            static_cast<long long>(d.latency.freeze_count),
+            static_cast<long long>(d.latency.total_freeze_ms),
+            static_cast<long long>(d.latency.frames_marked),
+            d.latency.latency_min_ms, d.latency.latency_mean_ms,
+            d.latency.latency_p50_ms, d.latency.latency_p95_ms,
+            d.latency.latency_p99_ms, d.latency.latency_max_ms,
+            i + 1 < directions.size() ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+  fclose(file);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  HarnessOptions options;
+  if (!ParseOptions(argc, argv, &options)) {
+    return 2;
+  }
+
+  LibWebRTC::Initialize();
+  scoped_refptr<RTCPeerConnectionFactory> factory =
+      LibWebRTC::CreateRTCPeerConnectionFactory(true);
+
+  std::vector<std::unique_ptr<LoopbackCall>> calls;
+  for (int i = 0; i < options.pairs; i++) {
+    calls.emplace_back(new LoopbackCall(i));
+    calls.back()->Start(factory, options.call);
+  }
+
+  // Wait until every call is connected or has failed.
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(options.connect_timeout_s);
+  while (std::chrono::steady_clock::now() < deadline) {
+    bool pending = false;
+    for (const auto& call : calls) {
+      pending |= !call->connected() && !call->failed();
+    }
+    if (!pending) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  std::vector<LoopbackCall*> connected;
+  for (const auto& call : calls) {
+    if (call->connected()) {
+      connected.push_back(call.get());
+    } else {
+      std::string error = call->failed() ? call->error() : "connect timeout";
+      fprintf(stderr, "call %d: %s\n", call->index(), error.c_str());
+    }
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(options.warmup_s));
+
+  // Start of the measurement window.
+  std::vector<LoopbackFrameCounters> start(connected.size() * 2);
+  for (size_t i = 0; i < connected.size(); i++) {
+    connected[i]->caller()->GetFrameCounters(&start[i * 2]);
+    connected[i]->callee()->GetFrameCounters(&start[i * 2 + 1]);
+    connected[i]->caller()->ResetStats();
+    connected[i]->callee()->ResetStats();
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  const int64_t start_cpu_us = ProcessCpuMicros();
+
+  std::this_thread::sleep_for(std::chrono::seconds(options.duration_s));
+
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start_time)
+                             .count();
+  const double cpu_percent =
+      100.0 * (ProcessCpuMicros() - start_cpu_us) / (seconds * 1e6);
+  int64_t resident = 0, peak = 0;
+  ProcessMemory(&resident, &peak);
+
+  bool ok = connected.size() == calls.size();
+  std::vector<DirectionResult> directions;
+  for (size_t i = 0; i < connected.size(); i++) {
+    LoopbackEndpoint* a = connected[i]->caller();
+    LoopbackEndpoint* b = connected[i]->callee();
+    directions.push_back(
+        MeasureDirection(a, b, start[i * 2], start[i * 2 + 1], seconds));
+    directions.push_back(
+        MeasureDirection(b, a, start[i * 2 + 1], start[i * 2], seconds));
+  }
+
+  const int pairs = static_cast<int>(connected.size());
+  printf("%d/%d pairs connected, %.1f s measured\n", pairs, options.pairs,
+         seconds);
+  printf("cpu %.1f%% (%.1f%% per pair), rss %.1f MB, peak %.1f MB\n",
+         cpu_percent, pairs > 0 ? cpu_percent / pairs : 0.0,
+         resident / 1048576.0, peak / 1048576.0);
+  printf("%-22s %8s %8s %8s %6s %7s %8s %8s %8s\n", "direction", "enc fps",
+         "dec fps", "rnd fps", "lost", "freezes", "p50 ms", "p95 ms",
+         "p99 ms");
+  for (const DirectionResult& d : directions) {
+    printf("%-22s %8.1f %8.1f %8.1f %6lld %7lld %8.1f %8.1f %8.1f\n",
+           d.name.c_str(), d.encoded_fps, d.decoded_fps, d.rendered_fps,
+           static_cast<long long>(d.latency.frames_lost),
+           static_cast<long long>(d.latency.freeze_count),
+           d.latency.latency_p50_ms, d.latency.latency_p95_ms,
+           d.latency.latency_p99_ms);
+    ok &= d.latency.frames_marked > 0;
+  }
+
+  if (!WriteJson(options.out, options, pairs, cpu_percent, resident, peak,
+                 directions)) {
+    fprintf(stderr, "could not write %s\n", options.out.c_str());
+  }
+
+  for (auto& call : calls) {
+    call->Stop();
+  }
+  calls.clear();
+  factory->Terminate();
+  factory = nullptr;
+  LibWebRTC::Terminate();
+  return ok ? 0 : 1;
+}